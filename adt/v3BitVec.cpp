@@ -10,6 +10,7 @@
 #define V3_BIT_VEC_C
 
 #include "v3BitVec.h"
+#include "v3Vec.h"
 
 #include <cstdio>
 #include <cstdlib>
@@ -216,90 +217,143 @@ V3BitVec::set(const char* exp) {
 /* -------------------------------------------------- *\
  * Class V3BitVecX Implementations
 \* -------------------------------------------------- */
+// Word-level Helper Functions
+static inline const uint64_t bitMaskX(const unsigned& i) { return 1ull << (i & 63); }
+
+static inline const unsigned bitWordsX(const unsigned& s) { return (s + 63) >> 6; }
+
+// Set Bits [from, to) in d
+static void setBitsX(uint64_t* const d, unsigned from, const unsigned& to) {
+   for (; from < to && (from & 63); ++from) d[from >> 6] |= bitMaskX(from);
+   for (; from + 64 <= to; from += 64) d[from >> 6] = ~0ull;
+   for (; from < to; ++from) d[from >> 6] |= bitMaskX(from);
+}
+
+// Get 64 Bits Starting from Bit pos in d of w Words
+static inline const uint64_t getWordX(const uint64_t* const d, const unsigned& w, const unsigned& pos) {
+   const unsigned i = pos >> 6, off = pos & 63; if (i >= w) return 0;
+   return (off && (1 + i) < w) ? ((d[i] >> off) | (d[1 + i] << (64 - off))) : (d[i] >> off);
+}
+
+// OR Bits of s (len Bits, Zero Beyond) into d of w Words at Bit pos
+static void orBitsX(uint64_t* const d, const unsigned& w, const unsigned& pos, const uint64_t* const s, const unsigned& len) {
+   for (unsigned k = 0, j = bitWordsX(len); k < j; ++k) {
+      const unsigned i = (pos >> 6) + k, off = pos & 63; assert (i < w);
+      d[i] |= (s[k] << off); if (off && (1 + i) < w) d[1 + i] |= (s[k] >> (64 - off));
+   }
+}
+
+// Logical Shifts on w Words
+static void shrWordsX(uint64_t* const d, const unsigned& w, const unsigned& s) {
+   const unsigned q = s >> 6, r = s & 63;
+   for (unsigned i = 0; i < w; ++i) {
+      const uint64_t lo = ((i + q) < w) ? d[i + q] : 0, hi = ((i + q + 1) < w) ? d[i + q + 1] : 0;
+      d[i] = r ? ((lo >> r) | (hi << (64 - r))) : lo;
+   }
+}
+
+static void shlWordsX(uint64_t* const d, const unsigned& w, const unsigned& s) {
+   const unsigned q = s >> 6, r = s & 63; unsigned i = w;
+   while (i--) {
+      const uint64_t hi = (i >= q) ? d[i - q] : 0, lo = (i > q) ? d[i - q - 1] : 0;
+      d[i] = r ? ((hi << r) | (lo >> (64 - r))) : hi;
+   }
+}
+
+// Full 64 x 64 -> 128 Multiplication
+static inline void mulWordX(const uint64_t& a, const uint64_t& b, uint64_t& lo, uint64_t& hi) {
+   const uint64_t a0 = a & 0xffffffffull, a1 = a >> 32, b0 = b & 0xffffffffull, b1 = b >> 32;
+   const uint64_t p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+   const uint64_t mid = (p00 >> 32) + (p01 & 0xffffffffull) + (p10 & 0xffffffffull);
+   lo = (mid << 32) | (p00 & 0xffffffffull); hi = p11 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+}
+
+// Compare Fully-known Words from MSB, Return -1, 0, 1
+static inline const int cmpWordsX(const uint64_t* const a, const uint64_t* const b, const unsigned& w) {
+   unsigned i = w;
+   while (i--) if (a[i] != b[i]) return (a[i] < b[i]) ? -1 : 1;
+   return 0;
+}
+
 V3BitVecX::V3BitVecX(const unsigned& s) {
    assert (s); set(s, true);
 }
 
 V3BitVecX::V3BitVecX(const V3BitVec& b) {
    assert (b.size()); set(b.size(), true); assert (_size == b.size());
-   for (unsigned i = 0, pos = 0, w_pos = 0; i < _size; ++i) {
-      assert (w_pos < words(_size));
-      if (b[i]) _data1[w_pos] |= IDX_MASK[pos];
-      else _data0[w_pos] |= IDX_MASK[pos];
-      if (++pos < 8) continue; pos = 0; ++w_pos;
+   for (unsigned i = 0; i < _size; ++i) {
+      if (b[i]) _data1[i >> 6] |= bitMaskX(i);
+      else _data0[i >> 6] |= bitMaskX(i);
    }
 }
 
 V3BitVecX::V3BitVecX(const V3BitVecS& b) {
-   unsigned s = sizeof(b._data0); set(s << 3);
-   memcpy(_data0, &(b._data0), s); memcpy(_data1, &(b._data1), s);
+   set(sizeof(b._data0) << 3); _data0[0] = b._data0; _data1[0] = b._data1;
 }
 
 V3BitVecX::V3BitVecX(const V3BitVecX& b) {
    assert (b._size); set(b._size);
-   unsigned s = sizeof(unsigned char) * words(_size);
-   memcpy(_data0, b._data0, s); memcpy(_data1, b._data1, s);
+   for (unsigned i = 0, j = wordSize(); i < j; ++i) { _data0[i] = b._data0[i]; _data1[i] = b._data1[i]; }
 }
 
 V3BitVecX::~V3BitVecX() {
-   if (_data0) delete[] _data0;
-   if (_data1) delete[] _data1;
+   release();
 }
 
 void
 V3BitVecX::set1(const unsigned& i) {
-   _data0[i >> 3] &= ~IDX_MASK[MOD_WORD & i]; _data1[i >> 3] |=  IDX_MASK[MOD_WORD & i];
+   _data0[i >> 6] &= ~bitMaskX(i); _data1[i >> 6] |=  bitMaskX(i);
    assert (i < _size); assert (V3_BV1 == (*this)[i]);
 }
 
 void
 V3BitVecX::set0(const unsigned& i) {
-   _data0[i >> 3] |=  IDX_MASK[MOD_WORD & i]; _data1[i >> 3] &= ~IDX_MASK[MOD_WORD & i];
+   _data0[i >> 6] |=  bitMaskX(i); _data1[i >> 6] &= ~bitMaskX(i);
    assert (i < _size); assert (V3_BV0 == (*this)[i]);
 }
 
 void
 V3BitVecX::setX (const unsigned& i) {
-   _data0[i >> 3] &= ~IDX_MASK[MOD_WORD & i]; _data1[i >> 3] &= ~IDX_MASK[MOD_WORD & i];
+   _data0[i >> 6] &= ~bitMaskX(i); _data1[i >> 6] &= ~bitMaskX(i);
    assert (i < _size); assert (V3_BVX == (*this)[i]);
 }
 
 void
 V3BitVecX::restrict0() {
-   for (unsigned i = 0, j = words(_size); i < j; ++i) _data0[i] |= ~(_data0[i] | _data1[i]);
+   for (unsigned i = 0, j = wordSize(); i < j; ++i) _data0[i] |= (~(_data0[i] | _data1[i]) & wordMask(i));
 }
 
 const bool
 V3BitVecX::all1() const {
-   for (unsigned i = 0; i < _size; ++i)
-      if (V3_BV1 != (*this)[i]) return false;
+   for (unsigned i = 0, j = wordSize(); i < j; ++i)
+      if (_data1[i] != wordMask(i)) return false;
    return true;
 }
 
 const bool
 V3BitVecX::all0() const {
-   for (unsigned i = 0; i < _size; ++i)
-      if (V3_BV0 != (*this)[i]) return false;
+   for (unsigned i = 0, j = wordSize(); i < j; ++i)
+      if (_data0[i] != wordMask(i)) return false;
    return true;
 }
 
 const bool
 V3BitVecX::allX() const {
-   for (unsigned i = 0, j = words(_size); i < j; ++i)
+   for (unsigned i = 0, j = wordSize(); i < j; ++i)
       if (_data0[i] || _data1[i]) return false;
    return true;
 }
 
 const bool
 V3BitVecX::exist1 () const {
-   for (unsigned i = 0, j = words(_size); i < j; ++i)
+   for (unsigned i = 0, j = wordSize(); i < j; ++i)
       if (_data1[i]) return true;
    return false;
 }
 
 const bool
 V3BitVecX::exist0 () const {
-   for (unsigned i = 0, j = words(_size); i < j; ++i)
+   for (unsigned i = 0, j = wordSize(); i < j; ++i)
       if (_data0[i]) return true;
    return false;
 }
@@ -308,63 +362,59 @@ const unsigned
 V3BitVecX::value() const {
    assert (_size == firstX());
    assert (_size < (sizeof(unsigned) << 3));
-   unsigned value = 0, sum = 0;
-   unsigned shift = sizeof(_data1[0]) << 3;
-   for (int i = (int)(words(_size)) - 1; i >= 0; --i) {
-      sum <<= shift; value = _data1[i]; sum += value;
-   }
-   return sum;
+   return (unsigned)(_data1[0]);
 }
 
 const unsigned
 V3BitVecX::first1() const {
-   unsigned i = 0;
-   for (; i < _size; ++i)
-      if (V3_BV1 == (*this)[i]) break;
-   return i;
+   for (unsigned i = 0, j = wordSize(); i < j; ++i)
+      if (_data1[i]) return (i << 6) + __builtin_ctzll(_data1[i]);
+   return _size;
 }
 
 const unsigned
 V3BitVecX::first0() const {
-   unsigned i = 0;
-   for (; i < _size; ++i)
-      if (V3_BV0 == (*this)[i]) break;
-   return i;
+   for (unsigned i = 0, j = wordSize(); i < j; ++i)
+      if (_data0[i]) return (i << 6) + __builtin_ctzll(_data0[i]);
+   return _size;
 }
 
 const unsigned
 V3BitVecX::firstX() const {
-   unsigned i = 0;
-   for (; i < _size; ++i)
-      if (V3_BVX == (*this)[i]) break;
-   return i;
+   for (unsigned i = 0, j = wordSize(); i < j; ++i) {
+      const uint64_t x = ~(_data0[i] | _data1[i]) & wordMask(i);
+      if (x) return (i << 6) + __builtin_ctzll(x);
+   }
+   return _size;
 }
 
 const unsigned
 V3BitVecX::dcBits() const {
    unsigned j = 0;
-   for (unsigned i = 0; i < _size; ++i)
-      if (V3_BVX == (*this)[i]) ++j;
+   for (unsigned i = 0, k = wordSize(); i < k; ++i)
+      j += __builtin_popcountll(~(_data0[i] | _data1[i]) & wordMask(i));
    return j;
 }
 
 void
 V3BitVecX::clear() {
-   for (unsigned i = 0, j = words(_size); i < j; ++i) _data0[i] = _data1[i] = 0;
+   for (unsigned i = 0, j = wordSize(); i < j; ++i) _data0[i] = _data1[i] = 0;
 }
 
 void
 V3BitVecX::random() {
-   const unsigned j = words(_size) - 1;
-   for (unsigned i = 0; i <= j; ++i) { _data0[i] = rand(); _data1[i] = ~_data0[i]; }
-   const unsigned idx = MOD_WORD & (unsigned char)_size;
-   if (idx) { _data0[j] &= (IDX_MASK[idx] - 1); _data1[j] &= (IDX_MASK[idx] - 1); }
+   for (unsigned i = 0, j = wordSize(); i < j; ++i) {
+      _data0[i] = (((uint64_t)rand() << 42) ^ ((uint64_t)rand() << 21) ^ (uint64_t)rand()) & wordMask(i);
+      _data1[i] = ~_data0[i] & wordMask(i);
+   }
 }
 
 const string
 V3BitVecX::toExp() const {
+   // One Byte of _data0 followed by One Byte of _data1
    string str = "";
-   for (unsigned i = 0, j = words(_size); i < j; ++i) { str += _data0[i]; str += _data1[i]; }
+   for (unsigned i = 0, j = words(_size); i < j; ++i) {
+      str += (char)(_data0[i >> 3] >> ((i & 7) << 3)); str += (char)(_data1[i >> 3] >> ((i & 7) << 3)); }
    return str;
 }
 
@@ -377,15 +427,13 @@ V3BitVecX::regEx() const {
 
 void
 V3BitVecX::resize(const unsigned& s, const bool& init) {
-   assert (_data0); delete[] _data0;
-   assert (_data1); delete[] _data1;
-   set(s, init);
+   release(); set(s, init);
 }
 
 V3BitVecX&
 V3BitVecX::operator &= (const V3BitVecX& b) {
    assert (size() == b.size());
-   for (unsigned i = 0, j = words(_size); i < j; ++i) {
+   for (unsigned i = 0, j = wordSize(); i < j; ++i) {
       _data0[i] |= b._data0[i]; _data1[i] &= b._data1[i];
    }
    return *this;
@@ -394,7 +442,7 @@ V3BitVecX::operator &= (const V3BitVecX& b) {
 V3BitVecX&
 V3BitVecX::operator |= (const V3BitVecX& b) {
    assert (size() == b.size());
-   for (unsigned i = 0, j = words(_size); i < j; ++i) {
+   for (unsigned i = 0, j = wordSize(); i < j; ++i) {
       _data0[i] &= b._data0[i]; _data1[i] |= b._data1[i];
    }
    return *this;
@@ -403,10 +451,10 @@ V3BitVecX::operator |= (const V3BitVecX& b) {
 V3BitVecX&
 V3BitVecX::operator ^= (const V3BitVecX& b) {
    assert (size() == b.size());
-   V3BitVecX temp = *this; assert (temp == *this);
-   for (unsigned i = 0, j = words(_size); i < j; ++i) {
-      _data0[i] = (temp._data0[i] & b._data0[i]) | (temp._data1[i] & b._data1[i]);
-      _data1[i] = (temp._data0[i] & b._data1[i]) | (temp._data1[i] & b._data0[i]);
+   for (unsigned i = 0, j = wordSize(); i < j; ++i) {
+      const uint64_t zeros = (_data0[i] & b._data0[i]) | (_data1[i] & b._data1[i]);
+      const uint64_t ones  = (_data0[i] & b._data1[i]) | (_data1[i] & b._data0[i]);
+      _data0[i] = zeros; _data1[i] = ones;
    }
    return *this;
 }
@@ -414,6 +462,14 @@ V3BitVecX::operator ^= (const V3BitVecX& b) {
 V3BitVecX&
 V3BitVecX::operator += (const V3BitVecX& b) {
    assert (size() == b.size());
+   if (isKnown() && b.isKnown()) {
+      uint64_t carry = 0;
+      for (unsigned i = 0, j = wordSize(); i < j; ++i) {
+         const uint64_t a = _data1[i], s = a + b._data1[i], sum = s + carry;
+         carry = (s < a) | (sum < s); _data1[i] = sum & wordMask(i);
+      }
+      setKnown(_data1); return *this;
+   }
    char sum = V3_BV0, carry = V3_BV0;
    for (unsigned i = 0; i < _size; ++i) {
       sum = op_add((*this)[i], b[i], carry);
@@ -426,6 +482,14 @@ V3BitVecX::operator += (const V3BitVecX& b) {
 V3BitVecX&
 V3BitVecX::operator -= (const V3BitVecX& b) {
    assert (size() == b.size());
+   if (isKnown() && b.isKnown()) {
+      uint64_t borrow = 0;
+      for (unsigned i = 0, j = wordSize(); i < j; ++i) {
+         const uint64_t a = _data1[i], c = b._data1[i], diff = a - c - borrow;
+         borrow = (a < c) | ((a == c) & borrow); _data1[i] = diff & wordMask(i);
+      }
+      setKnown(_data1); return *this;
+   }
    char sum = V3_BV0, carry = V3_BV1;
    for (unsigned i = 0; i < _size; ++i) {
       sum = op_add((*this)[i], op_inv(b[i]), carry);
@@ -438,7 +502,22 @@ V3BitVecX::operator -= (const V3BitVecX& b) {
 V3BitVecX&
 V3BitVecX::operator *= (const V3BitVecX& b) {
    assert (size() == b.size());
-   char carry[((_size * (_size + 1)) >> 1) + 1], prev_result[_size + 1];
+   if (isKnown() && b.isKnown()) {
+      const unsigned w = wordSize();
+      if (1 == w) { _data1[0] = (_data1[0] * b._data1[0]) & wordMask(0); setKnown(_data1); return *this; }
+      V3Vec<uint64_t>::Vec product(w, 0); uint64_t lo, hi, carry, sum, c;
+      for (unsigned i = 0; i < w; ++i) {
+         carry = 0;
+         for (unsigned j = 0; (i + j) < w; ++j) {
+            mulWordX(_data1[i], b._data1[j], lo, hi);
+            sum = product[i + j] + lo; c = (sum < lo); sum += carry; c += (sum < carry);
+            product[i + j] = sum; carry = hi + c;
+         }
+      }
+      product[w - 1] &= wordMask(w - 1); setKnown(&(product[0])); return *this;
+   }
+   // Array Multiplier for Values with Don't Cares
+   V3Vec<char>::Vec carry(((_size * (_size + 1)) >> 1) + 1), prev_result(_size + 1);
    const V3BitVecX value(*this); assert (*this == value);
    // 1. AND results for corresponding ai * bj
    set_value(0, op_and(value[0], b[0]));
@@ -481,28 +560,24 @@ V3BitVecX::operator %= (const V3BitVecX& b) {
 V3BitVecX&
 V3BitVecX::operator >>= (const V3BitVecX& b) {
    bool hasX = false;
-   unsigned shift = 0, j = 0;
+   unsigned shift = 0;
    for (unsigned i = 0; i < b.size(); ++i) {
       if (b[i] == V3_BV1) {
-         j = (1ul << i); assert (1ul == (j >> i));
-         //j = (unsigned)(pow(2, (double)i));
-         if (_size <= j) { shift = _size; break; }
-         //else if (i >= sizeof(unsigned)) assert (0);
-         else shift += j;
+         if (i >= 32 || _size <= (1u << i)) { shift = _size; break; }
+         else shift += (1u << i);
       }
       else if (b[i] == V3_BVX) hasX = true;
    }
-   if (shift >= _size) for (unsigned i = 0; i < _size; ++i) set0(i);
+   if (shift >= _size) { clear(); setBitsX(_data0, 0, _size); }
    else if (shift) {
-      for (unsigned i = 0, j = _size - shift; i < j; ++i) set_value(i, (*this)[shift + i]);
-      for (unsigned i = _size - shift, j = _size; i < j; ++i) set0(i);
+      shrWordsX(_data0, wordSize(), shift); shrWordsX(_data1, wordSize(), shift);
+      setBitsX(_data0, _size - shift, _size);
    }
    if (hasX && !all0()) {
       for (unsigned i = 0; i < b.size(); ++i) {
          if (b[i] == V3_BVX) {
             // Ex : 101010 >> X0 will be X01010
             shift = (1ul << i); assert (1ul == (shift >> i));
-            //shift = (unsigned)(pow(2, (double)i));
             if (_size > shift) for (unsigned i = 0, j = _size - shift; i < j; ++i) if (!op_eq((*this)[i], (*this)[shift + i])) setX(i);
             for (unsigned i = _size - shift, j = _size; i < j; ++i) if (V3_BV1 == (*this)[i]) setX(i);
             if (_size <= shift) break;
@@ -515,29 +590,26 @@ V3BitVecX::operator >>= (const V3BitVecX& b) {
 V3BitVecX&
 V3BitVecX::operator <<= (const V3BitVecX& b) {
    bool hasX = false;
-   unsigned shift = 0, j = 0;
+   unsigned shift = 0;
    for (unsigned i = 0; i < b.size(); ++i) {
       if (b[i] == V3_BV1) {
-         j = (1ul << i); assert (1ul == (j >> i));
-         //j = (unsigned)(pow(2, (double)i));
-         if (_size <= j) { shift = _size; break; }
-         //else if (i >= sizeof(unsigned)) assert (0);
-         else shift += j;
+         if (i >= 32 || _size <= (1u << i)) { shift = _size; break; }
+         else shift += (1u << i);
       }
       else if (b[i] == V3_BVX) hasX = true;
    }
-   if (shift >= _size) for (unsigned i = 0; i < _size; ++i) set0(i);
+   if (shift >= _size) { clear(); setBitsX(_data0, 0, _size); }
    else if (shift) {
-      unsigned i = _size - shift;
-      while (i--) set_value(shift + i, (*this)[i]);
-      for (i = 0, j = shift; i < j; ++i) set0(i);
+      const unsigned w = wordSize();
+      shlWordsX(_data0, w, shift); shlWordsX(_data1, w, shift);
+      _data0[w - 1] &= wordMask(w - 1); _data1[w - 1] &= wordMask(w - 1);
+      setBitsX(_data0, 0, shift);
    }
    if (hasX && !all0()) {
       for (unsigned i = 0; i < b.size(); ++i) {
          if (b[i] == V3_BVX) {
             // Ex : 101010 >> X0 will be X01010
             shift = (1ul << i); assert (1ul == (shift >> i));
-            //shift = (unsigned)(pow(2, (double)i));
             if (_size > shift) {
                unsigned j = _size - shift;
                while (j--) if (!op_eq((*this)[j], (*this)[shift + j])) setX(shift + j);
@@ -554,7 +626,7 @@ V3BitVecX::operator <<= (const V3BitVecX& b) {
 const bool
 V3BitVecX::operator == (const V3BitVecX& b) const {
    assert (b.size() == size());
-   for (unsigned i = 0, j = words(_size); i < j; ++i)
+   for (unsigned i = 0, j = wordSize(); i < j; ++i)
       if ((_data0[i] != b._data0[i]) || (_data1[i] != b._data1[i])) return false;
    return true;
 }
@@ -566,16 +638,17 @@ V3BitVecX::operator != (const V3BitVecX& b) const {
 
 V3BitVecX&
 V3BitVecX::operator = (const V3BitVecX& b) {
-   if (words(_size) != words(b._size)) resize(b._size, false);
-   unsigned s = sizeof(unsigned char) * words(_size);
-   memcpy(_data0, b._data0, s); memcpy(_data1, b._data1, s);
-   _size = b._size; return *this;
+   if (this == &b) return *this;
+   if (wordSize() != b.wordSize()) resize(b._size, false);
+   _size = b._size;
+   for (unsigned i = 0, j = wordSize(); i < j; ++i) { _data0[i] = b._data0[i]; _data1[i] = b._data1[i]; }
+   return *this;
 }
 
 const char
 V3BitVecX::operator[] (const unsigned& i) const {
-   if (_data0[i >> 3] & IDX_MASK[MOD_WORD & i]) return V3_BV0;
-   else if (_data1[i >> 3] & IDX_MASK[MOD_WORD & i]) return V3_BV1;
+   if (_data0[i >> 6] & bitMaskX(i)) return V3_BV0;
+   else if (_data1[i >> 6] & bitMaskX(i)) return V3_BV1;
    else return V3_BVX;
 }
 
@@ -588,14 +661,13 @@ ostream& operator << (ostream& os, const V3BitVecX& b) {
 void
 V3BitVecX::copy(V3BitVecX& b) const {
    assert (_size == b.size());
-   unsigned s = sizeof(unsigned char) * words(_size);
-   memcpy(b._data0, _data0, s); memcpy(b._data1, _data1, s);
+   for (unsigned i = 0, j = wordSize(); i < j; ++i) { b._data0[i] = _data0[i]; b._data1[i] = _data1[i]; }
 }
 
 const bool
 V3BitVecX::bv_intersect(const V3BitVecX& b) const {
    assert (size() == b.size());
-   for (unsigned i = 0, j = words(_size); i < j; ++i) {
+   for (unsigned i = 0, j = wordSize(); i < j; ++i) {
       if ((_data0[i] | b._data0[i]) & (_data1[i] | b._data1[i])) return false;
    }
    return true;
@@ -604,7 +676,7 @@ V3BitVecX::bv_intersect(const V3BitVecX& b) const {
 const bool
 V3BitVecX::bv_cover(const V3BitVecX& b) const {
    assert (size() == b.size());
-   for (unsigned i = 0, j = words(_size); i < j; ++i) {
+   for (unsigned i = 0, j = wordSize(); i < j; ++i) {
       if ((_data0[i] & ~b._data0[i]) | (_data1[i] & ~b._data1[i])) return false;
    }
    return true;
@@ -613,42 +685,52 @@ V3BitVecX::bv_cover(const V3BitVecX& b) const {
 const V3BitVecX
 V3BitVecX::bv_equal(const V3BitVecX& b) const {
    V3BitVecX bv_comp(1);
-   bv_comp.set_value(0, op_bv_equal(b));
+   if (isKnown() && b.isKnown()) {
+      if (cmpWordsX(_data1, b._data1, wordSize())) bv_comp.set0(0); else bv_comp.set1(0); }
+   else bv_comp.set_value(0, op_bv_equal(b));
    return bv_comp;
 }
 
 const V3BitVecX
 V3BitVecX::bv_geq(const V3BitVecX& b) const {
    V3BitVecX bv_comp(1);
-   bv_comp.set_value(0, op_bv_geq(b));
+   if (isKnown() && b.isKnown()) {
+      if (cmpWordsX(_data1, b._data1, wordSize()) >= 0) bv_comp.set1(0); else bv_comp.set0(0); }
+   else bv_comp.set_value(0, op_bv_geq(b));
    return bv_comp;
 }
 
 const V3BitVecX
 V3BitVecX::bv_leq(const V3BitVecX& b) const {
    V3BitVecX bv_comp(1);
-   bv_comp.set_value(0, op_bv_leq(b));
+   if (isKnown() && b.isKnown()) {
+      if (cmpWordsX(_data1, b._data1, wordSize()) <= 0) bv_comp.set1(0); else bv_comp.set0(0); }
+   else bv_comp.set_value(0, op_bv_leq(b));
    return bv_comp;
 }
 
 const V3BitVecX
 V3BitVecX::bv_gt(const V3BitVecX& b) const {
    V3BitVecX bv_comp(1);
-   bv_comp.set_value(0, op_inv(op_bv_leq(b)));
+   if (isKnown() && b.isKnown()) {
+      if (cmpWordsX(_data1, b._data1, wordSize()) > 0) bv_comp.set1(0); else bv_comp.set0(0); }
+   else bv_comp.set_value(0, op_inv(op_bv_leq(b)));
    return bv_comp;
 }
 
 const V3BitVecX
 V3BitVecX::bv_lt(const V3BitVecX& b) const {
    V3BitVecX bv_comp(1);
-   bv_comp.set_value(0, op_inv(op_bv_geq(b)));
+   if (isKnown() && b.isKnown()) {
+      if (cmpWordsX(_data1, b._data1, wordSize()) < 0) bv_comp.set1(0); else bv_comp.set0(0); }
+   else bv_comp.set_value(0, op_inv(op_bv_geq(b)));
    return bv_comp;
 }
 
 const V3BitVecX
 V3BitVecX::operator ~ () const {
    V3BitVecX bv_inv(_size);
-   for (unsigned i = 0, j = words(_size); i < j; ++i) {
+   for (unsigned i = 0, j = wordSize(); i < j; ++i) {
       bv_inv._data0[i] = _data1[i];
       bv_inv._data1[i] = _data0[i];
    }
@@ -657,32 +739,25 @@ V3BitVecX::operator ~ () const {
 
 const V3BitVecX
 V3BitVecX::bv_red_and() const {
-   V3BitVecX bv_red(1); bv_red.set1(0);
-   bool exist_X = false;
-   for (unsigned i = 0; i < _size; ++i)
-      if (V3_BV0 == (*this)[i]) { bv_red.set0(0); return bv_red; }
-      else if (V3_BVX == (*this)[i]) exist_X = true;
-   if (exist_X) bv_red.setX(0); return bv_red;
+   V3BitVecX bv_red(1);
+   if (exist0()) bv_red.set0(0); else if (all1()) bv_red.set1(0); else bv_red.setX(0);
+   return bv_red;
 }
 
 const V3BitVecX
 V3BitVecX::bv_red_or() const {
-   V3BitVecX bv_red(1); bv_red.set0(0);
-   bool exist_X = false;
-   for (unsigned i = 0; i < _size; ++i)
-      if (V3_BV1 == (*this)[i]) { bv_red.set1(0); return bv_red; }
-      else if (V3_BVX == (*this)[i]) exist_X = true;
-   if (exist_X) bv_red.setX(0); return bv_red;
+   V3BitVecX bv_red(1);
+   if (exist1()) bv_red.set1(0); else if (all0()) bv_red.set0(0); else bv_red.setX(0);
+   return bv_red;
 }
 
 const V3BitVecX
 V3BitVecX::bv_red_xor() const {
-   V3BitVecX bv_red(1); bv_red.set0(0);
+   V3BitVecX bv_red(1);
+   if (!isKnown()) { bv_red.setX(0); return bv_red; }
    unsigned count_1 = 0;
-   for (unsigned i = 0; i < _size; ++i)
-      if (V3_BV1 == (*this)[i]) ++count_1;
-      else if (V3_BVX == (*this)[i]) { bv_red.setX(0); return bv_red; }
-   if (count_1 & 1ul) bv_red.set1(0); return bv_red;
+   for (unsigned i = 0, j = wordSize(); i < j; ++i) count_1 += __builtin_popcountll(_data1[i]);
+   if (count_1 & 1ul) bv_red.set1(0); else bv_red.set0(0); return bv_red;
 }
 
 const V3BitVecX
@@ -691,7 +766,12 @@ V3BitVecX::bv_slice(const unsigned& msb, const unsigned& lsb) const {
    const unsigned size = 1 + (unsigned)abs((int)msb - (int)lsb);
    if (_size == size) return *this;
    V3BitVecX slice(size); assert (_size > size);
-   if (msb >= lsb) for (unsigned i = 0; i < size; ++i) slice.set_value(i, (*this)[lsb + i]);
+   if (msb >= lsb) {
+      for (unsigned i = 0, j = slice.wordSize(); i < j; ++i) {
+         slice._data0[i] = getWordX(_data0, wordSize(), lsb + (i << 6)) & slice.wordMask(i);
+         slice._data1[i] = getWordX(_data1, wordSize(), lsb + (i << 6)) & slice.wordMask(i);
+      }
+   }
    else for (unsigned i = 0; i < size; ++i) slice.set_value(i, (*this)[lsb - i]);
    return slice;
 }
@@ -699,8 +779,10 @@ V3BitVecX::bv_slice(const unsigned& msb, const unsigned& lsb) const {
 const V3BitVecX
 V3BitVecX::bv_concat(const V3BitVecX& a) const {
    V3BitVecX concat(_size + a.size());
-   for (unsigned i = 0; i < a.size(); ++i) concat.set_value(i, a[i]);
-   for (unsigned i = 0; i < _size; ++i) concat.set_value(a.size() + i, (*this)[i]);
+   orBitsX(concat._data0, concat.wordSize(), 0, a._data0, a._size);
+   orBitsX(concat._data1, concat.wordSize(), 0, a._data1, a._size);
+   orBitsX(concat._data0, concat.wordSize(), a._size, _data0, _size);
+   orBitsX(concat._data1, concat.wordSize(), a._size, _data1, _size);
    return concat;
 }
 
@@ -710,11 +792,10 @@ V3BitVecX::bv_select(const V3BitVecX& f, const V3BitVecX& t) const {
    char select = (*this)[0];
    if (V3_BV1 == select) return t;
    else if (V3_BV0 == select) return f;
+   // Keep Bits on which t and f Agree, and Set Others to X
    V3BitVecX bv_sel = t; assert (t == bv_sel);
-   char t_value;
-   for (unsigned i = 0; i < f._size; ++i) {
-      t_value = t[i];
-      if (V3_BVX == t_value || !op_eq(t_value, f[i])) bv_sel.setX(i);
+   for (unsigned i = 0, j = bv_sel.wordSize(); i < j; ++i) {
+      bv_sel._data0[i] &= f._data0[i]; bv_sel._data1[i] &= f._data1[i];
    }
    return bv_sel;
 }
@@ -722,6 +803,27 @@ V3BitVecX::bv_select(const V3BitVecX& f, const V3BitVecX& t) const {
 void
 V3BitVecX::bv_divided_by(const V3BitVecX& b, const bool& setRemainder) {
    assert (_size == b.size());
+   if (isKnown() && b.isKnown()) {
+      // Division by Zero Yields All Ones for Quotient and the Dividend for Remainder
+      const unsigned w = wordSize();
+      if (1 == w) {
+         const uint64_t a = _data1[0], d = b._data1[0];
+         _data1[0] = d ? (setRemainder ? (a % d) : (a / d)) : (setRemainder ? a : wordMask(0));
+         setKnown(_data1); return;
+      }
+      V3Vec<uint64_t>::Vec q(w, 0), r(w, 0); unsigned i = _size;
+      while (i--) {
+         shlWordsX(&(r[0]), w, 1); r[0] |= ((_data1[i >> 6] >> (i & 63)) & 1ull);
+         if (cmpWordsX(&(r[0]), b._data1, w) < 0) continue;
+         uint64_t borrow = 0;
+         for (unsigned j = 0; j < w; ++j) {
+            const uint64_t x = r[j], y = b._data1[j]; r[j] = x - y - borrow;
+            borrow = (x < y) | ((x == y) & borrow);
+         }
+         q[i >> 6] |= bitMaskX(i);
+      }
+      setKnown(setRemainder ? &(r[0]) : &(q[0])); return;
+   }
    V3BitVecX a(*this), q(_size), r(_size); r.restrict0();
    unsigned i = _size, j; char sum, carry;
    while (i--) {
@@ -746,21 +848,18 @@ V3BitVecX::bv_divided_by(const V3BitVecX& b, const bool& setRemainder) {
          }
       }
    }
-   if (!setRemainder) {
-      unsigned s = sizeof(unsigned char) * words(_size);
-      memcpy(_data0, q._data0, s); memcpy(_data1, q._data1, s);
-   }
-   else {
-      unsigned s = sizeof(unsigned char) * words(_size);
-      memcpy(_data0, r._data0, s); memcpy(_data1, r._data1, s);
-   }
+   if (!setRemainder) q.copy(*this);
+   else r.copy(*this);
 }
 
 void
 V3BitVecX::set(const unsigned& s, const bool& init) {
-   unsigned i = words(_size = s);
-   _data0 = new unsigned char[i + 1]; assert (_data0);
-   _data1 = new unsigned char[i + 1]; assert (_data1);
+   unsigned i = bitWordsX(_size = s);
+   if (i <= 1) { _data0 = &_inline0; _data1 = &_inline1; }
+   else {
+      _data0 = new uint64_t[i]; assert (_data0);
+      _data1 = new uint64_t[i]; assert (_data1);
+   }
    if (init) while (i--) { _data0[i] = _data1[i] = 0; }
 }
 
@@ -920,6 +1019,43 @@ V3BitVecX::op_bv_leq(const V3BitVecX& b) const {
    return ((eq || lt) ? V3_BV1 : V3_BVX);
 }
 
+// Word-level Access Functions
+void
+V3BitVecX::loadWords(const uint64_t* const zeros, const uint64_t* const ones) {
+   for (unsigned i = 0, j = wordSize(); i < j; ++i) { _data0[i] = zeros[i]; _data1[i] = ones[i]; }
+}
+
+void
+V3BitVecX::storeWords(uint64_t* const zeros, uint64_t* const ones) const {
+   for (unsigned i = 0, j = wordSize(); i < j; ++i) { zeros[i] = _data0[i]; ones[i] = _data1[i]; }
+}
+
+// Word-level Helper Functions
+const uint64_t
+V3BitVecX::wordMask(const unsigned& i) const {
+   assert (i < wordSize());
+   return ((1 + i) < wordSize() || !(63 & _size)) ? ~0ull : (bitMaskX(_size) - 1);
+}
+
+const bool
+V3BitVecX::isKnown() const {
+   for (unsigned i = 0, j = wordSize(); i < j; ++i)
+      if ((_data0[i] | _data1[i]) != wordMask(i)) return false;
+   return true;
+}
+
+void
+V3BitVecX::setKnown(const uint64_t* const ones) {
+   // ones May Alias _data1
+   for (unsigned i = 0, j = wordSize(); i < j; ++i) { _data1[i] = ones[i]; _data0[i] = ~ones[i] & wordMask(i); }
+}
+
+void
+V3BitVecX::release() {
+   if (_data0 != &_inline0) { assert (_data0); delete[] _data0; }
+   if (_data1 != &_inline1) { assert (_data1); delete[] _data1; }
+}
+
 /* -------------------------------------------------- *\
  * Class V3BitVecS Implementations
 \* -------------------------------------------------- */
@@ -933,9 +1069,7 @@ V3BitVecS::V3BitVecS(const V3BitVecS& v) {
 }
 
 V3BitVecS::V3BitVecS(const V3BitVecX& v) {
-   assert (v.size() <= 64); _data0 = _data1 = 0;
-   memcpy(&_data0, v._data0, words(v.size()));
-   memcpy(&_data1, v._data1, words(v.size()));
+   assert (v.size() <= 64); _data0 = v._data0[0]; _data1 = v._data1[0];
 }
 
 V3BitVecS::V3BitVecS() { clear(); }
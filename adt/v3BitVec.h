@@ -53,6 +53,8 @@ class V3BitVec
 };
 
 // V3BitVec with Don't Care Supports (00 for X, 01 for 0, 10 for 1, 11 illegal)
+// Bits are packed in 64-bit words, and widths <= 64 are stored inline without heap allocation.
+// Arithmetic on fully-known values is carried out by native word operations.
 class V3BitVecS;
 class V3BitVecX
 {
@@ -124,6 +126,9 @@ class V3BitVecX
       // Special Operators
       const bool bv_intersect(const V3BitVecX&) const;
       const bool bv_cover(const V3BitVecX&) const;
+      // Word-level Access Functions (Bits beyond size() are Zero)
+      void loadWords(const uint64_t* const, const uint64_t* const);
+      void storeWords(uint64_t* const, uint64_t* const) const;
    private : 
       void set(const unsigned&, const bool& = false);
       void set_value(const unsigned&, const char&);
@@ -143,10 +148,18 @@ class V3BitVecX
       const char op_bv_leq(const V3BitVecX&) const;
       // Divider / Modular Operators
       void bv_divided_by(const V3BitVecX&, const bool&);
+      // Word-level Helper Functions
+      inline const unsigned wordSize() const { return (_size + 63) >> 6; }
+      const uint64_t wordMask(const unsigned&) const;
+      const bool isKnown() const;
+      void setKnown(const uint64_t* const);
+      void release();
       // Data Members
       unsigned          _size;
-      unsigned char*    _data0;
-      unsigned char*    _data1;
+      uint64_t*         _data0;     // Points to _inline0 if _size <= 64
+      uint64_t*         _data1;     // Points to _inline1 if _size <= 64
+      uint64_t          _inline0;
+      uint64_t          _inline1;
 };
 
 // Simplified V3BitVecX for Only AND, INV Usage
@@ -167,8 +180,10 @@ class V3BitVecS
       inline void set1(const unsigned& i) { _data0 &= ~(1ul << i); _data1 |= (1ul << i); }
       inline void setX(const unsigned& i) { _data0 &= ~(1ul << i); _data1 &= ~(1ul << i); }
       inline void clear() { _data0 = _data1 = 0; }
-      inline void random() { _data0 = rand(); _data1 = ~_data0; }
+      inline void random() { _data0 = ((uint64_t)rand() << 42) ^ ((uint64_t)rand() << 21) ^ (uint64_t)rand(); _data1 = ~_data0; }
       inline const bool allX() const { return !_data0 && !_data1; }
+      inline const uint64_t getZeros() const { return _data0; }
+      inline const uint64_t getOnes() const { return _data1; }
       // Operators Overloads
       inline const V3BitVecS operator ~ () const { const V3BitVecS v(_data1, _data0); return v; }
       inline V3BitVecS& operator &= (const V3BitVecS& v) { _data0 |= v._data0; _data1 &= v._data1; return *this; }
@@ -0,0 +1,131 @@
+/****************************************************************************
+  FileName     [ v3FlatHash.h ]
+  PackageName  [ v3/src/adt ]
+  Synopsis     [ Abstract Data Type for Open-Addressing Hash Map. ]
+  Author       [ Cheng-Yin Wu ]
+  Copyright    [ Copyright(c) 2012-2014 DVLab, GIEE, NTU, Taiwan ]
+****************************************************************************/
+
+#ifndef V3_ADT_FLAT_HASH_H
+#define V3_ADT_FLAT_HASH_H
+
+#include "v3Vec.h"
+#include "v3Hash.h"
+
+#include <cassert>
+#include <stdint.h>
+
+// class V3FlatHashMap : Open-Addressing Hash Map with Linear Probing
+// Entries are stored in one contiguous slot array, so no node is allocated per insertion.
+// The capacity is a power of two and the load factor is kept below 3/4.
+// Entries expose first and second like std::pair, and each carries its own occupancy flag,
+// so a probe touches one cache line.
+// NOTE : Any insertion or erasure invalidates all iterators !!
+template<class Key, class Data, class HashFcn = tr1::hash<Key>, class EqualKey = std::equal_to<Key> >
+class V3FlatHashMap
+{
+   public :
+      struct value_type {
+         Key            first;
+         Data           second;
+         unsigned char  used;    // Whether this Slot Holds an Entry
+      };
+      // Iterators
+      class iterator {
+         friend class V3FlatHashMap;
+         public :
+            iterator(V3FlatHashMap* const m = 0, const size_t& i = 0) : _map(m), _index(i) {}
+            inline value_type& operator * () const { return _map->_slots[_index]; }
+            inline value_type* operator -> () const { return &(_map->_slots[_index]); }
+            inline iterator& operator ++ () { _index = _map->nextUsed(_index + 1); return *this; }
+            inline iterator operator ++ (int) { iterator it = *this; ++(*this); return it; }
+            friend inline const bool operator == (const iterator& i, const iterator& j) { return i._index == j._index; }
+            friend inline const bool operator != (const iterator& i, const iterator& j) { return i._index != j._index; }
+         private :
+            V3FlatHashMap*    _map;
+            size_t            _index;
+      };
+      class const_iterator {
+         friend class V3FlatHashMap;
+         public :
+            const_iterator(const V3FlatHashMap* const m = 0, const size_t& i = 0) : _map(m), _index(i) {}
+            const_iterator(const iterator& it) : _map(it._map), _index(it._index) {}
+            inline const value_type& operator * () const { return _map->_slots[_index]; }
+            inline const value_type* operator -> () const { return &(_map->_slots[_index]); }
+            inline const_iterator& operator ++ () { _index = _map->nextUsed(_index + 1); return *this; }
+            inline const_iterator operator ++ (int) { const_iterator it = *this; ++(*this); return it; }
+            friend inline const bool operator == (const const_iterator& i, const const_iterator& j) { return i._index == j._index; }
+            friend inline const bool operator != (const const_iterator& i, const const_iterator& j) { return i._index != j._index; }
+         private :
+            const V3FlatHashMap* _map;
+            size_t               _index;
+      };
+      // Constructor and Destructor
+      V3FlatHashMap(const size_t& s = 0) : _size(0), _shift(64) { _slots.clear(); if (s) reserve(s); }
+      ~V3FlatHashMap() { _slots.clear(); }
+      // Capacity Functions
+      inline const size_t size() const { return _size; }
+      inline const bool empty() const { return !_size; }
+      inline void clear() { if (_size) { for (size_t i = 0; i < _slots.size(); ++i) _slots[i].used = 0; _size = 0; } }
+      inline void reserve(const size_t& s) { size_t c = 16; while (4 * s > 3 * c) c <<= 1; if (c > _slots.size()) rehash(c); }
+      // Iterator Functions
+      inline iterator begin() { return iterator(this, nextUsed(0)); }
+      inline iterator end() { return iterator(this, _slots.size()); }
+      inline const_iterator begin() const { return const_iterator(this, nextUsed(0)); }
+      inline const_iterator end() const { return const_iterator(this, _slots.size()); }
+      // Lookup and Modification Functions
+      inline iterator find(const Key& k) { return iterator(this, findIndex(k)); }
+      inline const_iterator find(const Key& k) const { return const_iterator(this, findIndex(k)); }
+      inline const size_t count(const Key& k) const { return (_slots.size() != findIndex(k)) ? 1 : 0; }
+      inline pair<iterator, bool> insert(const pair<Key, Data>& v) { return insert(v.first, v.second); }
+      pair<iterator, bool> insert(const Key& k, const Data& d) {
+         // Look Up First, so Hits (e.g. Repeated operator []) Never Grow the Table
+         size_t i = findIndex(k); if (_slots.size() != i) return make_pair(iterator(this, i), false);
+         if (4 * (1 + _size) > 3 * _slots.size()) rehash(_slots.size() ? (_slots.size() << 1) : 16);
+         for (i = getHome(k); _slots[i].used; i = (i + 1) & (_slots.size() - 1)) ;
+         _slots[i].first = k; _slots[i].second = d; _slots[i].used = 1; ++_size;
+         return make_pair(iterator(this, i), true);
+      }
+      inline Data& operator [] (const Key& k) { return insert(k, Data()).first->second; }
+      const size_t erase(const Key& k) {
+         size_t i = findIndex(k); if (_slots.size() == i) return 0;
+         // Backward Shift Deletion Keeps Probe Sequences Intact without Tombstones
+         const size_t mask = _slots.size() - 1; _slots[i].used = 0; --_size;
+         for (size_t j = (i + 1) & mask; _slots[j].used; j = (j + 1) & mask) {
+            const size_t h = getHome(_slots[j].first);
+            if ((i <= j) ? ((i < h) && (h <= j)) : ((i < h) || (h <= j))) continue;
+            _slots[i] = _slots[j]; _slots[j].used = 0; i = j;
+         }
+         return 1;
+      }
+   private :
+      friend class iterator;
+      friend class const_iterator;
+      // Private Helper Functions
+      inline const size_t getHome(const Key& k) const {
+         // Fibonacci Hashing Spreads Weak Hash Functions (e.g. identity on integers)
+         return (size_t)((((uint64_t)_hash(k)) * 0x9E3779B97F4A7C15ull) >> _shift); }
+      inline const size_t nextUsed(size_t i) const { while (i < _slots.size() && !_slots[i].used) ++i; return i; }
+      const size_t findIndex(const Key& k) const {
+         if (!_size) return _slots.size();
+         for (size_t i = getHome(k); _slots[i].used; i = (i + 1) & (_slots.size() - 1))
+            if (_equal(_slots[i].first, k)) return i;
+         return _slots.size();
+      }
+      void rehash(const size_t& c) {
+         assert (c && !(c & (c - 1))); assert (4 * _size <= 3 * c);
+         value_type empty; empty.used = 0;
+         typename V3Vec<value_type>::Vec slots(c, empty); _slots.swap(slots); _size = 0;
+         _shift = 64; for (size_t i = c; i > 1; i >>= 1) --_shift;
+         for (size_t i = 0; i < slots.size(); ++i) if (slots[i].used) insert(slots[i].first, slots[i].second);
+      }
+      // Private Data Members
+      typename V3Vec<value_type>::Vec  _slots;      // Entries  (Valid only if used)
+      size_t                           _size;       // Number of Entries
+      uint32_t                         _shift;      // 64 - log2(Capacity)
+      HashFcn                          _hash;
+      EqualKey                         _equal;
+};
+
+#endif
+
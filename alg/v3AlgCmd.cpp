@@ -12,16 +12,19 @@
 #include "v3Msg.h"
 #include "v3AlgCmd.h"
 #include "v3AlgSim.h"
+#include "v3AlgFraig.h"
 #include "v3ExtUtil.h"
 #include "v3NtkUtil.h"
 #include "v3StrUtil.h"
+#include "v3NtkSimplify.h"
 
 #include <iomanip>
 
 bool initAlgCmd() {
    return (
          v3CmdMgr->regCmd("SIM NTk",      3, 2, new V3SimNtkCmd   )  &&
-         v3CmdMgr->regCmd("PLOt TRace",   3, 2, new V3PlotTraceCmd)
+         v3CmdMgr->regCmd("PLOt TRace",   3, 2, new V3PlotTraceCmd)  &&
+         v3CmdMgr->regCmd("FRAig NTk",    3, 2, new V3FraigNtkCmd )
    );
 }
 
@@ -172,5 +175,48 @@ V3PlotTraceCmd::help() const {
    Msg(MSG_IFO) << setw(20) << left << "PLOt TRace: " << "Plot simulation or counterexample traces." << endl;
 }
 
+//----------------------------------------------------------------------
+// FRAig NTk
+//----------------------------------------------------------------------
+V3CmdExecStatus
+V3FraigNtkCmd::exec(const string& option) {
+   vector<string> options;
+   V3CmdExec::lexOptions(option, options);
+
+   if (options.size()) return V3CmdExec::errorOption(CMD_OPT_ILLEGAL, options[0]);
+
+   V3NtkHandler* const handler = v3Handler.getCurHandler();
+   if (handler) {
+      assert (handler->getNtk());
+      if (dynamic_cast<V3BvNtk*>(handler->getNtk()))
+         Msg(MSG_ERR) << "SAT Sweeping is only Available for AIG Networks !!" << endl;
+      else if (handler->getNtk()->getModuleSize())
+         Msg(MSG_ERR) << "SAT Sweeping can only be performed on Flattened Ntk !!" << endl;
+      else {
+         V3NtkHandler::setExternalVerbosity(); V3NtkHandler::setStrash(true);
+         // Merge Nets Proven Equivalent, Representatives always Precede their Merged Nets
+         V3NetVec orderMap, repMap; orderMap.clear(); repMap.clear();
+         dfsNtkForGeneralOrder(handler->getNtk(), orderMap, V3NetVec(), !V3NtkHandler::reduceON());
+         V3AlgFraig fraig(handler); fraig.fraig(repMap, orderMap);
+         Msg(MSG_IFO) << "SAT Sweeping : " << fraig.getMergeSize() << " Nets Merged, " << fraig.getSolveSize()
+                      << " SAT Calls, " << fraig.getCexSize() << " Counterexamples." << endl;
+         v3Handler.pushAndSetCurHandler(new V3NtkSimplify(handler, repMap));
+         V3NtkHandler::setInternalVerbosity();
+      }
+   }
+   else Msg(MSG_ERR) << "Empty Ntk !!" << endl;
+   return CMD_EXEC_DONE;
+}
+
+void
+V3FraigNtkCmd::usage(const bool& verbose) const {
+   Msg(MSG_IFO) << "Usage: FRAig NTk" << endl;
+}
+
+void
+V3FraigNtkCmd::help() const {
+   Msg(MSG_IFO) << setw(20) << left << "FRAig NTk: " << "Perform SAT Sweeping on Current Network." << endl;
+}
+
 #endif
 
@@ -13,6 +13,7 @@
 
 V3_COMMAND(V3SimNtkCmd,       CMD_TYPE_SIMULATE);
 V3_COMMAND(V3PlotTraceCmd,    CMD_TYPE_SIMULATE);
+V3_COMMAND(V3FraigNtkCmd,     CMD_TYPE_SYNTHESIS);
 
 #endif
 
@@ -0,0 +1,164 @@
+/****************************************************************************
+  FileName     [ v3AlgFraig.cpp ]
+  PackageName  [ v3/src/alg ]
+  Synopsis     [ SAT Sweeping on V3 AIG Network. ]
+  Author       [ Cheng-Yin Wu ]
+  Copyright    [ Copyright(c) 2012-2014 DVLab, GIEE, NTU, Taiwan ]
+****************************************************************************/
+
+#ifndef V3_ALG_FRAIG_C
+#define V3_ALG_FRAIG_C
+
+#include "v3NtkUtil.h"
+#include "v3AlgFraig.h"
+
+// Simulation Words per Net
+#define V3_FRAIG_RAND_WORDS   4     // Random Patterns (256-bit Signatures)
+#define V3_FRAIG_CEX_WORDS    4     // Counterexamples from the Solver
+#define V3_FRAIG_SIM_WORDS    (V3_FRAIG_RAND_WORDS + V3_FRAIG_CEX_WORDS)
+// Max Number of Simulation-Equal Representatives Proved for a Net
+#define V3_FRAIG_MAX_TRIALS   4
+
+/* -------------------------------------------------- *\
+ * Class V3AlgFraig Implementations
+\* -------------------------------------------------- */
+// Constructor and Destructor
+V3AlgFraig::V3AlgFraig(const V3NtkHandler* const handler, const V3SolverType& type)
+   : _handler(handler), _solverType(type) {
+   assert (handler); assert (handler->getNtk()); assert (!dynamic_cast<V3BvNtk*>(handler->getNtk()));
+   _solver = 0; _orderMap.clear(); _simValue.clear(); _cexLanes = 0;
+   _mergeSize = _solveSize = _cexSize = 0;
+}
+
+V3AlgFraig::~V3AlgFraig() {
+   if (_solver) delete _solver; _solver = 0; _orderMap.clear(); _simValue.clear();
+}
+
+// Main Functions
+const uint32_t
+V3AlgFraig::fraig(V3NetVec& repMap, const V3NetVec& orderMap) {
+   V3Ntk* const ntk = _handler->getNtk(); assert (ntk); assert (!ntk->getModuleSize());
+   // Initialize Representatives and Topological Order
+   repMap.clear(); repMap.reserve(ntk->getNetSize());
+   for (uint32_t i = 0; i < ntk->getNetSize(); ++i) repMap.push_back(V3NetId::makeNetId(i));
+   _orderMap.clear(); if (orderMap.size()) _orderMap = orderMap; else dfsNtkForGeneralOrder(ntk, _orderMap);
+   _cexLanes = _mergeSize = _solveSize = _cexSize = 0;
+   // Simulate Random Patterns, Counterexample Words are Computed while Sweeping
+   _simValue = V3Vec<uint64_t>::Vec(ntk->getNetSize() * V3_FRAIG_SIM_WORDS, 0);
+   for (uint32_t w = 0; w < V3_FRAIG_RAND_WORDS; ++w) simulate(w, _orderMap.size());
+   // Initialize Solver
+   if (_solver) delete _solver; _solver = allocSolver(_solverType, ntk); assert (_solver);
+   // Sweep Nets in Topological Order
+   V3HashMap<uint64_t, V3NetVec>::Hash candidates; candidates.clear(); uint32_t trials;
+   for (uint32_t i = 0; i < _orderMap.size(); ++i) {
+      const V3NetId id = _orderMap[i]; assert (!id.cp); assert (V3_MODULE != ntk->getGateType(id));
+      for (uint32_t w = V3_FRAIG_RAND_WORDS; w < V3_FRAIG_SIM_WORDS; ++w) simulateNet(id, w);
+      V3NetVec& reps = candidates[getSimKey(id)];
+      if (AIG_NODE == ntk->getGateType(id)) {
+         trials = 0;
+         for (uint32_t j = 0; j < reps.size() && trials < V3_FRAIG_MAX_TRIALS; ++j) {
+            if (!isSimEqual(id, reps[j])) continue; ++trials;
+            const V3NetId rep = (getSimPhase(id) ^ getSimPhase(reps[j])) ? ~reps[j] : reps[j];
+            if (!proveEquivalence(id, rep, i)) continue;
+            repMap[id.id] = rep; ++_mergeSize; break;
+         }
+         if (repMap[id.id] != id) continue;
+      }
+      reps.push_back(id);
+   }
+   delete _solver; _solver = 0; return _mergeSize;
+}
+
+// Private Simulation Functions
+void
+V3AlgFraig::simulate(const uint32_t& w, const uint32_t& end) {
+   assert (w < V3_FRAIG_SIM_WORDS); assert (end <= _orderMap.size());
+   for (uint32_t i = 0; i < end; ++i) simulateNet(_orderMap[i], w);
+}
+
+void
+V3AlgFraig::simulateNet(const V3NetId& id, const uint32_t& w) {
+   V3Ntk* const ntk = _handler->getNtk(); assert (ntk); assert (w < V3_FRAIG_SIM_WORDS);
+   const V3GateType type = ntk->getGateType(id);
+   uint64_t& value = _simValue[id.id * V3_FRAIG_SIM_WORDS + w];
+   if (AIG_NODE == type) {
+      const V3NetId id1 = ntk->getInputNetId(id, 0), id2 = ntk->getInputNetId(id, 1);
+      const uint64_t v1 = _simValue[id1.id * V3_FRAIG_SIM_WORDS + w], v2 = _simValue[id2.id * V3_FRAIG_SIM_WORDS + w];
+      value = (id1.cp ? ~v1 : v1) & (id2.cp ? ~v2 : v2);
+   }
+   else if (AIG_FALSE == type) value = 0;
+   else if (w < V3_FRAIG_RAND_WORDS)  // Free Variables : PI, PIO and FF
+      value = ((uint64_t)rand() << 42) ^ ((uint64_t)rand() << 21) ^ (uint64_t)rand();
+}
+
+const bool
+V3AlgFraig::isSimEqual(const V3NetId& id1, const V3NetId& id2) const {
+   const uint64_t mask = (getSimPhase(id1) ^ getSimPhase(id2)) ? ~0ul : 0ul;
+   const uint64_t* const v1 = &(_simValue[id1.id * V3_FRAIG_SIM_WORDS]);
+   const uint64_t* const v2 = &(_simValue[id2.id * V3_FRAIG_SIM_WORDS]);
+   for (uint32_t w = 0; w < V3_FRAIG_SIM_WORDS; ++w) if ((v1[w] ^ v2[w]) != mask) return false;
+   return true;
+}
+
+const uint64_t
+V3AlgFraig::getSimKey(const V3NetId& id) const {
+   // Hash Random Words Normalized to Phase 0, so Complemented Nets Share the Key
+   const uint64_t mask = getSimPhase(id) ? ~0ul : 0ul; uint64_t key = 0, word;
+   for (uint32_t w = 0; w < V3_FRAIG_RAND_WORDS; ++w) {
+      word = _simValue[id.id * V3_FRAIG_SIM_WORDS + w] ^ mask;
+      word ^= word >> 33; word *= 0xFF51AFD7ED558CCDull; word ^= word >> 33;
+      key = ((key << 7) | (key >> 57)) ^ word;
+   }
+   return key;
+}
+
+const bool
+V3AlgFraig::getSimPhase(const V3NetId& id) const {
+   assert (id.id * V3_FRAIG_SIM_WORDS < _simValue.size());
+   return _simValue[id.id * V3_FRAIG_SIM_WORDS] & 1ul;
+}
+
+// Private Proof Functions
+const bool
+V3AlgFraig::proveEquivalence(const V3NetId& id, const V3NetId& rep, const uint32_t& index) {
+   assert (_solver); assert (index < _orderMap.size()); assert (id == _orderMap[index]);
+   _solver->addBoundedVerifyData(id, 0); _solver->addBoundedVerifyData(rep, 0);
+   const size_t f1 = _solver->getFormula(id, 0), f2 = _solver->getFormula(rep, 0);
+   // Selectors for (id | rep) and (~id | ~rep), which Together Mean id != rep
+   V3SvrDataVec formula; formula.clear(); formula.reserve(2);
+   formula.push_back(f1); formula.push_back(f2);
+   const size_t s1 = _solver->setImplyUnion(formula); formula.clear();
+   formula.push_back(_solver->getNegFormula(f1)); formula.push_back(_solver->getNegFormula(f2));
+   const size_t s2 = _solver->setImplyUnion(formula); formula.clear();
+   _solver->assumeRelease(); _solver->assumeProperty(s1); _solver->assumeProperty(s2); ++_solveSize;
+   if (_solver->assump_solve()) {
+      // Simulate the Counterexample Back to Refute Other Candidates
+      const uint32_t w = recordCounterexample(); ++_cexSize;
+      if (V3NtkUD != w) simulate(w, 1 + index);
+      _solver->assertProperty(s1, true); _solver->assertProperty(s2, true); return false;
+   }
+   _solver->assertProperty(s1, true); _solver->assertProperty(s2, true);
+   // Merge the Proven Pair in the Solver
+   formula.push_back(_solver->getNegFormula(f1)); formula.push_back(f2);
+   _solver->assertImplyUnion(formula); formula.clear();
+   formula.push_back(f1); formula.push_back(_solver->getNegFormula(f2));
+   _solver->assertImplyUnion(formula); return true;
+}
+
+const uint32_t
+V3AlgFraig::recordCounterexample() {
+   // Return the Updated Counterexample Word, or V3NtkUD if All Lanes are Used
+   if ((V3_FRAIG_CEX_WORDS << 6) <= _cexLanes) return V3NtkUD;
+   V3Ntk* const ntk = _handler->getNtk(); assert (ntk);
+   const uint32_t w = V3_FRAIG_RAND_WORDS + (_cexLanes >> 6); const uint64_t bit = 1ul << (_cexLanes & 63);
+   for (uint32_t i = 0; i < _orderMap.size(); ++i) {
+      const V3NetId& id = _orderMap[i]; const V3GateType type = ntk->getGateType(id);
+      if (V3_PI != type && V3_PIO != type && V3_FF != type) continue;
+      if (!_solver->existVerifyData(id, 0)) continue;
+      if ('1' == _solver->getDataValue(id, 0)[0]) _simValue[id.id * V3_FRAIG_SIM_WORDS + w] |= bit;
+   }
+   ++_cexLanes; return w;
+}
+
+#endif
+
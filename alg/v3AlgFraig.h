@@ -0,0 +1,57 @@
+/****************************************************************************
+  FileName     [ v3AlgFraig.h ]
+  PackageName  [ v3/src/alg ]
+  Synopsis     [ SAT Sweeping on V3 AIG Network. ]
+  Author       [ Cheng-Yin Wu ]
+  Copyright    [ Copyright(c) 2012-2014 DVLab, GIEE, NTU, Taiwan ]
+****************************************************************************/
+
+#ifndef V3_ALG_FRAIG_H
+#define V3_ALG_FRAIG_H
+
+#include "v3SvrHandler.h"
+#include "v3NtkHandler.h"
+
+// class V3AlgFraig : SAT Sweeping (Functionally Reduced AIG) on V3 AIG Ntk
+// Latches are free variables, so proven equivalences hold combinationally in every state.
+// Candidates come from bit-parallel random simulation, and are proved in topological order on one
+// incremental solver. A proven pair is merged in the solver immediately, and a counterexample is
+// simulated back so that the candidates it refutes are dropped without calling the solver.
+class V3AlgFraig
+{
+   public :
+      // Constructor and Destructor
+      V3AlgFraig(const V3NtkHandler* const, const V3SolverType& = V3_SVR_MINISAT);
+      ~V3AlgFraig();
+      // Main Functions
+      // NOTE: repMap[i] is the Representative of Net i (Itself if Not Merged), which Precedes it in orderMap
+      const uint32_t fraig(V3NetVec&, const V3NetVec& = V3NetVec());
+      // Statistics Functions
+      inline const uint32_t getMergeSize() const { return _mergeSize; }
+      inline const uint32_t getSolveSize() const { return _solveSize; }
+      inline const uint32_t getCexSize() const { return _cexSize; }
+   private :
+      // Private Simulation Functions
+      void simulate(const uint32_t&, const uint32_t&);
+      void simulateNet(const V3NetId&, const uint32_t&);
+      const bool isSimEqual(const V3NetId&, const V3NetId&) const;
+      const uint64_t getSimKey(const V3NetId&) const;
+      const bool getSimPhase(const V3NetId&) const;
+      // Private Proof Functions
+      const bool proveEquivalence(const V3NetId&, const V3NetId&, const uint32_t&);
+      const uint32_t recordCounterexample();
+      // Private Data Members
+      const V3NtkHandler* const  _handler;      // Network to be Swept
+      const V3SolverType         _solverType;   // Type of the Incremental Solver
+      V3SvrBase*                 _solver;       // Incremental Solver for All Proofs
+      V3NetVec                   _orderMap;     // Topological Order of Nets
+      V3Vec<uint64_t>::Vec       _simValue;     // Random and Counterexample Words of Nets
+      uint32_t                   _cexLanes;     // Number of Recorded Counterexamples
+      // Statistics
+      uint32_t                   _mergeSize;    // Number of Merged Nets
+      uint32_t                   _solveSize;    // Number of SAT Calls
+      uint32_t                   _cexSize;      // Number of Refuted Candidates
+};
+
+#endif
+
@@ -14,6 +14,12 @@
 #include "v3StrUtil.h"
 #include "v3AlgSimulate.h"
 
+// Simulation Signature Helper Functions
+static inline const uint64_t mixSimSignature(const uint64_t& sig, uint64_t word) {
+   word ^= word >> 33; word *= 0xFF51AFD7ED558CCDull; word ^= word >> 33; word *= 0xC4CEB9FE1A85EC53ull; word ^= word >> 33;
+   return ((sig << 5) | (sig >> 59)) ^ word;
+}
+
 /* -------------------------------------------------- *\
  * Class V3AlgSimulate Implementations
 \* -------------------------------------------------- */
@@ -37,6 +43,15 @@ V3AlgSimulate::reset(const V3NetVec& targetNets) { resetSimulator(); }
 const V3BitVecX
 V3AlgSimulate::getSimValue(const V3NetId& id) const { return V3BitVecX(); }
 
+const uint64_t
+V3AlgSimulate::getSimSignature(const V3NetId& id, const uint64_t& mask) const {
+   const V3BitVecX value = getSimValue(id); const uint32_t w = (value.size() + 63) >> 6;
+   V3Vec<uint64_t>::Vec zeros(w, 0), ones(w, 0); value.storeWords(&(zeros[0]), &(ones[0]));
+   uint64_t sig = value.size();
+   for (uint32_t i = 0; i < w; ++i) sig = mixSimSignature(mixSimSignature(sig, zeros[i]), ones[i]);
+   return sig;
+}
+
 // Simulation Setting Functions
 void
 V3AlgSimulate::updateNextStateValue() {}
@@ -144,6 +159,14 @@ V3AlgAigSimulate::getSimValue(const V3NetId& id) const {
    assert (id.id < _simValue.size()); return id.cp ? ~_simValue[id.id] : _simValue[id.id];
 }
 
+const uint64_t
+V3AlgAigSimulate::getSimSignature(const V3NetId& id, const uint64_t& mask) const {
+   assert (id.id < _simValue.size()); const V3BitVecS& value = _simValue[id.id];
+   const uint64_t zeros = mask & (id.cp ? value.getOnes() : value.getZeros());
+   const uint64_t ones  = mask & (id.cp ? value.getZeros() : value.getOnes());
+   return mixSimSignature(mixSimSignature(64, zeros), ones);
+}
+
 // Simulation Setting Functions
 void
 V3AlgAigSimulate::updateNextStateValue() {
@@ -612,5 +635,384 @@ V3AlgBvSimulate::simulateGate(const V3NetId& id) {
    }
 }
 
-#endif
+/* -------------------------------------------------- *\
+ * Class V3AlgBvFlatSimulate Implementations
+\* -------------------------------------------------- */
+// Helper Functions for Flat Simulation
+static inline const uint64_t getFlatMask(const uint32_t& width) {
+   return (width & 63) ? ((1ul << (width & 63)) - 1) : ~0ul;
+}
+
+static inline const uint32_t getFlatInputSize(const V3GateType& type) {
+   return isV3PairType(type) ? 2 : (BV_MUX == type) ? 3 : 1;
+}
+
+static inline void getFlatPlanes(const V3Vec<uint64_t>::Vec& slab, const uint32_t& offset, const uint32_t& width, 
+                                 const bool& cp, const uint64_t*& zeros, const uint64_t*& ones) {
+   const uint64_t* const p = &(slab[offset]); const uint32_t w = (width + 63) >> 6;
+   if (cp) { zeros = p + w; ones = p; } else { zeros = p; ones = p + w; }
+}
+
+// Get 64 Bits Starting from Bit pos of d with w Words
+static inline const uint64_t getFlatWord(const uint64_t* const d, const uint32_t& w, const uint32_t& pos) {
+   const uint32_t i = pos >> 6, off = pos & 63; if (i >= w) return 0;
+   return (off && (1 + i) < w) ? ((d[i] >> off) | (d[1 + i] << (64 - off))) : (d[i] >> off);
+}
+
+// OR len Bits of s into d with w Words at Bit pos
+static inline void orFlatBits(uint64_t* const d, const uint32_t& w, const uint32_t& pos, const uint64_t* const s, const uint32_t& len) {
+   for (uint32_t k = 0, j = (len + 63) >> 6; k < j; ++k) {
+      const uint32_t i = (pos >> 6) + k, off = pos & 63; assert (i < w);
+      d[i] |= (s[k] << off); if (off && (1 + i) < w) d[1 + i] |= (s[k] >> (64 - off));
+   }
+}
+
+// Reorder orderMap[begin, end) by Level, Keeping the DFS Order within a Level
+static void levelizeFlatOrder(V3NetVec& orderMap, const uint32_t& begin, const uint32_t& end, const V3UI32Vec& levelData) {
+   uint32_t maxLevel = 0;
+   for (uint32_t i = begin; i < end; ++i) if (levelData[orderMap[i].id] > maxLevel) maxLevel = levelData[orderMap[i].id];
+   V3UI32Vec start(2 + maxLevel, 0);
+   for (uint32_t i = begin; i < end; ++i) ++start[1 + levelData[orderMap[i].id]];
+   for (uint32_t i = 1; i < start.size(); ++i) start[i] += start[i - 1];
+   V3NetVec sorted(end - begin, V3NetUD);
+   for (uint32_t i = begin; i < end; ++i) sorted[start[levelData[orderMap[i].id]]++] = orderMap[i];
+   for (uint32_t i = begin; i < end; ++i) orderMap[i] = sorted[i - begin];
+}
+
+// Constructor and Destructor
+V3AlgBvFlatSimulate::V3AlgBvFlatSimulate(const V3NtkHandler* const handler) : V3AlgSimulate(handler) {
+   assert (dynamic_cast<V3BvNtk*>(handler->getNtk())); reset();
+}
+
+V3AlgBvFlatSimulate::~V3AlgBvFlatSimulate() {
+   _slab.clear(); _dffSlab.clear(); _offset.clear(); _dffOffset.clear(); _gates.clear(); _traceData.clear();
+}
+
+// Simulation Main Functions
+void
+V3AlgBvFlatSimulate::simulate() {
+   // Perform Combinational Simulation
+   evaluate(_cycle ? _init[1] : _init[0]);
+   // Record DFF Next State Value
+   recordNextState(_cycle ? 0 : 1); ++_cycle;
+}
+
+void
+V3AlgBvFlatSimulate::reset(const V3NetVec& targetNets) {
+   // Initialize Simulation Order
+   V3BvNtk* const ntk = dynamic_cast<V3BvNtk*>(_handler->getNtk()); assert (ntk); resetSimulator(); _targets = targetNets;
+   _init[0] = ntk->getConstSize() + ntk->getInputSize() + ntk->getInoutSize() + ntk->getLatchSize();
+   _init[1] = dfsNtkForSimulationOrder(_handler->getNtk(), _orderMap, _targets); assert (_init[1] >= _init[0]);
+   // Levelize Initial State Logics and the Remaining Logics Separately
+   V3UI32Vec levelData(ntk->getNetSize(), 0); uint32_t i, j;
+   for (i = _init[0]; i < _orderMap.size(); ++i) {
+      const V3GateType type = ntk->getGateType(_orderMap[i]); uint32_t& level = levelData[_orderMap[i].id];
+      for (j = 0; j < getFlatInputSize(type); ++j)
+         if (level <= levelData[ntk->getInputNetId(_orderMap[i], j).id]) level = 1 + levelData[ntk->getInputNetId(_orderMap[i], j).id];
+   }
+   levelizeFlatOrder(_orderMap, _init[0], _init[1], levelData);
+   levelizeFlatOrder(_orderMap, _init[1], _orderMap.size(), levelData);
+   // Allocate the Value Slab in Evaluation Order, then for Nets Out of the Order
+   _offset = V3UI32Vec(ntk->getNetSize(), V3NtkUD); uint32_t slabSize = 0;
+   for (i = 0; i < _orderMap.size(); ++i) {
+      assert (V3NtkUD == _offset[_orderMap[i].id]); _offset[_orderMap[i].id] = slabSize;
+      slabSize += (getWords(ntk->getNetWidth(_orderMap[i])) << 1);
+   }
+   for (i = 0; i < ntk->getNetSize(); ++i) {
+      if (V3NtkUD != _offset[i]) continue; _offset[i] = slabSize;
+      slabSize += (getWords(ntk->getNetWidth(V3NetId::makeNetId(i))) << 1);
+   }
+   _slab = V3Vec<uint64_t>::Vec(slabSize, 0);
+   // Initialize Constant Values
+   for (i = 0; i < ntk->getConstSize(); ++i) {
+      assert (_orderMap[i].id == ntk->getConst(i).id); const V3NetId id = V3NetId::makeNetId(ntk->getConst(i).id);
+      const uint32_t w = getWords(ntk->getNetWidth(id));
+      ntk->getInputConstValue(id).storeWords(&(_slab[_offset[id.id]]), &(_slab[_offset[id.id] + w]));
+   }
+   // Compile Gates
+   _gates.clear(); _gates.reserve(_orderMap.size() - _init[0]);
+   for (i = _init[0]; i < _orderMap.size(); ++i) {
+      V3BvFlatGate gate; gate.type = ntk->getGateType(_orderMap[i]); assert (AIG_FALSE < gate.type && BV_CONST != gate.type);
+      gate.width = ntk->getNetWidth(_orderMap[i]); gate.out = _offset[_orderMap[i].id]; gate.msb = gate.lsb = 0;
+      for (j = 0; j < 3; ++j) { gate.in[j] = 0; gate.inWidth[j] = 0; gate.cp[j] = false; }
+      for (j = 0; j < getFlatInputSize(gate.type); ++j) {
+         const V3NetId id = ntk->getInputNetId(_orderMap[i], j); gate.in[j] = _offset[id.id];
+         gate.inWidth[j] = ntk->getNetWidth(id); gate.cp[j] = id.cp;
+      }
+      if (BV_SLICE == gate.type) {
+         gate.msb = ntk->getInputSliceBit(_orderMap[i], true); gate.lsb = ntk->getInputSliceBit(_orderMap[i], false); }
+      _gates.push_back(gate);
+   }
+   // Allocate Next State Values
+   _dffOffset = V3UI32Vec(ntk->getLatchSize(), 0); slabSize = 0;
+   for (i = 0; i < ntk->getLatchSize(); ++i) {
+      _dffOffset[i] = slabSize; slabSize += (getWords(ntk->getNetWidth(ntk->getLatch(i))) << 1); }
+   _dffSlab = V3Vec<uint64_t>::Vec(slabSize, 0); _traceData.clear(); _cycle = 0;
+   // Initial Simulation : PI, PIO, DFF = X
+   setSourceFree(V3_PI, false); setSourceFree(V3_PIO, false); setSourceFree(V3_FF, false); simulate();
+}
+
+// Simulation Data Functions
+const V3BitVecX
+V3AlgBvFlatSimulate::getSimValue(const V3NetId& id) const {
+   assert (id.id < _offset.size()); V3BitVecX value(_handler->getNtk()->getNetWidth(id));
+   getSimView(id).copy(value); return value;
+}
+
+const V3BvSimView
+V3AlgBvFlatSimulate::getSimView(const V3NetId& id) const {
+   assert (id.id < _offset.size()); const uint32_t width = _handler->getNtk()->getNetWidth(id);
+   const uint64_t* zeros = 0; const uint64_t* ones = 0; getFlatPlanes(_slab, _offset[id.id], width, id.cp, zeros, ones);
+   return V3BvSimView(zeros, ones, width);
+}
+
+const uint64_t
+V3AlgBvFlatSimulate::getSimSignature(const V3NetId& id, const uint64_t& mask) const {
+   const V3BvSimView value = getSimView(id); uint64_t sig = value.size();
+   for (uint32_t i = 0, w = getWords(value.size()); i < w; ++i)
+      sig = mixSimSignature(mixSimSignature(sig, value.getZeros(i)), value.getOnes(i));
+   return sig;
+}
+
+// Simulation Setting Functions
+void
+V3AlgBvFlatSimulate::updateNextStateValue() {
+   V3Ntk* const ntk = _handler->getNtk(); assert (ntk);
+   for (uint32_t i = 0; i < ntk->getLatchSize(); ++i) {
+      const uint32_t s = getWords(ntk->getNetWidth(ntk->getLatch(i))) << 1;
+      for (uint32_t j = 0; j < s; ++j) _slab[_offset[ntk->getLatch(i).id] + j] = _dffSlab[_dffOffset[i] + j];
+   }
+}
 
+void
+V3AlgBvFlatSimulate::setSource(const V3NetId& id, const V3BitVecX& value) {
+   assert (id.id < _offset.size()); assert (_handler->getNtk()->getNetWidth(id) == value.size());
+   uint64_t* const p = &(_slab[_offset[id.id]]); const uint32_t w = getWords(value.size());
+   if (id.cp) value.storeWords(p + w, p); else value.storeWords(p, p + w);
+}
+
+void
+V3AlgBvFlatSimulate::setSourceFree(const V3GateType& type, const bool& random) {
+   V3Ntk* const ntk = _handler->getNtk(); assert (ntk);
+   assert (V3_PI == type || V3_PIO == type || V3_FF == type);
+   if (V3_PI == type) for (uint32_t i = 0; i < ntk->getInputSize(); ++i) clearValue(ntk->getInput(i), random);
+   else if (V3_FF == type) for (uint32_t i = 0; i < ntk->getLatchSize(); ++i) clearValue(ntk->getLatch(i), random);
+   else for (uint32_t i = 0; i < ntk->getInoutSize(); ++i) clearValue(ntk->getInout(i), random);
+}
+
+void
+V3AlgBvFlatSimulate::clearSource(const V3NetId& id, const bool& random) {
+   assert (id.id < _offset.size()); clearValue(id, random);
+}
+
+// Simulation with Event-Driven Functions
+void
+V3AlgBvFlatSimulate::updateNextStateEvent() {
+   assert (_cycle); recordNextState((_cycle > 1) ? 0 : 1);
+   updateNextStateValue(); evaluate(_init[0]); ++_cycle;
+}
+
+void
+V3AlgBvFlatSimulate::setSourceEvent(const V3NetId& id, const V3BitVecX& value) {
+   setSource(id, value); evaluate(_init[0]);
+}
+
+void
+V3AlgBvFlatSimulate::setSourceFreeEvent(const V3GateType& type, const bool& random) {
+   setSourceFree(type, random); evaluate(_init[0]);
+}
+
+// Simulation Record Functions
+void
+V3AlgBvFlatSimulate::recordSimValue() {
+   V3Ntk* const ntk = _handler->getNtk(); assert (ntk);
+   V3BvSimDataVec trace; trace.reserve(ntk->getInputSize());
+   for (uint32_t i = 0; i < ntk->getInputSize(); ++i) trace.push_back(getSimValue(ntk->getInput(i)));
+   assert (ntk->getInputSize() == trace.size()); _traceData.push_back(trace);
+}
+
+void
+V3AlgBvFlatSimulate::getSimRecordData(uint32_t cycle, V3SimTrace& traceData) const {
+   assert (cycle < _traceData.size()); assert (_handler->getNtk()->getInputSize() == _traceData[cycle].size());
+   traceData = _traceData[cycle];
+}
+
+// Simulation Output Functions
+void
+V3AlgBvFlatSimulate::printResult() const {
+   V3BvNtk* const ntk = dynamic_cast<V3BvNtk*>(_handler->getNtk()); assert (ntk);
+   V3GateType type;
+   for (uint32_t i = 0; i < _orderMap.size(); ++i) {
+      type = ntk->getGateType(_orderMap[i]);
+      Msg(MSG_DBG) << "Order [" << i << "] = " << _orderMap[i].id << ", value = " << getSimValue(_orderMap[i])
+                   << ", type = " << V3GateTypeStr[type];
+      if (isV3PairType(type))
+         Msg(MSG_DBG) << ", Inputs = (" << ntk->getInputNetId(_orderMap[i], 0).id << ", " 
+                      << ntk->getInputNetId(_orderMap[i], 1).id << ")" << endl;
+      else if (isV3ReducedType(type))
+         Msg(MSG_DBG) << ", Inputs = (" << ntk->getInputNetId(_orderMap[i], 0).id << ")" << endl;
+      else if (BV_MUX == type)
+         Msg(MSG_DBG) << ", Inputs = (" << ntk->getInputNetId(_orderMap[i], 0).id << ", " 
+                      << ntk->getInputNetId(_orderMap[i], 1).id << ", "
+                      << ntk->getInputNetId(_orderMap[i], 2).id << ")" << endl;
+      else if (BV_SLICE == type) 
+         Msg(MSG_DBG) << ", Inputs = (" << ntk->getInputNetId(_orderMap[i], 0).id << " [" 
+                      << ntk->getInputSliceBit(_orderMap[i], true) << " : "
+                      << ntk->getInputSliceBit(_orderMap[i], false) << "])" << endl;
+      else if (BV_CONST == type)
+         Msg(MSG_DBG) << ", Inputs = (" << ntk->getInputConstValue(_orderMap[i]) << ")" << endl;
+      else Msg(MSG_DBG) << endl;
+   }
+}
+
+// Private Simulation Helper Functions
+void
+V3AlgBvFlatSimulate::evaluate(const uint32_t& start) {
+   assert (start >= _init[0]);
+   for (uint32_t i = start - _init[0]; i < _gates.size(); ++i) simulateGate(_gates[i]);
+}
+
+void
+V3AlgBvFlatSimulate::simulateGate(const V3BvFlatGate& g) {
+   const uint32_t w = getWords(g.width), wa = getWords(g.inWidth[0]), wb = getWords(g.inWidth[1]);
+   const uint64_t mask = getFlatMask(g.width);
+   uint64_t* const z0 = &(_slab[g.out]); uint64_t* const z1 = z0 + w;
+   const uint64_t* a0 = 0; const uint64_t* a1 = 0; const uint64_t* b0 = 0; const uint64_t* b1 = 0;
+   getFlatPlanes(_slab, g.in[0], g.inWidth[0], g.cp[0], a0, a1);
+   if (g.inWidth[1]) getFlatPlanes(_slab, g.in[1], g.inWidth[1], g.cp[1], b0, b1);
+   uint32_t i;
+   switch (g.type) {
+      case BV_AND : 
+         for (i = 0; i < w; ++i) { z0[i] = a0[i] | b0[i]; z1[i] = a1[i] & b1[i]; }
+         return;
+      case BV_XOR : 
+         for (i = 0; i < w; ++i) {
+            z0[i] = (a0[i] & b0[i]) | (a1[i] & b1[i]); z1[i] = (a0[i] & b1[i]) | (a1[i] & b0[i]); }
+         return;
+      case BV_ADD : case BV_SUB : case BV_MULT : case BV_DIV : case BV_MODULO : 
+         // Native Arithmetic for Fully-known Single Words
+         if (1 == w && mask == (a0[0] | a1[0]) && mask == (b0[0] | b1[0])) {
+            const uint64_t a = a1[0], b = b1[0]; uint64_t r;
+            if (BV_ADD == g.type) r = a + b; else if (BV_SUB == g.type) r = a - b; else if (BV_MULT == g.type) r = a * b;
+            else if (BV_DIV == g.type) r = b ? (a / b) : mask; else r = b ? (a % b) : a;
+            z1[0] = r & mask; z0[0] = ~r & mask; return;
+         }
+         break;
+      case BV_SHL : case BV_SHR : 
+         // Word Shifts for a Fully-known Shift Amount
+         if (1 == w && 1 == wb && getFlatMask(g.inWidth[1]) == (b0[0] | b1[0])) {
+            uint32_t shift = 0;
+            for (uint64_t b = b1[0]; b; b &= (b - 1)) {
+               const uint32_t k = __builtin_ctzl(b);
+               if (k >= 32 || g.width <= (1u << k)) { shift = g.width; break; } else shift += (1u << k);
+            }
+            if (shift >= g.width) { z0[0] = mask; z1[0] = 0; }
+            else if (BV_SHL == g.type) {
+               z0[0] = ((a0[0] << shift) | ((1ul << shift) - 1)) & mask; z1[0] = (a1[0] << shift) & mask; }
+            else { z0[0] = (a0[0] >> shift) | (mask & ~(mask >> shift)); z1[0] = a1[0] >> shift; }
+            return;
+         }
+         break;
+      case BV_EQUALITY : case BV_GEQ : 
+         if (1 == wa && getFlatMask(g.inWidth[0]) == (a0[0] | a1[0]) && getFlatMask(g.inWidth[1]) == (b0[0] | b1[0])) {
+            const bool r = (BV_EQUALITY == g.type) ? (a1[0] == b1[0]) : (a1[0] >= b1[0]);
+            z0[0] = r ? 0 : 1; z1[0] = r ? 1 : 0; return;
+         }
+         break;
+      case BV_RED_AND : case BV_RED_OR : case BV_RED_XOR : {
+         bool exist0 = false, exist1 = false, existX = false, parity = false;
+         for (i = 0; i < wa; ++i) {
+            const uint64_t m = ((1 + i) < wa) ? ~0ul : getFlatMask(g.inWidth[0]);
+            if (a0[i]) exist0 = true; if (a1[i]) exist1 = true; if ((a0[i] | a1[i]) != m) existX = true;
+            parity ^= (__builtin_popcountl(a1[i]) & 1);
+         }
+         char r;
+         if (BV_RED_AND == g.type) r = exist0 ? '0' : existX ? 'X' : '1';
+         else if (BV_RED_OR == g.type) r = exist1 ? '1' : existX ? 'X' : '0';
+         else r = existX ? 'X' : parity ? '1' : '0';
+         z0[0] = ('0' == r) ? 1 : 0; z1[0] = ('1' == r) ? 1 : 0; return;
+      }
+      case BV_MUX : {
+         // bv_select : Input 2 Selects Input 1 (True) or Input 0 (False)
+         const uint64_t* s0 = 0; const uint64_t* s1 = 0; assert (1 == g.inWidth[2]);
+         getFlatPlanes(_slab, g.in[2], g.inWidth[2], g.cp[2], s0, s1);
+         if (1ul & s1[0]) for (i = 0; i < w; ++i) { z0[i] = b0[i]; z1[i] = b1[i]; }
+         else if (1ul & s0[0]) for (i = 0; i < w; ++i) { z0[i] = a0[i]; z1[i] = a1[i]; }
+         else for (i = 0; i < w; ++i) { z0[i] = a0[i] & b0[i]; z1[i] = a1[i] & b1[i]; }
+         return;
+      }
+      case BV_SLICE : 
+         if (g.width == g.inWidth[0]) for (i = 0; i < w; ++i) { z0[i] = a0[i]; z1[i] = a1[i]; }
+         else if (g.msb >= g.lsb)
+            for (i = 0; i < w; ++i) {
+               const uint64_t m = ((1 + i) < w) ? ~0ul : mask;
+               z0[i] = getFlatWord(a0, wa, g.lsb + (i << 6)) & m; z1[i] = getFlatWord(a1, wa, g.lsb + (i << 6)) & m;
+            }
+         else {
+            for (i = 0; i < w; ++i) z0[i] = z1[i] = 0;
+            for (i = 0; i < g.width; ++i) {
+               const uint32_t k = g.lsb - i;
+               if ((a0[k >> 6] >> (k & 63)) & 1ul) z0[i >> 6] |= (1ul << (i & 63));
+               else if ((a1[k >> 6] >> (k & 63)) & 1ul) z1[i >> 6] |= (1ul << (i & 63));
+            }
+         }
+         return;
+      case BV_MERGE : 
+         // bv_concat : Input 0 in MSBs and Input 1 in LSBs
+         for (i = 0; i < w; ++i) z0[i] = z1[i] = 0;
+         orFlatBits(z0, w, 0, b0, g.inWidth[1]); orFlatBits(z0, w, g.inWidth[1], a0, g.inWidth[0]);
+         orFlatBits(z1, w, 0, b1, g.inWidth[1]); orFlatBits(z1, w, g.inWidth[1], a1, g.inWidth[0]);
+         return;
+      default : assert (0);
+   }
+   simulateGateByBitVec(g);
+}
+
+void
+V3AlgBvFlatSimulate::simulateGateByBitVec(const V3BvFlatGate& g) {
+   assert (isV3PairType(g.type));
+   for (uint32_t i = 0; i < 2; ++i) {
+      const uint64_t* zeros = 0; const uint64_t* ones = 0;
+      getFlatPlanes(_slab, g.in[i], g.inWidth[i], g.cp[i], zeros, ones);
+      V3BvSimView(zeros, ones, g.inWidth[i]).copy(_scratch[i]);
+   }
+   V3BitVecX& value1 = _scratch[0]; const V3BitVecX& value2 = _scratch[1];
+   uint64_t* const z0 = &(_slab[g.out]); uint64_t* const z1 = z0 + getWords(g.width);
+   switch (g.type) {
+      case BV_ADD  : value1  += value2; break;
+      case BV_SUB  : value1  -= value2; break;
+      case BV_SHL  : value1 <<= value2; break;
+      case BV_SHR  : value1 >>= value2; break;
+      case BV_MULT : value1  *= value2; break;
+      case BV_DIV  : value1  /= value2; break;
+      case BV_MODULO : value1 %= value2; break;
+      case BV_EQUALITY : value1.bv_equal(value2).storeWords(z0, z1); return;
+      case BV_GEQ  : value1.bv_geq(value2).storeWords(z0, z1); return;
+      default      : assert (0);
+   }
+   assert (value1.size() == g.width); value1.storeWords(z0, z1);
+}
+
+void
+V3AlgBvFlatSimulate::recordNextState(const uint32_t& index) {
+   V3Ntk* const ntk = _handler->getNtk(); assert (ntk);
+   for (uint32_t i = 0; i < ntk->getLatchSize(); ++i) {
+      const V3NetId id = ntk->getInputNetId(ntk->getLatch(i), index);
+      const uint32_t width = ntk->getNetWidth(id), w = getWords(width);
+      const uint64_t* zeros = 0; const uint64_t* ones = 0; getFlatPlanes(_slab, _offset[id.id], width, id.cp, zeros, ones);
+      for (uint32_t j = 0; j < w; ++j) { _dffSlab[_dffOffset[i] + j] = zeros[j]; _dffSlab[_dffOffset[i] + w + j] = ones[j]; }
+   }
+}
+
+void
+V3AlgBvFlatSimulate::clearValue(const V3NetId& id, const bool& random) {
+   const uint32_t width = _handler->getNtk()->getNetWidth(id), w = getWords(width);
+   uint64_t* const p = &(_slab[_offset[id.id]]);
+   for (uint32_t i = 0; i < w; ++i) {
+      const uint64_t m = ((1 + i) < w) ? ~0ul : getFlatMask(width);
+      if (!random) p[i] = p[w + i] = 0;
+      else { p[i] = (((uint64_t)rand() << 42) ^ ((uint64_t)rand() << 21) ^ (uint64_t)rand()) & m; p[w + i] = ~p[i] & m; }
+   }
+}
+
+#endif
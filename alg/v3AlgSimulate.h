@@ -26,6 +26,8 @@ class V3AlgSimulate
       virtual void reset(const V3NetVec& = V3NetVec());
       // Simulation Data Functions
       virtual const V3BitVecX getSimValue(const V3NetId&) const;
+      // NOTE: The Lane Mask only Applies to Bit-parallel (AIG) Simulation
+      virtual const uint64_t getSimSignature(const V3NetId&, const uint64_t& = ~0ul) const;
       // Simulation Setting Functions
       virtual void updateNextStateValue();
       virtual void setSource(const V3NetId&, const V3BitVecX&);
@@ -70,6 +72,7 @@ class V3AlgAigSimulate : public V3AlgSimulate
       void reset(const V3NetVec& = V3NetVec());
       // Simulation Data Functions
       const V3BitVecX getSimValue(const V3NetId&) const;
+      const uint64_t getSimSignature(const V3NetId&, const uint64_t& = ~0ul) const;
       // Simulation Setting Functions
       void updateNextStateValue();
       void setSource(const V3NetId&, const V3BitVecX&);
@@ -134,5 +137,83 @@ class V3AlgBvSimulate : public V3AlgSimulate
       V3BvSimRecordVec  _simRecord;    // Simulation Value Record
 };
 
+// class V3BvSimView : Read-only View of a Net Value in V3AlgBvFlatSimulate (Valid until the Next reset)
+class V3BvSimView
+{
+   public : 
+      V3BvSimView(const uint64_t* const z = 0, const uint64_t* const o = 0, const uint32_t& s = 0)
+         : _zeros(z), _ones(o), _size(s) {}
+      inline const uint32_t size() const { return _size; }
+      inline const char operator[] (const uint32_t& i) const {
+         assert (i < _size); return ((_zeros[i >> 6] >> (i & 63)) & 1ul) ? '0' : ((_ones[i >> 6] >> (i & 63)) & 1ul) ? '1' : 'X'; }
+      inline const uint64_t getZeros(const uint32_t& i) const { assert (i < ((_size + 63) >> 6)); return _zeros[i]; }
+      inline const uint64_t getOnes (const uint32_t& i) const { assert (i < ((_size + 63) >> 6)); return _ones[i]; }
+      inline void copy(V3BitVecX& v) const { if (v.size() != _size) v.resize(_size, false); v.loadWords(_zeros, _ones); }
+   private : 
+      const uint64_t*   _zeros;
+      const uint64_t*   _ones;
+      uint32_t          _size;
+};
+
+// Compiled BV Gate for V3AlgBvFlatSimulate
+struct V3BvFlatGate {
+   V3GateType  type;
+   uint32_t    width;         // Output Width
+   uint32_t    out;           // Slab Offset of Output
+   uint32_t    in[3];         // Slab Offsets of Inputs
+   uint32_t    inWidth[3];    // Widths of Inputs
+   bool        cp[3];         // Inversion of Inputs
+   uint32_t    msb, lsb;      // Slice Bits for BV_SLICE
+};
+typedef V3Vec<V3BvFlatGate>::Vec V3BvFlatGateVec;
+
+// class V3AlgBvFlatSimulate : V3 BV Ntk Simulation on a Flat Value Slab
+// Values of all nets are stored in one contiguous array of 64-bit words, laid out in levelized
+// evaluation order.  Each net occupies its zero plane followed by its one plane (as V3BitVecX).
+class V3AlgBvFlatSimulate : public V3AlgSimulate
+{
+   public : 
+      // Constructor and Destructor
+      V3AlgBvFlatSimulate(const V3NtkHandler* const);
+      virtual ~V3AlgBvFlatSimulate();
+      // Simulation Main Functions
+      void simulate();
+      void reset(const V3NetVec& = V3NetVec());
+      // Simulation Data Functions
+      const V3BitVecX getSimValue(const V3NetId&) const;
+      const V3BvSimView getSimView(const V3NetId&) const;
+      const uint64_t getSimSignature(const V3NetId&, const uint64_t& = ~0ul) const;
+      // Simulation Setting Functions
+      void updateNextStateValue();
+      void setSource(const V3NetId&, const V3BitVecX&);
+      void setSourceFree(const V3GateType&, const bool&);
+      void clearSource(const V3NetId&, const bool&);
+      // Simulation with Event-Driven Functions  (Re-evaluate the Levelized Order)
+      void updateNextStateEvent();
+      void setSourceEvent(const V3NetId&, const V3BitVecX&);
+      void setSourceFreeEvent(const V3GateType&, const bool&);
+      // Simulation Record Functions
+      void recordSimValue();
+      void getSimRecordData(uint32_t, V3SimTrace&) const;
+      // Simulation Output Functions
+      void printResult() const;
+   protected : 
+      // Private Simulation Helper Functions
+      void evaluate(const uint32_t&);
+      void simulateGate(const V3BvFlatGate&);
+      void simulateGateByBitVec(const V3BvFlatGate&);
+      void recordNextState(const uint32_t&);
+      void clearValue(const V3NetId&, const bool&);
+      inline const uint32_t getWords(const uint32_t& w) const { return (w + 63) >> 6; }
+      // Private Data Members
+      V3Vec<uint64_t>::Vec _slab;     // Simulation Values for Ntk
+      V3Vec<uint64_t>::Vec _dffSlab;  // Next State Simulation Values
+      V3UI32Vec         _offset;       // Slab Offset of Each Net
+      V3UI32Vec         _dffOffset;    // Offset of Each Latch in _dffSlab
+      V3BvFlatGateVec   _gates;        // Compiled Gates in Levelized Order
+      V3BitVecX         _scratch[3];   // Operands for Gates with Don't Cares
+      V3BvSimTraceVec   _traceData;    // Simulation Input Sequence
+};
+
 #endif
 
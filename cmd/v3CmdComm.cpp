@@ -14,12 +14,15 @@
 #include "v3Msg.h"
 #include "v3CmdComm.h"
 
+#include <sstream>
+
 bool initCommonCmd() {
    return (
          v3CmdMgr->regCmd("DOfile",       2,    new V3DofileCmd   ) &&
          v3CmdMgr->regCmd("HELp",         3,    new V3HelpCmd     ) &&
          v3CmdMgr->regCmd("HIStory",      3,    new V3HistoryCmd  ) &&
          v3CmdMgr->regCmd("USAGE",        5,    new V3UsageCmd    ) &&
+         v3CmdMgr->regCmd("STATistics",   4,    new V3StatCmd     ) &&
          v3CmdMgr->regCmd("Quit",         1,    new V3QuitCmd     ) &&
          v3CmdMgr->regCmd("SET LOgfile",  3, 2, new V3LogFileCmd  )
    );
@@ -27,6 +30,7 @@ bool initCommonCmd() {
 
 // Global Variables
 extern V3Usage    v3Usage;
+extern V3StatDB   v3StatDB;
 
 //----------------------------------------------------------------------
 // HELp [<(string cmd) [-Verbose]> | -Revealed]
@@ -234,6 +238,68 @@ V3UsageCmd::help() const {
    Msg(MSG_IFO) << setw(20) << left << "USAGE: " << "Report resource usage." << endl;
 }
 
+//----------------------------------------------------------------------
+// STATistics [| -Json | -Csv] [(string fileName)] [-RESET]
+//----------------------------------------------------------------------
+V3CmdExecStatus
+V3StatCmd::exec(const string& option) {
+   vector<string> options;
+   V3CmdExec::lexOptions(option, options);
+
+   bool json = false, csv = false, reset = false;
+   string fileName = "";
+
+   size_t n = options.size();
+   for (size_t i = 0; i < n; ++i) {
+      const string& token = options[i];
+      if (v3StrNCmp("-Json", token, 2) == 0) {
+         if (json || csv) return V3CmdExec::errorOption(CMD_OPT_EXTRA, token);
+         else json = true;
+      }
+      else if (v3StrNCmp("-Csv", token, 2) == 0) {
+         if (json || csv) return V3CmdExec::errorOption(CMD_OPT_EXTRA, token);
+         else csv = true;
+      }
+      else if (v3StrNCmp("-RESET", token, 6) == 0) {
+         if (reset) return V3CmdExec::errorOption(CMD_OPT_EXTRA, token);
+         else reset = true;
+      }
+      else if (fileName == "") fileName = token;
+      else return V3CmdExec::errorOption(CMD_OPT_EXTRA, token);
+   }
+
+   // Dump Statistics Recorded from Profiled Verification Engines
+   if (fileName.size()) {
+      ofstream output(fileName.c_str());
+      if (!output) { Msg(MSG_ERR) << "Unable to Open Output File \"" << fileName << "\" !!" << endl; return CMD_EXEC_ERROR; }
+      if (json) v3StatDB.writeJSON(output); else if (csv) v3StatDB.writeCSV(output); else v3StatDB.report(output);
+      output.close();
+   }
+   else {
+      ostringstream output;
+      if (json) v3StatDB.writeJSON(output); else if (csv) v3StatDB.writeCSV(output); else v3StatDB.report(output);
+      Msg(MSG_IFO) << output.str();
+   }
+   if (reset) v3StatDB.reset();
+   return CMD_EXEC_DONE;
+}
+
+void
+V3StatCmd::usage(const bool& verbose) const {
+   Msg(MSG_IFO) << "Usage: STATistics [| -Json | -Csv] [(string fileName)] [-RESET]" << endl;
+   if (verbose) {
+      Msg(MSG_IFO) << "Param: (string fileName): The file name for statistics output." << endl;
+      Msg(MSG_IFO) << "       -Json            : Output statistics in JSON format." << endl;
+      Msg(MSG_IFO) << "       -Csv             : Output statistics in CSV format." << endl;
+      Msg(MSG_IFO) << "       -RESET           : Clear recorded statistics after output." << endl;
+   }
+}
+
+void
+V3StatCmd::help() const {
+   Msg(MSG_IFO) << setw(20) << left << "STATistics: " << "Report profiling statistics of verification engines." << endl;
+}
+
 //----------------------------------------------------------------------
 // SET LOgfile [| -All | -Cmd | -Error | -Warning | -Info | -Debug]
 //             <(string fileName)> [| -File-only | -Both] [-APPend]
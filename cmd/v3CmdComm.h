@@ -16,6 +16,7 @@ V3_COMMAND(V3QuitCmd,      CMD_TYPE_COMMON);
 V3_COMMAND(V3HistoryCmd,   CMD_TYPE_COMMON);
 V3_COMMAND(V3DofileCmd,    CMD_TYPE_COMMON);
 V3_COMMAND(V3UsageCmd,     CMD_TYPE_COMMON);
+V3_COMMAND(V3StatCmd,      CMD_TYPE_COMMON);
 V3_COMMAND(V3LogFileCmd,   CMD_TYPE_COMMON);
 
 #endif
@@ -14,6 +14,8 @@
 #include "v3StrUtil.h"
 #include "v3NtkParser.h"
 
+#include <cctype>
+#include <climits>
 #include <fstream>
 #include <string>
 
@@ -22,35 +24,77 @@
 // Please disable this macro after a thorough regression and debugging is developed. 
 //#define V3_BTOR_DISABLE_DIV_MODULE_UNTIL_STABLE
 
-// Define
-typedef V3Vec<string>::Vec    V3BtorLexVec;
+// Ids Less than (Number of Mapped Ids + V3_BTOR_DENSE_ID_GAP) are Mapped Densely, Larger Ones Sparsely
+#define V3_BTOR_DENSE_ID_GAP 65536
 
-// Parser Helper Functions
-bool lexLineBTOR(ifstream& input, V3BtorLexVec& tokens) {
-   assert (input.is_open()); tokens.clear();
-   string buffer = "";
-   size_t i, j;
-   while (!input.eof()) {
-      getline(input, buffer); if (input.eof()) break;
-      for (i = j = 0; i < buffer.size(); ++i) {
-         if (buffer[i] == ' ' || buffer[i] == '\t') {
-            if (i > j) tokens.push_back(buffer.substr(j, i - j));
-            j = i + 1;
-         }
-         else if (buffer[i] == '\n' || buffer[i] == ';') {  // ";" is Comment Symbol in BTOR
-            if (i > j) tokens.push_back(buffer.substr(j, i - j));
-            j = i + 1; break;
-         }
+// Streaming BTOR Lexer
+// Tokens are delimited in place within a single reused line buffer, so no string is allocated per token.
+// Token pointers remain valid until the next call of nextLine().
+class V3BtorLexer {
+   public : 
+      V3BtorLexer(ifstream& input) : _input(input) { _buffer.reserve(256); _tokens.reserve(8); }
+      // Lexing Functions
+      const bool nextLine();
+      inline const uint32_t size() const { return _tokens.size(); }
+      inline const char* const operator [] (const uint32_t& i) const { assert (i < _tokens.size()); return _tokens[i]; }
+   private : 
+      ifstream&                     _input;
+      string                        _buffer;
+      V3Vec<const char*>::Vec       _tokens;
+};
+
+const bool
+V3BtorLexer::nextLine() {
+   assert (_input.is_open()); _tokens.clear();
+   while (getline(_input, _buffer)) {
+      _buffer.push_back(' ');  // Sentinel Delimiter Terminates the Last Token
+      char* c = &_buffer[0]; const char* const end = c + _buffer.size();
+      bool inToken = false;
+      for (; c != end; ++c) {
+         if (*c == ';') { *c = '\0'; break; }  // ";" is Comment Symbol in BTOR
+         else if (*c == ' ' || *c == '\t' || *c == '\r' || *c == '\n') { *c = '\0'; inToken = false; }
+         else if (!inToken) { _tokens.push_back(c); inToken = true; }
       }
-      if (i > j) tokens.push_back(buffer.substr(j));
-      if (tokens.size()) return true;
+      if (_tokens.size()) return true;
    }
    return false;
 }
 
-inline const V3NetId getBtorInput(const V3HashMap<uint32_t, V3NetId>::Hash& id2IdHash, const int& id) {
-   assert (id2IdHash.end() != id2IdHash.find((uint32_t)((id < 0) ? -id : id)));
-   return (id > 0) ? id2IdHash.find(id)->second : ~(id2IdHash.find(-id)->second);
+// Parser Helper Functions
+const bool lexIntBTOR(const char* str, int& num) {
+   // Magnitudes Larger than INT_MAX are Rejected instead of Overflowing
+   assert (str); num = 0;
+   int sign = 1; if ('-' == *str) { sign = -1; ++str; }
+   bool valid = false;
+   for (; *str; ++str) {
+      if (!isdigit(*str)) return false;
+      const int digit = int(*str - '0');
+      if (num > ((INT_MAX - digit) / 10)) return false;
+      num *= 10; num += digit; valid = true;
+   }
+   num *= sign; return valid;
+}
+
+typedef V3HashMap<uint32_t, V3NetId>::Hash   V3BtorIdHash;
+
+inline void setBtorOutput(V3NetVec& id2NetVec, V3BtorIdHash& id2NetHash, const uint32_t& id, const V3NetId& id2) {
+   // Huge Ids are Kept in the Sparse Map, so a Single Line Cannot Allocate a Table of its Size
+   if (id >= id2NetVec.size()) {
+      if ((id - id2NetVec.size()) >= V3_BTOR_DENSE_ID_GAP) { id2NetHash.insert(make_pair(id, id2)); return; }
+      id2NetVec.resize(1 + id, V3NetUD);
+   }
+   if (V3NetUD == id2NetVec[id]) id2NetVec[id] = id2;
+}
+
+inline const V3NetId getBtorInput(const V3NetVec& id2NetVec, const V3BtorIdHash& id2NetHash, const int& id) {
+   const uint32_t index = (uint32_t)((id < 0) ? -id : id);
+   V3NetId net = (index < id2NetVec.size()) ? id2NetVec[index] : V3NetUD;
+   if (V3NetUD == net && id2NetHash.size()) {
+      V3BtorIdHash::const_iterator it = id2NetHash.find(index); if (id2NetHash.end() != it) net = it->second; }
+   if (V3NetUD == net) {
+      Msg(MSG_ERR) << "Operand " << id << " refers to an undefined variable !" << endl; return V3NetUD;
+   }
+   return (id > 0) ? net : ~net;
 }
 
 // Main BTOR Parsing Function
@@ -64,17 +108,17 @@ V3NtkInput* const V3BtorParser(const char* fileName, const bool& symbol) {
    if (!btorHandler->getNtk()) { Msg(MSG_ERR) << "Create BTOR Network Failed !!" << endl; return 0; }
    V3BvNtk* const ntk = dynamic_cast<V3BvNtk*>(btorHandler->getNtk()); assert (ntk);
    // Start Parsing
-   V3HashMap<uint32_t, V3NetId>::Hash id2IdHash;
+   V3NetVec id2NetVec; id2NetVec.clear(); V3BtorIdHash id2NetHash; id2NetHash.clear();
    V3NetId outNet, inNet1, inNet2, inNet3;
-   V3BtorLexVec tokens; tokens.clear();
+   V3BtorLexer tokens(input);
    int id, width, op1, op2, op3;
    string op = "";
    bool processing = true;
    
    while (1) {
-      processing = lexLineBTOR(input, tokens); if (!processing) break; assert (tokens.size());
+      processing = tokens.nextLine(); if (!processing) break; assert (tokens.size());
       // id
-      if (!v3Str2Int(tokens[0], id) || (id <= 0)) {
+      if (!lexIntBTOR(tokens[0], id) || (id <= 0)) {
          Msg(MSG_ERR) << "Line start with non-positive-integer id \"" << tokens[0] << "\" !" << endl; break;
       }
       // op
@@ -86,13 +130,13 @@ V3NtkInput* const V3BtorParser(const char* fileName, const bool& symbol) {
       if (tokens.size() == 2) {
          Msg(MSG_ERR) << "Missing width specification for variable " << id << " !" << endl; break;
       }
-      if ((!v3Str2Int(tokens[2], width)) || (!(width > 0))) {
+      if ((!lexIntBTOR(tokens[2], width)) || (!(width > 0))) {
          Msg(MSG_ERR) << "Variable " << id << " has non-positive width \"" << tokens[2] << "\" !" << endl; break;
       }
       // Create Output Net (Excluding FF and Root)
       if (op != "next" && op != "root") {
          outNet = btorHandler->createNet(symbol ? "" : tokens[0], width);
-         if (V3NetUD == outNet) break; id2IdHash.insert(make_pair((uint32_t)id, outNet));
+         if (V3NetUD == outNet) break; setBtorOutput(id2NetVec, id2NetHash, id, outNet);
       }
       // Create Corresponding Gates
       if (op == "var") {
@@ -129,11 +173,11 @@ V3NtkInput* const V3BtorParser(const char* fileName, const bool& symbol) {
          else if (op == "ones") {  // constant -1 : id op width
             if (!createBvConstGate(ntk, outNet, v3Int2Str(width) + "'b" + string(width, '1'))) break;
          }
-         else if (!v3Str2Int(tokens[3], op1)) {
+         else if (!lexIntBTOR(tokens[3], op1)) {
             Msg(MSG_ERR) << "Variable " << id << " has non-integer operand \"" << tokens[3] << "\" !" << endl; break;
          }
          // Create Input Net for One Operand Gate
-         inNet1 = getBtorInput(id2IdHash, op1); if (V3NetUD == inNet1) break;
+         inNet1 = getBtorInput(id2NetVec, id2NetHash, op1); if (V3NetUD == inNet1) break;
          if (op == "root") { // assertion : id root width op1
             //if (width != 1) { Msg(MSG_ERR) << "Bit-width of root should be 1 !" << endl; break; }
             if (!createOutput(ntk, inNet1)) break;
@@ -189,18 +233,18 @@ V3NtkInput* const V3BtorParser(const char* fileName, const bool& symbol) {
          if (tokens.size() < 4) {
             Msg(MSG_ERR) << "Missing operand 1 for variable " << id << " (" << op << ") !" << endl; break;
          }
-         else if (!v3Str2Int(tokens[3], op1)) {
+         else if (!lexIntBTOR(tokens[3], op1)) {
             Msg(MSG_ERR) << "Variable " << id << " has non-integer operand \"" << tokens[3] << "\" !" << endl; break;
          }
          if (tokens.size() < 5) {
             Msg(MSG_ERR) << "Missing operand 2 for variable " << id << " (" << op << ") !" << endl; break;
          }
-         else if (!v3Str2Int(tokens[4], op2)) {
+         else if (!lexIntBTOR(tokens[4], op2)) {
             Msg(MSG_ERR) << "Variable " << id << " has non-integer operand \"" << tokens[4] << "\" !" << endl; break;
          }
          // Create Input Nets for Two Operand Gates
-         inNet1 = getBtorInput(id2IdHash, op1); if (V3NetUD == inNet1) break;
-         inNet2 = getBtorInput(id2IdHash, op2); if (V3NetUD == inNet2) break;
+         inNet1 = getBtorInput(id2NetVec, id2NetHash, op1); if (V3NetUD == inNet1) break;
+         inNet2 = getBtorInput(id2NetVec, id2NetHash, op2); if (V3NetUD == inNet2) break;
          // Special Operations to FF
          if (op == "next") {
             inNet3 = btorHandler->createNet("", width); if (V3NetUD == inNet3) break;
@@ -305,31 +349,31 @@ V3NtkInput* const V3BtorParser(const char* fileName, const bool& symbol) {
          if (tokens.size() < 4) {
             Msg(MSG_ERR) << "Missing operand 1 for variable " << id << " (" << op << ") !" << endl; break;
          }
-         else if (!v3Str2Int(tokens[3], op1)) {
+         else if (!lexIntBTOR(tokens[3], op1)) {
             Msg(MSG_ERR) << "Variable " << id << " has non-integer operand \"" << tokens[3] << "\" !" << endl; break;
          }
          if (tokens.size() < 5) {
             Msg(MSG_ERR) << "Missing operand 2 for variable " << id << " (" << op << ") !" << endl; break;
          }
-         else if (!v3Str2Int(tokens[4], op2)) {
+         else if (!lexIntBTOR(tokens[4], op2)) {
             Msg(MSG_ERR) << "Variable " << id << " has non-integer operand \"" << tokens[4] << "\" !" << endl; break;
          }
          if (tokens.size() < 6) {
             Msg(MSG_ERR) << "Missing operand 3 for variable " << id << " (" << op << ") !" << endl; break;
          }
-         else if (!v3Str2Int(tokens[5], op3)) {
+         else if (!lexIntBTOR(tokens[5], op3)) {
             Msg(MSG_ERR) << "Variable " << id << " has non-integer operand \"" << tokens[5] << "\" !" << endl; break;
          }
          if (op == "cond") {  // multiplexer : id cond width op_select op_true op_false
             // Create Input Nets for BV_MUX  Gates
-            inNet1 = getBtorInput(id2IdHash, op1); if (V3NetUD == inNet1) break;
-            inNet2 = getBtorInput(id2IdHash, op2); if (V3NetUD == inNet2) break;
-            inNet3 = getBtorInput(id2IdHash, op3); if (V3NetUD == inNet3) break;
+            inNet1 = getBtorInput(id2NetVec, id2NetHash, op1); if (V3NetUD == inNet1) break;
+            inNet2 = getBtorInput(id2NetVec, id2NetHash, op2); if (V3NetUD == inNet2) break;
+            inNet3 = getBtorInput(id2NetVec, id2NetHash, op3); if (V3NetUD == inNet3) break;
             if (!createBvMuxGate(ntk, outNet, inNet3, inNet2, inNet1)) break;
          }
          else if (op == "slice") {  // split : id slice width op1 op_msb op_lsb
             // Create Input Nets for BV_MUX  Gates
-            inNet1 = getBtorInput(id2IdHash, op1); if (V3NetUD == inNet1) break;
+            inNet1 = getBtorInput(id2NetVec, id2NetHash, op1); if (V3NetUD == inNet1) break;
             if (!createBvSliceGate(ntk, outNet, inNet1, op2, op3)) break;
          }
          else assert (0);
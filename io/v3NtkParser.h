@@ -19,4 +19,7 @@ V3NtkInput* const V3BtorParser(const char*, const bool& = true);
 V3NtkInput* const V3AigParser(const char*, const bool& = true);
 V3NtkInput* const V3RTLParser(const char*);
 
+// Native Snapshot Parser Main Functions
+V3NtkInput* const V3SnapshotParser(const char*);
+
 #endif
@@ -0,0 +1,371 @@
+/****************************************************************************
+  FileName     [ v3NtkSnapshot.cpp ]
+  PackageName  [ v3/src/io ]
+  Synopsis     [ Native Binary Snapshot of V3 Ntk. ]
+  Author       [ Cheng-Yin Wu ]
+  Copyright    [ Copyright(c) 2012-2014 DVLab, GIEE, NTU, Taiwan ]
+****************************************************************************/
+
+#ifndef V3_NTK_SNAPSHOT_C
+#define V3_NTK_SNAPSHOT_C
+
+#include "v3Msg.h"
+#include "v3NtkUtil.h"
+#include "v3StrUtil.h"
+#include "v3Property.h"
+#include "v3NtkParser.h"
+#include "v3NtkWriter.h"
+
+#include <cstdio>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/* -------------------------------------------------- *\
+ * Snapshot Layout (Native Endian 32-bit Words)
+ *   Header  : MAGIC0 MAGIC1 VERSION FLAGS #WORDS #POOL
+ *   Net     : #NET { TYPE [WIDTH] #IN IN* }*
+ *   Port    : #PI PI* #PO PO* #PIO PIO* #FF FF* #CONST CONST* CLK
+ *   Table   : #BVX STR* #BUS { MSB LSB }*
+ *   Name    : NTK_NAME #NET_NAME { ID STR }* #OUT_NAME { IDX STR }*
+ *   Prop    : #PROP { STR SAFE NET #INV { S E }* #INVC { S E }* #FAIR { S E }* }*
+ *   Pool    : NUL-Terminated Strings Referenced by STR Offsets
+\* -------------------------------------------------- */
+const uint32_t V3SnapshotMagic0  = 0x4e533356;  // "V3SN"
+const uint32_t V3SnapshotMagic1  = 0x00005041;  // "AP"
+const uint32_t V3SnapshotVersion = 1;
+const uint32_t V3SnapshotHeader  = 6;
+
+// Snapshot Writer Helper Functions
+const uint32_t snapshotString(string& pool, const string& s) {
+   const uint32_t offset = pool.size(); pool += s; pool += '\0'; return offset;
+}
+
+const bool snapshotConstRoundTrip(const V3BitVecX& value, const string& exp) {
+   // Parse exp without Touching the Global Constant Hash, so Debug and Release Builds Hash the Same Constants
+   V3BitVecX* const parsed = V3BvNtk::parseV3ConstBitVec(exp); assert (parsed);
+   const bool equal = (value.size() == parsed->size()) && (value.toExp() == parsed->toExp());
+   delete parsed; return equal;
+}
+
+const bool snapshotConstraint(const V3NtkHandler* const handler, V3Constraint* const c, V3UI32Vec& words) {
+   assert (c); if (!c->isPOConstr() || handler != c->getHandler()) return false;
+   words.push_back(c->getStart()); words.push_back(c->getEnd()); return true;
+}
+
+const bool snapshotProperty(const V3NtkHandler* const handler, V3Property* const p, string& pool, V3UI32Vec& words) {
+   // Only Simple Properties (AGp and AFp) over handler Itself can be Stored
+   assert (p); V3LTLFormula* const ltl = p->getLTLFormula(); assert (ltl);
+   if (!ltl->isValid() || handler != ltl->getHandler() || ltl->isLeaf(ltl->getRoot())) return false;
+   const V3LTLOpType op = ltl->getOpType(ltl->getRoot());
+   if ((V3_LTL_T_G != op && V3_LTL_T_F != op) || 1 != ltl->getBranchSize(ltl->getRoot())) return false;
+   const uint32_t leaf = ltl->getBranchIndex(ltl->getRoot(), 0);
+   if (!ltl->isValid(leaf) || !ltl->isLeaf(leaf)) return false;
+   V3Formula* const formula = ltl->getFormula(leaf); assert (formula);
+   if (handler != formula->getHandler() || !formula->isValid() || !formula->isLeaf(formula->getRoot())) return false;
+   const uint32_t start = words.size();
+   words.push_back(snapshotString(pool, ltl->getName()));
+   words.push_back(V3_LTL_T_G == op); words.push_back(V3NetType(formula->getNetId(formula->getRoot())).value);
+   words.push_back(p->getInvariantSize());
+   for (uint32_t i = 0; i < p->getInvariantSize(); ++i)
+      if (!snapshotConstraint(handler, p->getInvariant(i), words)) { words.resize(start); return false; }
+   words.push_back(p->getInvConstrSize());
+   for (uint32_t i = 0; i < p->getInvConstrSize(); ++i)
+      if (!snapshotConstraint(handler, p->getInvConstr(i), words)) { words.resize(start); return false; }
+   words.push_back(p->getFairConstrSize());
+   for (uint32_t i = 0; i < p->getFairConstrSize(); ++i)
+      if (!snapshotConstraint(handler, p->getFairConstr(i), words)) { words.resize(start); return false; }
+   return true;
+}
+
+// Snapshot Writer Main Function
+void V3SnapshotWriter(const V3NtkHandler* const handler, const char* fileName) {
+   assert (handler); assert (handler->getNtk()); assert (fileName);
+   V3Ntk* const ntk = handler->getNtk(); V3BvNtk* const bvNtk = dynamic_cast<V3BvNtk*>(ntk);
+   // Check if Module Instance Exists
+   if (ntk->getModuleSize()) {
+      Msg(MSG_ERR) << "Snapshot Incompatible Module Instance Found (" << ntk->getModuleSize() << ") !!" << endl; return;
+   }
+   V3UI32Vec words; words.reserve(V3SnapshotHeader + (5 * ntk->getNetSize())); string pool = "";
+   words.push_back(V3SnapshotMagic0); words.push_back(V3SnapshotMagic1); words.push_back(V3SnapshotVersion);
+   words.push_back(bvNtk ? 1 : 0); words.push_back(0); words.push_back(0);
+   assert (V3SnapshotHeader == words.size());
+   // Local Tables for Global V3BVXId and V3BusId
+   V3UI32Vec bvxList, busList; V3UI32Vec bvxMap, busMap;
+   // Output Nets
+   V3GateType type; uint32_t inSize;
+   words.push_back(ntk->getNetSize());
+   for (V3NetId id = V3NetId::makeNetId(0); id.id < ntk->getNetSize(); ++id.id) {
+      type = ntk->getGateType(id); words.push_back(type);
+      if (bvNtk) words.push_back(ntk->getNetWidth(id));
+      inSize = ntk->getInputNetSize(id); words.push_back(inSize);
+      for (uint32_t i = 0; i < inSize; ++i) {
+         uint32_t value = V3NetType(ntk->getInputNetId(id, i)).value;
+         if ((BV_CONST == type && 0 == i) || (BV_SLICE == type && 1 == i)) {
+            V3UI32Vec& map = (BV_CONST == type) ? bvxMap : busMap;
+            V3UI32Vec& list = (BV_CONST == type) ? bvxList : busList;
+            if (value >= map.size()) map.resize(1 + value, V3NtkUD);
+            if (V3NtkUD == map[value]) { map[value] = list.size(); list.push_back(value); }
+            value = map[value];
+         }
+         words.push_back(value);
+      }
+   }
+   // Output Ports
+   words.push_back(ntk->getInputSize());
+   for (uint32_t i = 0; i < ntk->getInputSize(); ++i) words.push_back(V3NetType(ntk->getInput(i)).value);
+   words.push_back(ntk->getOutputSize());
+   for (uint32_t i = 0; i < ntk->getOutputSize(); ++i) words.push_back(V3NetType(ntk->getOutput(i)).value);
+   words.push_back(ntk->getInoutSize());
+   for (uint32_t i = 0; i < ntk->getInoutSize(); ++i) words.push_back(V3NetType(ntk->getInout(i)).value);
+   words.push_back(ntk->getLatchSize());
+   for (uint32_t i = 0; i < ntk->getLatchSize(); ++i) words.push_back(V3NetType(ntk->getLatch(i)).value);
+   words.push_back(ntk->getConstSize());
+   for (uint32_t i = 0; i < ntk->getConstSize(); ++i) words.push_back(V3NetType(ntk->getConst(i)).value);
+   words.push_back(V3NetType(ntk->getClock()).value);
+   // Output Constant and Slice Tables
+   words.push_back(bvxList.size());
+   for (uint32_t i = 0; i < bvxList.size(); ++i) {
+      // Store the Parsable Binary Form, as toExp() is Only a Hash Key of the Packed Bits
+      assert (bvNtk); const V3BitVecX value = bvNtk->getConstValue(bvxList[i]);
+      const string exp = v3Int2Str(value.size()) + "'b" + value.regEx();
+      assert (snapshotConstRoundTrip(value, exp));  // X Bits Included
+      words.push_back(snapshotString(pool, exp));
+   }
+   words.push_back(busList.size());
+   for (uint32_t i = 0; i < busList.size(); ++i) {
+      assert (bvNtk); words.push_back(bvNtk->getSliceBit(busList[i], true));
+      words.push_back(bvNtk->getSliceBit(busList[i], false));
+   }
+   // Output Names
+   words.push_back(snapshotString(pool, handler->getNtkName()));
+   const uint32_t nameIndex = words.size(); words.push_back(0);
+   string name; V3NetId nameId; V3StrSet nameSet; nameSet.clear(); nameSet.insert("0");
+   for (V3NetId id = V3NetId::makeNetId(1); id.id < ntk->getNetSize(); ++id.id) {
+      nameId = id; name = ""; handler->getNetName(nameId, name);
+      if (!name.size() || isV3NetInverted(nameId) || !nameSet.insert(name).second) continue;
+      words.push_back(id.id); words.push_back(snapshotString(pool, name)); ++words[nameIndex];
+   }
+   const uint32_t outNameIndex = words.size(); words.push_back(0);
+   for (uint32_t i = 0; i < ntk->getOutputSize(); ++i) {
+      name = handler->getOutputName(i); if (!name.size()) continue;
+      words.push_back(i); words.push_back(snapshotString(pool, name)); ++words[outNameIndex];
+   }
+   // Output Properties
+   const V3PropertyMap& propList = handler->getPropertyList();
+   const uint32_t propIndex = words.size(); words.push_back(0);
+   for (V3PropertyMap::const_iterator it = propList.begin(); it != propList.end(); ++it) {
+      if (snapshotProperty(handler, it->second, pool, words)) ++words[propIndex];
+      else Msg(MSG_WAR) << "Property \"" << it->first << "\" is NOT a Simple Property on the Current Ntk and is Omitted !!" << endl;
+   }
+   // Finalize Header and Write File
+   words[4] = words.size(); words[5] = pool.size();
+   FILE* output = fopen(fileName, "wb");
+   if (!output) { Msg(MSG_ERR) << "Snapshot Output File \"" << fileName << "\" Not Found !!" << endl; return; }
+   const bool ok = (words.size() == fwrite(&words[0], sizeof(uint32_t), words.size(), output)) &&
+                   (pool.size() == fwrite(pool.data(), sizeof(char), pool.size(), output));
+   fclose(output);
+   if (!ok) Msg(MSG_ERR) << "Failed to Write Snapshot File \"" << fileName << "\" !!" << endl;
+}
+
+// V3SnapshotReader : Bounded Word Cursor over a Mapped Snapshot
+class V3SnapshotReader
+{
+   public :
+      // Constructor and Destructor
+      V3SnapshotReader(const uint32_t* const w, const uint32_t& n, const char* const p, const uint32_t& s)
+         : _words(w), _size(n), _pool(p), _poolSize(s) { _pos = 0; _ok = true; }
+      ~V3SnapshotReader() {}
+      // Cursor Functions
+      inline const bool isOK() const { return _ok; }
+      inline const bool isEnd() const { return _pos == _size; }
+      inline const uint32_t next() { if (_pos < _size) return _words[_pos++]; _ok = false; return 0; }
+      inline const V3NetId nextNetId(const uint32_t& netSize) {
+         const V3NetType value(next()); if (value.id.id >= netSize) _ok = false; return value.id; }
+      inline const string nextString() {
+         const uint32_t offset = next(); if (offset >= _poolSize) { _ok = false; return ""; }
+         const char* const end = (const char*)memchr(_pool + offset, '\0', _poolSize - offset);
+         if (!end) { _ok = false; return ""; } return string(_pool + offset, end - _pool - offset); }
+   private :
+      const uint32_t* const   _words;
+      const uint32_t          _size;
+      const char* const       _pool;
+      const uint32_t          _poolSize;
+      uint32_t                _pos;
+      bool                    _ok;
+};
+
+// Snapshot Parser Helper Functions
+const bool snapshotConstraintPair(V3SnapshotReader& reader, const uint32_t& outSize, uint32_t& s, uint32_t& e) {
+   s = reader.next(); e = reader.next(); return reader.isOK() && s < outSize && e < outSize;
+}
+
+const bool reportUnexpectedSnapshotFanin(const uint32_t& type, const uint32_t& inSize) {
+   // Expected Fanin Sizes are the Same as V3Ntk::reportUnexpectedFaninSize()
+   if (isV3ReducedType(type) || BV_CONST == type || V3_PIO == type) return 1 != inSize;
+   if (isV3PairType(type) || AIG_NODE == type || V3_FF == type || BV_SLICE == type) return 2 != inSize;
+   if (BV_MUX == type) return 3 != inSize;
+   return 0 != inSize;
+}
+
+V3NtkInput* const snapshotBuildNtk(V3SnapshotReader& reader, const bool& isBv, const char* fileName) {
+   // Create Network Handler
+   V3NtkInput* const inputHandler = new V3NtkInput(!isBv, fileName); assert (inputHandler);
+   V3Ntk* const ntk = inputHandler->getNtk(); assert (ntk);
+   // Read Net Types and Fanins
+   const uint32_t netSize = reader.next();
+   if (!reader.isOK() || !netSize) { delete inputHandler; return 0; }
+   V3UI32Vec typeList(netSize, V3_PI), widthList(netSize, 1);
+   V3InputTable faninList(netSize, V3InputVec());
+   for (uint32_t i = 0; i < netSize; ++i) {
+      typeList[i] = reader.next(); if (isBv) widthList[i] = reader.next();
+      const uint32_t inSize = reader.next();
+      if (!reader.isOK() || V3_XD <= typeList[i] || V3_MODULE == typeList[i] || !widthList[i] ||
+          reportUnexpectedSnapshotFanin(typeList[i], inSize)) { delete inputHandler; return 0; }
+      faninList[i].reserve(inSize);
+      for (uint32_t j = 0; j < inSize; ++j) faninList[i].push_back(V3NetType(reader.next()));
+   }
+   if (!reader.isOK() || (isBv ? BV_CONST : AIG_FALSE) != typeList[0]) { delete inputHandler; return 0; }
+   // Read Ports
+   V3NetVec portList[5]; V3NetId clk;
+   for (uint32_t p = 0; p < 5; ++p) {
+      const uint32_t size = reader.next(); if (!reader.isOK()) break; portList[p].reserve(size);
+      for (uint32_t i = 0; i < size; ++i) portList[p].push_back(reader.nextNetId(netSize));
+   }
+   clk = V3NetType(reader.next()).id;
+   // Read Constant and Slice Tables
+   V3UI32Vec bvxMap(reader.next(), 0);
+   for (uint32_t i = 0; i < bvxMap.size() && reader.isOK(); ++i) {
+      const string exp = reader.nextString(); if (reader.isOK()) bvxMap[i] = V3BvNtk::hashV3ConstBitVec(exp); }
+   V3UI32Vec busMap(reader.next(), 0);
+   for (uint32_t i = 0; i < busMap.size() && reader.isOK(); ++i) {
+      const uint32_t msb = reader.next(), lsb = reader.next(); busMap[i] = V3BvNtk::hashV3BusId(msb, lsb); }
+   if (!reader.isOK()) { delete inputHandler; return 0; }
+   // Read Net Names
+   const string ntkName = reader.nextString(); if (ntkName.size()) inputHandler->setNtkName(ntkName);
+   V3StringVec nameList(netSize, "");
+   for (uint32_t i = 0, j = reader.next(); i < j && reader.isOK(); ++i) {
+      const uint32_t index = reader.next(); const string name = reader.nextString();
+      if (index && index < netSize) nameList[index] = name;
+   }
+   if (!reader.isOK()) { delete inputHandler; return 0; }
+   // Create Nets
+   for (uint32_t i = 1; i < netSize; ++i) {
+      const V3NetId id = inputHandler->createNet(nameList[i], widthList[i]);
+      if (i != id.id) {
+         Msg(MSG_ERR) << "Inconsistent Net Name \"" << nameList[i] << "\" Found in Snapshot !!" << endl;
+         delete inputHandler; return 0;
+      }
+   }
+   // Remap Global Table Indices and Check Fanins
+   for (uint32_t i = 0; i < netSize; ++i) {
+      for (uint32_t j = 0; j < faninList[i].size(); ++j) {
+         if (BV_CONST == typeList[i] && 0 == j) {
+            if (faninList[i][j].value >= bvxMap.size()) { delete inputHandler; return 0; }
+            faninList[i][j].value = bvxMap[faninList[i][j].value];
+         }
+         else if (BV_SLICE == typeList[i] && 1 == j) {
+            if (faninList[i][j].value >= busMap.size()) { delete inputHandler; return 0; }
+            faninList[i][j].value = busMap[faninList[i][j].value];
+         }
+         else if (faninList[i][j].id.id >= netSize) { delete inputHandler; return 0; }
+      }
+   }
+   // Create Gates : Latches, Inouts and Constants First to Keep their Orders
+   V3BoolVec done(netSize, false); done[0] = true;
+   for (uint32_t i = 0; i < portList[3].size(); ++i) {
+      const V3NetId& id = portList[3][i]; if (done[id.id] || V3_FF != typeList[id.id]) { delete inputHandler; return 0; }
+      ntk->setInput(id, faninList[id.id]); ntk->createLatch(id); done[id.id] = true;
+   }
+   for (uint32_t i = 0; i < portList[2].size(); ++i) {
+      const V3NetId& id = portList[2][i]; if (done[id.id] || V3_PIO != typeList[id.id]) { delete inputHandler; return 0; }
+      ntk->setInput(id, faninList[id.id]); ntk->createInout(id); done[id.id] = true;
+   }
+   for (uint32_t i = 0; i < portList[4].size(); ++i) {
+      const V3NetId& id = portList[4][i]; if (!id.id) continue;
+      if (done[id.id] || !isV3ConstType(typeList[id.id])) { delete inputHandler; return 0; }
+      ntk->setInput(id, faninList[id.id]); ntk->createConst(id); done[id.id] = true;
+   }
+   for (V3NetId id = V3NetId::makeNetId(1); id.id < netSize; ++id.id) {
+      if (done[id.id] || V3_PI == typeList[id.id]) continue;
+      if (V3_FF == typeList[id.id] || V3_PIO == typeList[id.id] || isV3ConstType(typeList[id.id])) {
+         delete inputHandler; return 0; }
+      ntk->setInput(id, faninList[id.id]); ntk->createGate((V3GateType)typeList[id.id], id);
+   }
+   for (uint32_t i = 0; i < portList[0].size(); ++i) {
+      if (V3_PI != typeList[portList[0][i].id]) { delete inputHandler; return 0; }
+      ntk->createInput(portList[0][i]);
+   }
+   for (uint32_t i = 0; i < portList[1].size(); ++i) ntk->createOutput(portList[1][i]);
+   if (V3NetUD != clk) {
+      if (clk.id >= netSize || V3_PI != typeList[clk.id]) { delete inputHandler; return 0; }
+      ntk->createClock(clk);
+   }
+   // Read Output Names
+   for (uint32_t i = 0, j = reader.next(); i < j && reader.isOK(); ++i) {
+      const uint32_t index = reader.next(); const string name = reader.nextString();
+      if (reader.isOK() && index < ntk->getOutputSize()) inputHandler->resetOutName(index, name);
+   }
+   if (!reader.isOK()) { delete inputHandler; return 0; }
+   return inputHandler;
+}
+
+// Snapshot Parser Main Function
+V3NtkInput* const V3SnapshotParser(const char* fileName) {
+   // Map Snapshot File
+   assert (fileName); const int fd = open(fileName, O_RDONLY);
+   if (fd < 0) { Msg(MSG_ERR) << "Snapshot Input File \"" << fileName << "\" Not Found !!" << endl; return 0; }
+   struct stat st;
+   if (fstat(fd, &st) || st.st_size < (off_t)(V3SnapshotHeader * sizeof(uint32_t))) {
+      Msg(MSG_ERR) << "Snapshot Input File \"" << fileName << "\" has Incorrect Format !!" << endl; close(fd); return 0;
+   }
+   const size_t fileSize = st.st_size;
+   void* const data = mmap(0, fileSize, PROT_READ, MAP_PRIVATE, fd, 0); close(fd);
+   if (MAP_FAILED == data) { Msg(MSG_ERR) << "Failed to Map Snapshot File \"" << fileName << "\" !!" << endl; return 0; }
+   // Check Header
+   const uint32_t* const words = (const uint32_t*)data;
+   if (V3SnapshotMagic0 != words[0] || V3SnapshotMagic1 != words[1]) {
+      Msg(MSG_ERR) << "Snapshot Input File \"" << fileName << "\" has Incorrect Format !!" << endl;
+      munmap(data, fileSize); return 0;
+   }
+   if (V3SnapshotVersion != words[2]) {
+      Msg(MSG_ERR) << "Snapshot Version " << words[2] << " is NOT Supported (Expecting " << V3SnapshotVersion << ") !!" << endl;
+      munmap(data, fileSize); return 0;
+   }
+   if (words[4] < V3SnapshotHeader || fileSize != ((size_t)words[4] * sizeof(uint32_t)) + (size_t)words[5]) {
+      Msg(MSG_ERR) << "Snapshot Input File \"" << fileName << "\" is Truncated !!" << endl;
+      munmap(data, fileSize); return 0;
+   }
+   V3SnapshotReader reader(words + V3SnapshotHeader, words[4] - V3SnapshotHeader,
+                           (const char*)(words + words[4]), words[5]);
+   // Build Network
+   V3NtkInput* const inputHandler = snapshotBuildNtk(reader, words[3] & 1ul, fileName);
+   if (!inputHandler) {
+      Msg(MSG_ERR) << "Snapshot Input File \"" << fileName << "\" has Inconsistent Network Data !!" << endl;
+      munmap(data, fileSize); return 0;
+   }
+   // Read Properties
+   const uint32_t outSize = inputHandler->getNtk()->getOutputSize(); uint32_t s, e;
+   for (uint32_t p = 0, q = reader.next(); p < q && reader.isOK(); ++p) {
+      const string name = reader.nextString(); const bool safe = reader.next();
+      const V3NetId id = reader.nextNetId(inputHandler->getNtk()->getNetSize());
+      if (!reader.isOK() || !name.size() || inputHandler->existProperty(name)) break;
+      V3LTLFormula* const f = new V3LTLFormula(inputHandler, id, safe, name); assert (f);
+      V3Property* const property = new V3Property(f); assert (property); inputHandler->setProperty(property);
+      for (uint32_t i = 0, j = reader.next(); i < j && reader.isOK(); ++i)
+         if (snapshotConstraintPair(reader, outSize, s, e)) property->setInvariant(inputHandler, s, e);
+      for (uint32_t i = 0, j = reader.next(); i < j && reader.isOK(); ++i)
+         if (snapshotConstraintPair(reader, outSize, s, e)) property->setInvConstr(inputHandler, s, e);
+      for (uint32_t i = 0, j = reader.next(); i < j && reader.isOK(); ++i)
+         if (snapshotConstraintPair(reader, outSize, s, e)) property->setFairConstr(inputHandler, s, e);
+   }
+   munmap(data, fileSize);
+   if (!reader.isOK() || !reader.isEnd()) {
+      Msg(MSG_ERR) << "Snapshot Input File \"" << fileName << "\" has Inconsistent Property Data !!" << endl;
+      delete inputHandler; return 0;
+   }
+   return inputHandler;
+}
+
+#endif
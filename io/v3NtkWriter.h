@@ -33,6 +33,9 @@ void V3BtorWriter(const V3NtkHandler* const, const char*, const bool& = false);
 void V3AigWriter(const V3NtkHandler* const, const char*, const bool& = false);
 void V3RTLWriter(const V3NtkHandler* const, const char*, const bool& = true, const bool& = false);
 
+// Native Snapshot Writer Main Functions
+void V3SnapshotWriter(const V3NtkHandler* const, const char*);
+
 // Specific Writer Main Functions
 void splitAigFromProperties(const string&, const bool& = false);
 
@@ -21,6 +21,8 @@ V3MsgMgr Msg;
 
 // Global Variable for V3Usage
 V3Usage v3Usage;
+V3StatDB v3StatDB;
+V3MemAccount v3MemAccount;
 
 // Global Variable for V3CmdMgr
 V3CmdMgr* v3CmdMgr = new V3CmdMgr("v3");
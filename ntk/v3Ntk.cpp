@@ -12,6 +12,7 @@
 #include "v3NtkHandler.h"  // MODIFICATION FOR SoCV BDD
 #include "v3Ntk.h"
 #include "v3Msg.h"
+#include "v3Usage.h"
 #include "v3StrUtil.h"
 
 /* -------------------------------------------------- *\
@@ -48,6 +49,8 @@ V3Ntk::createNet(const uint32_t& width) {
    assert (_inputData.size() == _typeMisc.size());
    // Create New V3NetId
    V3NetId id = V3NetId::makeNetId(_inputData.size()); assert (!isV3NetInverted(id));
+   if (_inputData.size() == _inputData.capacity())  // Report Storage Growth on Reallocation
+      v3MemAccount.allocate((1 + _inputData.size()) * (sizeof(V3MiscType) + sizeof(V3InputVec)));
    _typeMisc.push_back(V3MiscType()); _inputData.push_back(V3InputVec());
    assert (V3_PI == _typeMisc.back().type); assert (!_typeMisc.back().misc);
    assert (!_inputData.back().size()); return id;
@@ -244,6 +247,8 @@ V3BvNtk::createNet(const uint32_t& width) {
    assert (_inputData.size() == _typeMisc.size());
    // Create New V3NetId
    V3NetId id = V3NetId::makeNetId(_inputData.size()); assert (!isV3NetInverted(id));
+   if (_inputData.size() == _inputData.capacity())  // Report Storage Growth on Reallocation
+      v3MemAccount.allocate((1 + _inputData.size()) * (sizeof(V3MiscType) + sizeof(V3InputVec)));
    _typeMisc.push_back(V3MiscType()); _inputData.push_back(V3InputVec());
    assert (V3_PI == _typeMisc.back().type); assert (!_typeMisc.back().misc);
    assert (!_inputData.back().size()); return id;
@@ -260,7 +265,7 @@ const V3BVXId
 V3BvNtk::hashV3ConstBitVec(const string& input_exp) {
    V3ConstHash::const_iterator it = _V3ConstHash.find(input_exp);
    if (it != _V3ConstHash.end()) return it->second;
-   V3BitVecX* const value = new V3BitVecX(input_exp.c_str()); assert (value);
+   V3BitVecX* const value = parseV3ConstBitVec(input_exp); assert (value);
    const string exp = v3Int2Str(value->size()) + "'" + value->toExp();
    if (input_exp != exp) {
       it = _V3ConstHash.find(exp);
@@ -271,6 +276,21 @@ V3BvNtk::hashV3ConstBitVec(const string& input_exp) {
    _V3ValueVec.push_back(value); return _V3ValueVec.size() - 1;
 }
 
+// Parse Binary Expressions with X Bits (e.g. from V3BitVecX::regEx()) Bitwise, as V3BitVec Only Parses Known Values
+V3BitVecX* const
+V3BvNtk::parseV3ConstBitVec(const string& exp) {
+   const size_t pos = exp.find('\'');
+   if (string::npos == pos || (2 + pos) > exp.size() || ('b' != exp[1 + pos] && 'B' != exp[1 + pos]) ||
+       string::npos == exp.find_first_of("xX", 2 + pos)) return new V3BitVecX(exp.c_str());
+   const unsigned size = atoi(exp.substr(0, pos).c_str()); assert (size);
+   V3BitVecX* const value = new V3BitVecX(size); assert (value);
+   for (unsigned i = 0, j = exp.size(); i < size; ++i) {
+      const char c = (j > (2 + pos)) ? exp[--j] : '0';
+      if ('1' == c) value->set1(i); else if ('x' == c || 'X' == c) value->setX(i); else value->set0(i);
+   }
+   return value;
+}
+
 const V3BusId
 V3BvNtk::hashV3BusId(const uint32_t& msb, const uint32_t& lsb) {
    const V3PairType msb_lsb(msb, lsb);
@@ -196,6 +196,7 @@ class V3BvNtk : public V3Ntk
       const uint32_t getNetWidth(const V3NetId&) const;
       // Ntk for BV Gate Functions
       static const V3BVXId hashV3ConstBitVec(const string&);
+      static V3BitVecX* const parseV3ConstBitVec(const string&);
       static const V3BusId hashV3BusId(const uint32_t&, const uint32_t&);
       const uint32_t getConstWidth(const V3BVXId&) const;
       const uint32_t getSliceWidth(const V3BusId&) const;
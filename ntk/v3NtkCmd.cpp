@@ -31,10 +31,12 @@ bool initNtkCmd() {
          v3CmdMgr->regCmd("REAd Rtl",           3, 1, new V3ReadRTLCmd        ) &&
          v3CmdMgr->regCmd("REAd Aig",           3, 1, new V3ReadAIGCmd        ) &&
          v3CmdMgr->regCmd("REAd Btor",          3, 1, new V3ReadBTORCmd       ) &&
+         v3CmdMgr->regCmd("REAd NTk",           3, 2, new V3ReadNtkCmd        ) &&
          // Network Output Commands
          v3CmdMgr->regCmd("WRIte Rtl",          3, 1, new V3WriteRTLCmd       ) &&
          v3CmdMgr->regCmd("WRIte Aig",          3, 1, new V3WriteAIGCmd       ) &&
          v3CmdMgr->regCmd("WRIte Btor",         3, 1, new V3WriteBTORCmd      ) &&
+         v3CmdMgr->regCmd("WRIte NTk",          3, 2, new V3WriteNtkCmd       ) &&
          // Network Report Commands
          v3CmdMgr->regCmd("PRInt NTk",          3, 2, new V3PrintNtkCmd       ) &&
          v3CmdMgr->regCmd("PRInt NEt",          3, 2, new V3PrintNetCmd       ) &&
@@ -212,6 +214,52 @@ V3ReadBTORCmd::help() const {
    Msg(MSG_IFO) << setw(20) << left << "REAd Btor: " << "Read BTOR Designs." << endl;
 }
 
+//----------------------------------------------------------------------
+// REAd NTk <(string fileName)> <-Snapshot>
+//----------------------------------------------------------------------
+V3CmdExecStatus
+V3ReadNtkCmd::exec(const string& option) {
+   vector<string> options;
+   V3CmdExec::lexOptions(option, options);
+   
+   bool snapshot = false;
+   string fileName = "";
+
+   size_t n = options.size();
+   for (size_t i = 0; i < n; ++i) {
+      const string& token = options[i];
+      if (v3StrNCmp("-Snapshot", token, 2) == 0) {
+         if (snapshot) return V3CmdExec::errorOption(CMD_OPT_EXTRA, token);
+         else snapshot = true;
+      }
+      else if (fileName == "") fileName = token;
+      else return V3CmdExec::errorOption(CMD_OPT_ILLEGAL, token);
+   }
+
+   if (fileName == "") return V3CmdExec::errorOption(CMD_OPT_MISSING, "<(string fileName)>");
+   if (!snapshot) return V3CmdExec::errorOption(CMD_OPT_MISSING, "<-Snapshot>");
+
+   V3NtkInput* inputHandler = V3SnapshotParser(fileName.c_str());
+   
+   if (!inputHandler) Msg(MSG_ERR) << "Parse Failed !!" << endl;
+   else v3Handler.pushAndSetCurHandler(inputHandler);
+   return CMD_EXEC_DONE;
+}
+
+void
+V3ReadNtkCmd::usage(const bool& verbose) const {
+   Msg(MSG_IFO) << "Usage: REAd NTk <(string fileName)> <-Snapshot>" << endl;
+   if (verbose) {
+      Msg(MSG_IFO) << "Param: (string fileName): The file name of the input network snapshot." << endl;
+      Msg(MSG_IFO) << "       -Snapshot        : Indicate fileName is a V3 native binary snapshot." << endl;
+   }
+}
+
+void
+V3ReadNtkCmd::help() const {
+   Msg(MSG_IFO) << setw(20) << left << "REAd NTk: " << "Read V3 Network Snapshots." << endl;
+}
+
 //----------------------------------------------------------------------
 // WRIte Rtl <(string fileName)> [-Symbol] [-Initial]
 //----------------------------------------------------------------------
@@ -354,6 +402,51 @@ V3WriteBTORCmd::help() const {
    Msg(MSG_IFO) << setw(20) << left << "WRIte Btor: " << "Write BTOR Network." << endl;
 }
 
+//----------------------------------------------------------------------
+// WRIte NTk <(string fileName)> <-Snapshot>
+//----------------------------------------------------------------------
+V3CmdExecStatus
+V3WriteNtkCmd::exec(const string& option) {
+   vector<string> options;
+   V3CmdExec::lexOptions(option, options);
+   
+   bool snapshot = false;
+   string fileName = "";
+
+   size_t n = options.size();
+   for (size_t i = 0; i < n; ++i) {
+      const string& token = options[i];
+      if (v3StrNCmp("-Snapshot", token, 2) == 0) {
+         if (snapshot) return V3CmdExec::errorOption(CMD_OPT_EXTRA, token);
+         else snapshot = true;
+      }
+      else if (fileName == "") fileName = token;
+      else return V3CmdExec::errorOption(CMD_OPT_ILLEGAL, token);
+   }
+
+   if (fileName == "") return V3CmdExec::errorOption(CMD_OPT_MISSING, "<(string fileName)>");
+   if (!snapshot) return V3CmdExec::errorOption(CMD_OPT_MISSING, "<-Snapshot>");
+
+   V3NtkHandler* const handler = v3Handler.getCurHandler();
+   if (handler) V3SnapshotWriter(handler, fileName.c_str());
+   else Msg(MSG_ERR) << "Empty Ntk !!" << endl;
+   return CMD_EXEC_DONE;
+}
+
+void
+V3WriteNtkCmd::usage(const bool& verbose) const {
+   Msg(MSG_IFO) << "Usage: WRIte NTk <(string fileName)> <-Snapshot>" << endl;
+   if (verbose) {
+      Msg(MSG_IFO) << "Param: (string fileName): The file name for the network snapshot output." << endl;
+      Msg(MSG_IFO) << "       -Snapshot        : Output network, names and properties as a V3 native binary snapshot." << endl;
+   }
+}
+
+void
+V3WriteNtkCmd::help() const {
+   Msg(MSG_IFO) << setw(20) << left << "WRIte NTk: " << "Write V3 Network Snapshots." << endl;
+}
+
 //----------------------------------------------------------------------
 // PRInt NTk [| -Summary | -Primary | -Verbose | -Netlist | 
 //              -CombLoops | -Floating | -Unreachable]
@@ -790,21 +883,36 @@ V3RefNtkCmd::help() const {
 }
 
 //----------------------------------------------------------------------
-// STRash NTk
+// STRash NTk [-Thread <(unsigned threadNum)>]
 //----------------------------------------------------------------------
 V3CmdExecStatus
 V3StrashNtkCmd::exec(const string& option) {
    vector<string> options;
    V3CmdExec::lexOptions(option, options);
 
+   bool thread = false; int threadNum = 1;
+
    size_t n = options.size();
-   if (n) return V3CmdExec::errorOption(CMD_OPT_ILLEGAL, options[0]);
+   for (size_t i = 0; i < n; ++i) {
+      const string& token = options[i];
+      if (v3StrNCmp("-Thread", token, 2) == 0) {
+         if (thread) return V3CmdExec::errorOption(CMD_OPT_EXTRA, token);
+         else thread = true;
+         if (++i == n) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned threadNum)");
+         if (!v3Str2Int(options[i], threadNum) || threadNum <= 0) 
+            return V3CmdExec::errorOption(CMD_OPT_ILLEGAL, "(unsigned threadNum)");
+      }
+      else return V3CmdExec::errorOption(CMD_OPT_ILLEGAL, token);
+   }
 
    V3NtkHandler* const handler = v3Handler.getCurHandler();
    if (handler) {
+      if (1 < threadNum && dynamic_cast<V3BvNtk*>(handler->getNtk())) 
+         Msg(MSG_WAR) << "Parallel Structural Hashing is only Available for AIG Networks !!" << endl;
       V3NtkHandler::setExternalVerbosity(); V3NtkHandler::setStrash(true);
+      V3NtkHandler::setStrashThreads(threadNum);
       v3Handler.pushAndSetCurHandler(new V3NtkSimplify(handler));
-      V3NtkHandler::setInternalVerbosity();
+      V3NtkHandler::setStrashThreads(1); V3NtkHandler::setInternalVerbosity();
    }
    else Msg(MSG_ERR) << "Empty Ntk !!" << endl;
    return CMD_EXEC_DONE;
@@ -812,7 +920,10 @@ V3StrashNtkCmd::exec(const string& option) {
 
 void
 V3StrashNtkCmd::usage(const bool& verbose) const {
-   Msg(MSG_IFO) << "Usage: STRash NTk" << endl;
+   Msg(MSG_IFO) << "Usage: STRash NTk [-Thread <(unsigned threadNum)>]" << endl;
+   if (verbose) {
+      Msg(MSG_IFO) << "Param: (unsigned threadNum): Number of threads hashing each topological level. (Default = 1)" << endl;
+   }
 }
 
 void
@@ -859,12 +970,24 @@ V3RewriteNtkCmd::exec(const string& option) {
    vector<string> options;
    V3CmdExec::lexOptions(option, options);
 
+   bool cut = false;
+
    size_t n = options.size();
-   if (n) return V3CmdExec::errorOption(CMD_OPT_ILLEGAL, options[0]);
+   for (size_t i = 0; i < n; ++i) {
+      const string& token = options[i];
+      if (v3StrNCmp("-Cut", token, 2) == 0) {
+         if (cut) return V3CmdExec::errorOption(CMD_OPT_EXTRA, token);
+         else cut = true;
+      }
+      else return V3CmdExec::errorOption(CMD_OPT_ILLEGAL, token);
+   }
 
    V3NtkHandler* const handler = v3Handler.getCurHandler();
    if (handler) {
+      if (cut && dynamic_cast<V3BvNtk*>(handler->getNtk()))
+         Msg(MSG_WAR) << "Cut-based Rewriting is Only Available for AIG Networks !!" << endl;
       V3NtkHandler::setExternalVerbosity(); V3NtkHandler::setRewrite(true);
+      if (cut) V3NtkHandler::setCutRewrite(true);
       v3Handler.pushAndSetCurHandler(new V3NtkSimplify(handler));
       V3NtkHandler::setInternalVerbosity();
    }
@@ -874,7 +997,10 @@ V3RewriteNtkCmd::exec(const string& option) {
 
 void
 V3RewriteNtkCmd::usage(const bool& verbose) const {
-   Msg(MSG_IFO) << "Usage: REWrite NTk" << endl;
+   Msg(MSG_IFO) << "Usage: REWrite NTk [-Cut]" << endl;
+   if (verbose) {
+      Msg(MSG_IFO) << "Param: -Cut: Additionally replace 4-input cuts of AIG nodes by smaller NPN-equivalent structures." << endl;
+   }
 }
 
 void
@@ -913,7 +1039,7 @@ V3DuplicateNtkCmd::help() const {
 }
 
 //----------------------------------------------------------------------
-// SET NTKVerbosity [-All] [-REDuce] [-Strash] [-REWrite]
+// SET NTKVerbosity [-All] [-REDuce] [-Strash] [-REWrite] [-Cut-rewrite]
 //                  [-Fwd-map] [-Bwd-map] [-ON |-OFF |-RESET]
 //----------------------------------------------------------------------
 V3CmdExecStatus
@@ -921,7 +1047,7 @@ V3SetVerbosityCmd::exec(const string& option) {
    vector<string> options;
    V3CmdExec::lexOptions(option, options);
 
-   bool all = false, reduce = false, strash = false, rewrite = false, fwdMap = false, bwdMap = false;
+   bool all = false, reduce = false, strash = false, rewrite = false, cutRewrite = false, fwdMap = false, bwdMap = false;
    bool reset = false, on = false, off = false;
    
    size_t n = options.size();
@@ -943,6 +1069,10 @@ V3SetVerbosityCmd::exec(const string& option) {
          if (rewrite) return V3CmdExec::errorOption(CMD_OPT_EXTRA, token);
          else rewrite = true;
       }
+      else if (v3StrNCmp("-Cut-rewrite", token, 2) == 0) {
+         if (cutRewrite) return V3CmdExec::errorOption(CMD_OPT_EXTRA, token);
+         else cutRewrite = true;
+      }
       else if (v3StrNCmp("-Fwd-map", token, 2) == 0) {
          if (fwdMap) return V3CmdExec::errorOption(CMD_OPT_EXTRA, token);
          else fwdMap = true;
@@ -969,6 +1099,7 @@ V3SetVerbosityCmd::exec(const string& option) {
    if (!(on || off || reset)) on = true;
    if (reset) all = true;
    if (all) reduce = strash = rewrite = fwdMap = bwdMap = true;
+   if (all && off) cutRewrite = true;  // NOTE: Cut-based Rewriting is Only Turned on by -Cut-rewrite
 
    // Set Verification Verbosities
    if (reset) V3NtkHandler::resetVerbositySettings();
@@ -976,6 +1107,7 @@ V3SetVerbosityCmd::exec(const string& option) {
       if (reduce)  V3NtkHandler::setReduce (on);
       if (strash)  V3NtkHandler::setStrash (on);
       if (rewrite) V3NtkHandler::setRewrite(on);
+      if (cutRewrite) V3NtkHandler::setCutRewrite(on);
       if (fwdMap)  V3NtkHandler::setP2CMap (on);
       if (bwdMap)  V3NtkHandler::setC2PMap (on);
    }
@@ -985,16 +1117,17 @@ V3SetVerbosityCmd::exec(const string& option) {
 
 void
 V3SetVerbosityCmd::usage(const bool& verbose) const {
-   Msg(MSG_IFO) << "Usage: SET NTKVerbosity [-All] [-REDuce] [-Strash] [-REWrite] [-Fwd-map] [-Bwd-map]" << endl;
-   Msg(MSG_IFO) << "                        [-ON |-OFF |-RESET]" << endl;
+   Msg(MSG_IFO) << "Usage: SET NTKVerbosity [-All] [-REDuce] [-Strash] [-REWrite] [-Cut-rewrite]" << endl;
+   Msg(MSG_IFO) << "                        [-Fwd-map] [-Bwd-map] [-ON |-OFF |-RESET]" << endl;
    if (verbose) {
       Msg(MSG_IFO) << "Param: -RESET  : Reset everything to default." << endl;
       Msg(MSG_IFO) << "       -ON     : Turn specified attributes on." << endl;
       Msg(MSG_IFO) << "       -OFF    : Turn specified attributes off." << endl;
-      Msg(MSG_IFO) << "       -All    : Toggle all the following attributes." << endl;
+      Msg(MSG_IFO) << "       -All    : Toggle all the following attributes (-Cut-rewrite is only turned off)." << endl;
       Msg(MSG_IFO) << "       -REDuce : Toggle COI Reduction. (default = on)" << endl;
       Msg(MSG_IFO) << "       -Strash : Toggle Structural Hashing. (default = off)" << endl;
       Msg(MSG_IFO) << "       -REWrite: Toggle Rule-based Rewriting. (default = off)" << endl;
+      Msg(MSG_IFO) << "       -Cut-rewrite: Toggle Cut-based Rewriting on AIG Networks. (default = off)" << endl;
       Msg(MSG_IFO) << "       -Fwd-map: Toggle Preservation of Forward (to Sucessor) ID Maps. (default = on)" << endl;
       Msg(MSG_IFO) << "       -Bwd-map: Toggle Preservation of Backward (to Ancestor) ID Maps. (default = on)" << endl;
    }
@@ -15,10 +15,12 @@
 V3_COMMAND(V3ReadRTLCmd,         CMD_TYPE_IO);
 V3_COMMAND(V3ReadAIGCmd,         CMD_TYPE_IO);
 V3_COMMAND(V3ReadBTORCmd,        CMD_TYPE_IO);
+V3_COMMAND(V3ReadNtkCmd,         CMD_TYPE_IO);
 // Network Output Commands
 V3_COMMAND(V3WriteRTLCmd,        CMD_TYPE_IO);
 V3_COMMAND(V3WriteAIGCmd,        CMD_TYPE_IO);
 V3_COMMAND(V3WriteBTORCmd,       CMD_TYPE_IO);
+V3_COMMAND(V3WriteNtkCmd,        CMD_TYPE_IO);
 // Network Report Commands
 V3_COMMAND(V3PrintNtkCmd,        CMD_TYPE_PRINT);
 V3_COMMAND(V3PrintNetCmd,        CMD_TYPE_PRINT);
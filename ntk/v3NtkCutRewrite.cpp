@@ -0,0 +1,433 @@
+/****************************************************************************
+  FileName     [ v3NtkCutRewrite.cpp ]
+  PackageName  [ v3/src/ntk ]
+  Synopsis     [ Cut-Based Rewriting for AIG Network. ]
+  Author       [ Cheng-Yin Wu ]
+  Copyright    [ Copyright(c) 2012-2014 DVLab, GIEE, NTU, Taiwan ]
+****************************************************************************/
+
+#ifndef V3_NTK_CUT_REWRITE_C
+#define V3_NTK_CUT_REWRITE_C
+
+#include "v3NtkRewrite.h"
+#include "v3FlatHash.h"
+
+#include <algorithm>
+#include <pthread.h>
+
+// Cut-Based AIG Rewriting Overview
+// 1. Enumerate 4-feasible cuts of every AIG_NODE bottom-up, each with its truth table over the leaves.
+// 2. Canonicalize each truth table up to input permutation, input negation and output negation (NPN).
+// 3. Look up a replacement structure for the NPN class.  Structures are synthesized for all classes by
+//    recursive AND / OR / XOR / MUX decomposition when the tables are built.
+// 4. Replace a node if its structure is smaller than the maximum fanout-free cone (MFFC) bounded by the cut.
+// The parent Ntk is not modified.  The chosen replacements are built during duplication.
+
+// Defines for Truth Tables over Cut Leaves
+const uint16_t V3AigCutVarTT[V3AigCutSize] = { 0xAAAA, 0xCCCC, 0xF0F0, 0xFF00 };
+const uint16_t V3AigCutConst1 = 0xFFFF;
+const uint32_t V3AigCutListLimit = 8;   // Max Number of Non-Trivial Cuts Kept per Node
+const uint32_t V3AigNpnPermSize = 24;   // 4!
+const uint32_t V3AigNpnClassSize = 222; // Number of NPN Classes of 4-input Functions
+
+struct V3AigCut {
+   uint32_t    leaves[V3AigCutSize];
+   uint32_t    sign;    // Bloom Signature of leaves
+   uint16_t    tt;
+   uint8_t     size;
+};
+typedef V3Vec<V3AigCut>::Vec  V3AigCutList;
+
+struct V3AigNpnEntry {
+   uint16_t    canon;   // NPN Canonical Truth Table
+   uint8_t     perm;    // Index of Input Permutation
+   uint8_t     phase;   // Bits 0-3 for Input Negations, Bit 4 for Output Negation
+};
+
+// Replacement Structure : AND Nodes over Literals (var << 1 | cp)
+// var 0 is constant false, var 1-4 are canonical inputs, and var 5+k is the k-th node
+struct V3AigCutLib {
+   V3Vec<uint8_t>::Vec  lits;    // Two Literals per Node
+   uint8_t              out;
+};
+
+// Global Tables Shared by All Rewriting Runs (Built Once, then Read-only for Concurrent Runs in Engine Threads)
+static pthread_once_t               v3AigCutTableOnce = PTHREAD_ONCE_INIT;
+static V3Vec<V3UI32Vec>::Vec        v3AigNpnPerm;                  // 24 Permutations of {0, 1, 2, 3}
+static V3Vec<V3AigNpnEntry>::Vec    v3AigNpnTable;                 // NPN Canonical Forms of All Truth Tables
+static V3Vec<uint8_t>::Vec          v3AigSynCost;                  // Memorized Decomposition Costs
+static V3UI32Vec                    v3AigLibIndex;                 // Canonical Truth Table to Library Index
+static V3Vec<V3AigCutLib>::Vec      v3AigLibList;
+
+// Truth Table Helper Functions
+inline const uint16_t cutCofactor0(const uint16_t& tt, const uint32_t& v) {
+   const uint16_t low = tt & ~V3AigCutVarTT[v]; return low | (low << (1u << v)); }
+
+inline const uint16_t cutCofactor1(const uint16_t& tt, const uint32_t& v) {
+   const uint16_t high = tt & V3AigCutVarTT[v]; return high | (high >> (1u << v)); }
+
+inline const bool cutDependsOn(const uint16_t& tt, const uint32_t& v) {
+   return cutCofactor0(tt, v) != cutCofactor1(tt, v); }
+
+inline const uint32_t cutSupport(const uint16_t& tt) {
+   uint32_t support = 0;
+   for (uint32_t v = 0; v < V3AigCutSize; ++v) if (cutDependsOn(tt, v)) support |= (1u << v);
+   return support;
+}
+
+inline const uint16_t cutExists(uint16_t tt, const uint32_t& mask) {
+   for (uint32_t v = 0; v < V3AigCutSize; ++v) if (mask & (1u << v)) tt = cutCofactor0(tt, v) | cutCofactor1(tt, v);
+   return tt;
+}
+
+inline const uint16_t cutForall(uint16_t tt, const uint32_t& mask) {
+   for (uint32_t v = 0; v < V3AigCutSize; ++v) if (mask & (1u << v)) tt = cutCofactor0(tt, v) & cutCofactor1(tt, v);
+   return tt;
+}
+
+inline const uint16_t cutSetZero(uint16_t tt, const uint32_t& mask) {
+   for (uint32_t v = 0; v < V3AigCutSize; ++v) if (mask & (1u << v)) tt = cutCofactor0(tt, v);
+   return tt;
+}
+
+// Re-express tt over leaves "from" as a Truth Table over leaves "to", where from[i] = to[pos[i]]
+const uint16_t cutMoveTT(const uint16_t& tt, const uint32_t* const pos, const uint8_t& size) {
+   uint16_t result = 0; uint32_t m, j, i;
+   for (m = 0; m < 16; ++m) {
+      for (i = j = 0; i < size; ++i) if ((m >> pos[i]) & 1u) j |= (1u << i);
+      if ((tt >> j) & 1u) result |= (1u << m);
+   }
+   return result;
+}
+
+const uint16_t cutExpandTT(const V3AigCut& from, const V3AigCut& to) {
+   uint32_t pos[V3AigCutSize];
+   for (uint32_t i = 0, j = 0; i < from.size; ++i) {
+      while (to.leaves[j] != from.leaves[i]) { ++j; assert (j < to.size); }
+      pos[i] = j;
+   }
+   return cutMoveTT(from.tt, pos, from.size);
+}
+
+// Remove Leaves that the Function does not Depend on
+void cutCompact(V3AigCut& cut) {
+   const uint32_t support = cutSupport(cut.tt);
+   uint32_t pos[V3AigCutSize], size = 0;
+   for (uint32_t i = 0; i < cut.size; ++i) if (support & (1u << i)) pos[i] = size++;
+   if (size == cut.size) return;
+   uint16_t tt = 0;
+   for (uint32_t m = 0; m < 16; ++m) {
+      uint32_t j = 0;  // Minterm of the Original Leaves, Unsupported Leaves are 0
+      for (uint32_t i = 0; i < cut.size; ++i) if ((support & (1u << i)) && ((m >> pos[i]) & 1u)) j |= (1u << i);
+      if ((cut.tt >> j) & 1u) tt |= (1u << m);
+   }
+   cut.sign = 0;
+   for (uint32_t i = 0, k = 0; i < cut.size; ++i) {
+      if (!(support & (1u << i))) continue;
+      cut.leaves[k++] = cut.leaves[i]; cut.sign |= (1u << (cut.leaves[i] & 31));
+   }
+   cut.size = size; cut.tt = tt;
+}
+
+// NPN Canonicalization Functions
+// f(x) = g(y) ^ out, where y_perm[i] = x_i ^ phase_i, i.e. the Inverse of the Canonical Form g
+const uint16_t expandAigNpn(const uint16_t& canon, const V3UI32Vec& perm, const uint32_t& phase) {
+   uint16_t result = 0; uint32_t x, y, i;
+   for (x = 0; x < 16; ++x) {
+      for (i = y = 0; i < V3AigCutSize; ++i) if (((x ^ phase) >> i) & 1u) y |= (1u << perm[i]);
+      if (((canon >> y) ^ (phase >> V3AigCutSize)) & 1u) result |= (1u << x);
+   }
+   return result;
+}
+
+inline const V3AigNpnEntry& getAigNpnEntry(const uint16_t& tt) { return v3AigNpnTable[tt]; }
+
+// Replacement Synthesis Functions by Recursive Decomposition
+const uint32_t synAigCutCost(const uint16_t&);
+
+const uint32_t synAigCutBestSplit(const uint16_t& tt, uint32_t& kind, uint32_t& arg) {
+   // kind : 0 = AND on a Variable, 1 = OR on a Variable, 2 = XOR on a Variable, 3 = MUX on a Variable,
+   //        4 = Disjoint AND, 5 = Disjoint OR, 6 = Disjoint XOR
+   const uint32_t support = cutSupport(tt); assert (support);
+   uint32_t best = V3NtkUD, cost; uint16_t f0, f1, g, h, c;
+   for (uint32_t v = 0; v < V3AigCutSize; ++v) {
+      if (!(support & (1u << v))) continue;
+      f0 = cutCofactor0(tt, v); f1 = cutCofactor1(tt, v);
+      if (!f0 || !f1) { cost = 1 + synAigCutCost(f0 ? f0 : f1); if (cost < best) { best = cost; kind = 0; arg = v; } }
+      else if (V3AigCutConst1 == f0 || V3AigCutConst1 == f1) {
+         cost = 1 + synAigCutCost((V3AigCutConst1 == f0) ? f1 : f0); if (cost < best) { best = cost; kind = 1; arg = v; } }
+      else if ((uint16_t)~f0 == f1) { cost = 3 + synAigCutCost(f0); if (cost < best) { best = cost; kind = 2; arg = v; } }
+      else { cost = 3 + synAigCutCost(f0) + synAigCutCost(f1); if (cost < best) { best = cost; kind = 3; arg = v; } }
+   }
+   // Disjoint-Support Decompositions, S1 Contains the Lowest Support Variable
+   const uint32_t low = support & (~support + 1);
+   for (uint32_t s1 = support; s1; s1 = (s1 - 1) & support) {
+      const uint32_t s2 = support & ~s1;
+      if (!(s1 & low) || !s2) continue;
+      g = cutExists(tt, s2); h = cutExists(tt, s1);
+      if ((g & h) == tt) {
+         cost = 1 + synAigCutCost(g) + synAigCutCost(h); if (cost < best) { best = cost; kind = 4; arg = s1; } }
+      g = cutForall(tt, s2); h = cutForall(tt, s1);
+      if ((g | h) == tt) {
+         cost = 1 + synAigCutCost(g) + synAigCutCost(h); if (cost < best) { best = cost; kind = 5; arg = s1; } }
+      c = cutSetZero(tt, support) ? V3AigCutConst1 : 0; g = cutSetZero(tt, s2); h = cutSetZero(tt, s1) ^ c;
+      if ((g ^ h) == tt) {
+         cost = 3 + synAigCutCost(g) + synAigCutCost(h); if (cost < best) { best = cost; kind = 6; arg = s1; } }
+   }
+   assert (V3NtkUD != best); return best;
+}
+
+const uint32_t synAigCutCost(const uint16_t& tt) {
+   if (0xFF != v3AigSynCost[tt]) return v3AigSynCost[tt];
+   uint32_t cost = 0, kind, arg;
+   if (tt && V3AigCutConst1 != tt) {
+      bool literal = false;
+      for (uint32_t v = 0; v < V3AigCutSize; ++v)
+         if (V3AigCutVarTT[v] == tt || (uint16_t)~V3AigCutVarTT[v] == tt) literal = true;
+      if (!literal) cost = synAigCutBestSplit(tt, kind, arg);
+   }
+   assert (cost < 0xFF); v3AigSynCost[tt] = v3AigSynCost[(uint16_t)~tt] = cost; return cost;
+}
+
+const uint8_t synAigCutAnd(V3AigCutLib& lib, V3FlatHashMap<uint32_t, uint8_t>& hash, uint8_t a, uint8_t b) {
+   if (!a || !b) return 0; if (1 == a) return b; if (1 == b) return a;
+   if (a == b) return a; if ((a ^ 1) == b) return 0; if (a > b) { const uint8_t t = a; a = b; b = t; }
+   const uint32_t key = ((uint32_t)a << 8) | b;
+   V3FlatHashMap<uint32_t, uint8_t>::const_iterator it = hash.find(key); if (hash.end() != it) return it->second;
+   const uint8_t lit = (uint8_t)((1 + V3AigCutSize + (lib.lits.size() >> 1)) << 1); assert (lit < 0xFE);
+   lib.lits.push_back(a); lib.lits.push_back(b); hash.insert(make_pair(key, lit)); return lit;
+}
+
+inline const uint8_t synAigCutOr(V3AigCutLib& lib, V3FlatHashMap<uint32_t, uint8_t>& hash, const uint8_t& a, const uint8_t& b) {
+   return 1 ^ synAigCutAnd(lib, hash, a ^ 1, b ^ 1); }
+
+inline const uint8_t synAigCutMux(V3AigCutLib& lib, V3FlatHashMap<uint32_t, uint8_t>& hash, const uint8_t& s, const uint8_t& t, const uint8_t& e) {
+   return synAigCutOr(lib, hash, synAigCutAnd(lib, hash, s, t), synAigCutAnd(lib, hash, s ^ 1, e)); }
+
+const uint8_t synAigCutBuild(V3AigCutLib& lib, V3FlatHashMap<uint32_t, uint8_t>& hash, const uint16_t& tt) {
+   if (!tt) return 0; if (V3AigCutConst1 == tt) return 1;
+   for (uint32_t v = 0; v < V3AigCutSize; ++v) {
+      if (V3AigCutVarTT[v] == tt) return (uint8_t)((1 + v) << 1);
+      if ((uint16_t)~V3AigCutVarTT[v] == tt) return (uint8_t)(((1 + v) << 1) | 1);
+   }
+   uint32_t kind = 0, arg = 0; synAigCutBestSplit(tt, kind, arg);
+   if (kind < 4) {
+      const uint8_t x = (uint8_t)((1 + arg) << 1);
+      const uint16_t f0 = cutCofactor0(tt, arg), f1 = cutCofactor1(tt, arg);
+      if (0 == kind) return f0 ? synAigCutAnd(lib, hash, x ^ 1, synAigCutBuild(lib, hash, f0))
+                               : synAigCutAnd(lib, hash, x, synAigCutBuild(lib, hash, f1));
+      if (1 == kind) return (V3AigCutConst1 == f0) ? synAigCutOr(lib, hash, x ^ 1, synAigCutBuild(lib, hash, f1))
+                                                   : synAigCutOr(lib, hash, x, synAigCutBuild(lib, hash, f0));
+      const uint8_t e = synAigCutBuild(lib, hash, f0);
+      const uint8_t t = (2 == kind) ? (e ^ 1) : synAigCutBuild(lib, hash, f1);
+      return synAigCutMux(lib, hash, x, t, e);
+   }
+   const uint32_t support = cutSupport(tt), s2 = support & ~arg;
+   if (4 == kind) return synAigCutAnd(lib, hash, synAigCutBuild(lib, hash, cutExists(tt, s2)),
+                                                 synAigCutBuild(lib, hash, cutExists(tt, arg)));
+   if (5 == kind) return synAigCutOr(lib, hash, synAigCutBuild(lib, hash, cutForall(tt, s2)),
+                                                synAigCutBuild(lib, hash, cutForall(tt, arg)));
+   assert (6 == kind);
+   const uint16_t c = cutSetZero(tt, support) ? V3AigCutConst1 : 0;
+   const uint8_t g = synAigCutBuild(lib, hash, cutSetZero(tt, s2));
+   const uint8_t h = synAigCutBuild(lib, hash, cutSetZero(tt, arg) ^ c);
+   return synAigCutMux(lib, hash, g, h ^ 1, h);
+}
+
+inline const V3AigCutLib& getAigCutLib(const uint16_t& canon) {
+   assert (V3NtkUD != v3AigLibIndex[canon]); return v3AigLibList[v3AigLibIndex[canon]]; }
+
+// Table Construction Functions
+void buildAigCutTables() {
+   V3UI32Vec perm(V3AigCutSize, 0);
+   for (uint32_t i = 0; i < V3AigCutSize; ++i) perm[i] = i;
+   do { v3AigNpnPerm.push_back(perm); } while (next_permutation(perm.begin(), perm.end()));
+   assert (V3AigNpnPermSize == v3AigNpnPerm.size());
+   v3AigNpnTable = V3Vec<V3AigNpnEntry>::Vec(1u << 16); V3BoolVec done(1u << 16, false);
+   v3AigSynCost = V3Vec<uint8_t>::Vec(1u << 16, 0xFF); v3AigLibIndex = V3UI32Vec(1u << 16, V3NtkUD);
+   v3AigLibList.clear(); v3AigLibList.reserve(V3AigNpnClassSize);
+   // Truth Tables are Visited in Ascending Order, so the First One Left in a Class is its Canonical (Minimum) Form
+   for (uint32_t canon = 0; canon < (1u << 16); ++canon) {
+      if (done[canon]) continue;
+      for (uint32_t p = 0; p < V3AigNpnPermSize; ++p)
+         for (uint32_t phase = 0; phase < (2u << V3AigCutSize); ++phase) {
+            const uint16_t tt = expandAigNpn(canon, v3AigNpnPerm[p], phase); if (done[tt]) continue;
+            V3AigNpnEntry& entry = v3AigNpnTable[tt]; entry.canon = canon; entry.perm = p; entry.phase = phase;
+            done[tt] = true;
+         }
+      v3AigLibIndex[canon] = v3AigLibList.size(); v3AigLibList.push_back(V3AigCutLib());
+      V3AigCutLib& lib = v3AigLibList.back(); V3FlatHashMap<uint32_t, uint8_t> hash;
+      lib.out = synAigCutBuild(lib, hash, canon);
+   }
+   assert (V3AigNpnClassSize == v3AigLibList.size());
+}
+
+inline void initAigCutTables() { pthread_once(&v3AigCutTableOnce, buildAigCutTables); }
+
+// Cut Enumeration Helper Functions
+inline void initTrivialCut(V3AigCut& cut, const V3NetId& id) {
+   cut.leaves[0] = id.id; cut.size = 1; cut.tt = V3AigCutVarTT[0]; cut.sign = 1u << (id.id & 31); }
+
+const bool mergeCutLeaves(const V3AigCut& a, const V3AigCut& b, V3AigCut& cut) {
+   // Each Signature Bit Stands for at Least One Distinct Leaf
+   if (__builtin_popcount(a.sign | b.sign) > (int)V3AigCutSize) return false;
+   uint32_t i = 0, j = 0; cut.size = 0;
+   while (i < a.size || j < b.size) {
+      if (V3AigCutSize == cut.size) return false;
+      if (j == b.size || (i < a.size && a.leaves[i] < b.leaves[j])) cut.leaves[cut.size++] = a.leaves[i++];
+      else if (i == a.size || b.leaves[j] < a.leaves[i]) cut.leaves[cut.size++] = b.leaves[j++];
+      else { cut.leaves[cut.size++] = a.leaves[i++]; ++j; }
+   }
+   cut.sign = a.sign | b.sign; return true;
+}
+
+inline const bool isCutSubset(const V3AigCut& a, const V3AigCut& b) {  // a is a subset of b
+   if (a.size > b.size || (a.sign & ~b.sign)) return false;
+   for (uint32_t i = 0, j = 0; i < a.size; ++i, ++j) {
+      while (j < b.size && b.leaves[j] < a.leaves[i]) ++j;
+      if (j == b.size || b.leaves[j] != a.leaves[i]) return false;
+   }
+   return true;
+}
+
+void enumerateAigCuts(V3AigNtk* const ntk, const V3NetId& id, const V3Vec<V3AigCutList>::Vec& cutList, V3AigCutList& cuts) {
+   assert (AIG_NODE == ntk->getGateType(id)); cuts.clear();
+   V3AigCutList fanin[2]; V3AigCut cut;
+   for (uint32_t k = 0; k < 2; ++k) {
+      const V3NetId in = ntk->getInputNetId(id, k);
+      if (AIG_FALSE == ntk->getGateType(in)) { cut.size = 0; cut.sign = 0; cut.tt = 0; fanin[k].push_back(cut); continue; }
+      initTrivialCut(cut, in); fanin[k] = cutList[in.id]; fanin[k].push_back(cut);
+   }
+   const bool cp0 = ntk->getInputNetId(id, 0).cp, cp1 = ntk->getInputNetId(id, 1).cp;
+   for (uint32_t i = 0; i < fanin[0].size(); ++i)
+      for (uint32_t j = 0; j < fanin[1].size(); ++j) {
+         if (!mergeCutLeaves(fanin[0][i], fanin[1][j], cut)) continue;
+         const uint16_t t0 = cutExpandTT(fanin[0][i], cut), t1 = cutExpandTT(fanin[1][j], cut);
+         cut.tt = (cp0 ? (uint16_t)~t0 : t0) & (cp1 ? (uint16_t)~t1 : t1); cutCompact(cut);
+         // Remove Dominated Cuts
+         bool dominated = false;
+         for (uint32_t k = 0; k < cuts.size(); ++k) {
+            if (isCutSubset(cuts[k], cut)) { dominated = true; break; }
+            if (isCutSubset(cut, cuts[k])) { cuts[k] = cuts.back(); cuts.pop_back(); --k; }
+         }
+         if (!dominated && cuts.size() < V3AigCutListLimit) cuts.push_back(cut);
+      }
+}
+
+// MFFC Helper Functions
+inline const bool isCutLeaf(const V3AigCut& cut, const uint32_t& id) {
+   for (uint32_t i = 0; i < cut.size; ++i) if (id == cut.leaves[i]) return true;
+   return false;
+}
+
+const uint32_t derefAigCutCone(V3AigNtk* const ntk, const V3NetId& id, const V3AigCut& cut, V3UI32Vec& refs) {
+   uint32_t count = 1;
+   for (uint32_t i = 0; i < 2; ++i) {
+      const V3NetId in = ntk->getInputNetId(id, i);
+      if (AIG_NODE != ntk->getGateType(in) || isCutLeaf(cut, in.id)) continue;
+      assert (refs[in.id]); if (!--refs[in.id]) count += derefAigCutCone(ntk, in, cut, refs);
+   }
+   return count;
+}
+
+void refAigCutCone(V3AigNtk* const ntk, const V3NetId& id, const V3AigCut& cut, V3UI32Vec& refs) {
+   for (uint32_t i = 0; i < 2; ++i) {
+      const V3NetId in = ntk->getInputNetId(id, i);
+      if (AIG_NODE != ntk->getGateType(in) || isCutLeaf(cut, in.id)) continue;
+      if (!refs[in.id]++) refAigCutCone(ntk, in, cut, refs);
+   }
+}
+
+// Cut-Based AIG Rewrite Functions
+// Choose Replacements for AIG_NODEs in orderMap and Remove AIG_NODEs No Longer Needed from orderMap.
+// Return the Number of Replaced Nodes.
+const uint32_t rewriteAigNtkByCut(V3AigNtk* const ntk, V3NetVec& orderMap, V3AigCutChoiceVec& choices) {
+   assert (ntk); assert (!dynamic_cast<V3BvNtk*>(ntk)); initAigCutTables();
+   V3AigCutChoice none; none.size = V3AigCutSize + 1; none.tt = 0;
+   choices = V3AigCutChoiceVec(ntk->getNetSize(), none);
+   // Compute Fanout References
+   V3UI32Vec refs(ntk->getNetSize(), 0), pending(ntk->getNetSize(), 0);
+   V3NetVec roots; roots.clear(); uint32_t i, j, oldCost = 0;
+   for (i = 0; i < orderMap.size(); ++i) {
+      const V3GateType type = ntk->getGateType(orderMap[i]);
+      if (AIG_NODE == type) {
+         ++oldCost; ++pending[ntk->getInputNetId(orderMap[i], 0).id]; ++pending[ntk->getInputNetId(orderMap[i], 1).id]; }
+      if (AIG_NODE == type || V3_FF == type || V3_PIO == type)
+         for (j = 0; j < ntk->getInputNetSize(orderMap[i]); ++j) {
+            ++refs[ntk->getInputNetId(orderMap[i], j).id];
+            if (V3_FF == type || V3_PIO == type) roots.push_back(ntk->getInputNetId(orderMap[i], j));
+         }
+   }
+   for (i = 0; i < ntk->getOutputSize(); ++i) { ++refs[ntk->getOutput(i).id]; roots.push_back(ntk->getOutput(i)); }
+   // Keep Dangling Nodes if Reduction is Off
+   if (!V3NtkHandler::reduceON())
+      for (i = 0; i < orderMap.size(); ++i)
+         if (AIG_NODE == ntk->getGateType(orderMap[i]) && !refs[orderMap[i].id]) roots.push_back(orderMap[i]);
+   // Enumerate Cuts and Choose Replacements in Topological Order
+   V3Vec<V3AigCutList>::Vec cutList(ntk->getNetSize());
+   V3UI32Vec libSize(ntk->getNetSize(), 0);
+   for (i = 0; i < orderMap.size(); ++i) {
+      const V3NetId& id = orderMap[i]; if (AIG_NODE != ntk->getGateType(id)) continue;
+      enumerateAigCuts(ntk, id, cutList, cutList[id.id]);
+      uint32_t bestGain = 0;
+      for (j = 0; j < cutList[id.id].size(); ++j) {
+         const V3AigCut& cut = cutList[id.id][j];
+         const V3AigNpnEntry& npn = getAigNpnEntry(cut.tt);
+         const uint32_t cost = getAigCutLib(npn.canon).lits.size() >> 1;
+         const uint32_t mffc = derefAigCutCone(ntk, id, cut, refs); refAigCutCone(ntk, id, cut, refs);
+         if (mffc <= cost + bestGain) continue;
+         bestGain = mffc - cost; libSize[id.id] = cost; choices[id.id].size = cut.size; choices[id.id].tt = cut.tt;
+         for (uint32_t k = 0; k < cut.size; ++k) choices[id.id].leaves[k] = cut.leaves[k];
+      }
+      // Release Cuts of Fanins whose Fanouts are All Processed
+      for (j = 0; j < 2; ++j) {
+         const uint32_t in = ntk->getInputNetId(id, j).id;
+         assert (pending[in]); if (!--pending[in]) V3AigCutList().swap(cutList[in]);
+      }
+   }
+   // Mark Nodes Needed by the Chosen Implementation
+   V3BoolVec needed(ntk->getNetSize(), false);
+   for (i = 0; i < roots.size(); ++i) needed[roots[i].id] = true;
+   uint32_t newCost = 0, replaced = 0; i = orderMap.size();
+   while (i--) {
+      const V3NetId& id = orderMap[i];
+      if (AIG_NODE != ntk->getGateType(id) || !needed[id.id]) continue;
+      if (V3AigCutSize < choices[id.id].size) {
+         needed[ntk->getInputNetId(id, 0).id] = needed[ntk->getInputNetId(id, 1).id] = true; ++newCost; }
+      else {
+         for (j = 0; j < choices[id.id].size; ++j) needed[choices[id.id].leaves[j]] = true;
+         newCost += libSize[id.id]; ++replaced;
+      }
+   }
+   // Keep the Original Network if No Improvement is Expected
+   if (newCost >= oldCost) { choices.clear(); return 0; }
+   for (i = j = 0; i < orderMap.size(); ++i)
+      if (AIG_NODE != ntk->getGateType(orderMap[i]) || needed[orderMap[i].id]) orderMap[j++] = orderMap[i];
+   orderMap.resize(j); return replaced;
+}
+
+// Construct the Replacement of a Node over Duplicated Leaves
+const V3NetId rewriteAigCutBuild(V3AigNtk* const ntk, const V3AigCutChoice& choice, const V3NetVec& p2cMap, V3PortableType& netHash) {
+   assert (ntk); assert (V3AigCutSize >= choice.size); initAigCutTables();
+   const V3AigNpnEntry& npn = getAigNpnEntry(choice.tt);
+   const V3AigCutLib& lib = getAigCutLib(npn.canon);
+   const V3UI32Vec& perm = v3AigNpnPerm[npn.perm];
+   // Literals of Constant, Canonical Inputs and Nodes
+   V3NetVec nets(1 + V3AigCutSize + (lib.lits.size() >> 1), V3NetId::makeNetId(0));
+   for (uint32_t i = 0; i < choice.size; ++i) {
+      assert (choice.leaves[i] < p2cMap.size()); assert (V3NetUD != p2cMap[choice.leaves[i]]);
+      nets[1 + perm[i]] = ((npn.phase >> i) & 1u) ? ~p2cMap[choice.leaves[i]] : p2cMap[choice.leaves[i]];
+   }
+   V3InputVec inputs; inputs.reserve(2);
+   for (uint32_t i = 0; i < lib.lits.size(); i += 2) {
+      inputs.clear();
+      inputs.push_back((lib.lits[i] & 1u) ? ~nets[lib.lits[i] >> 1] : nets[lib.lits[i] >> 1]);
+      inputs.push_back((lib.lits[i + 1] & 1u) ? ~nets[lib.lits[i + 1] >> 1] : nets[lib.lits[i + 1] >> 1]);
+      nets[1 + V3AigCutSize + (i >> 1)] = elaborateAigGate(ntk, AIG_NODE, inputs, netHash);
+   }
+   const V3NetId id = (lib.out & 1u) ? ~nets[lib.out >> 1] : nets[lib.out >> 1];
+   return ((npn.phase >> V3AigCutSize) & 1u) ? ~id : id;
+}
+
+#endif
+
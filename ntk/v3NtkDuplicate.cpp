@@ -25,10 +25,10 @@ void duplicateGeneralInit(V3Ntk* const ntk, V3NetVec& p2cMap, V3NetVec& orderMap
    for (uint32_t i = 1, j = ntk->getNetSize(); i < j; ++i) p2cMap.push_back(V3NetUD);
 }
 
-void duplicateReductionInit(V3Ntk* const ntk, const V3NetVec& targetNets, V3NetVec& p2cMap, V3NetVec& orderMap) {
+void duplicateReductionInit(V3Ntk* const ntk, const V3NetVec& targetNets, V3NetVec& p2cMap, V3NetVec& orderMap, const bool& reduceLatch) {
    assert (ntk); assert (targetNets.size());
    // Compute Reduced DFS Order for Duplication
-   dfsNtkForReductionOrder(ntk, orderMap, targetNets);
+   dfsNtkForReductionOrder(ntk, orderMap, targetNets, reduceLatch);
    // Initialize Mapper From Parent (Index) to Current (V3NetId) Ntk
    p2cMap.clear(); p2cMap.reserve(ntk->getNetSize()); p2cMap.push_back(V3NetId::makeNetId(0));
    for (uint32_t i = 1, j = ntk->getNetSize(); i < j; ++i) p2cMap.push_back(V3NetUD);
@@ -89,7 +89,7 @@ void duplicateInputGates(V3NtkHandler* const handler, V3Ntk* const ntk, V3NetVec
    }
 }
 
-void duplicateNtk(V3NtkHandler* const handler, V3Ntk* const ntk, V3NetVec& p2cMap, V3NetVec& c2pMap, V3NetVec& orderMap, V3PortableType& netHash, V3NtkHierInfo& hierInfo, const uint32_t& flattenLevel) {
+void duplicateNtk(V3NtkHandler* const handler, V3Ntk* const ntk, V3NetVec& p2cMap, V3NetVec& c2pMap, V3NetVec& orderMap, V3PortableType& netHash, V3NtkHierInfo& hierInfo, const uint32_t& flattenLevel, const V3NetVec& repMap = V3NetVec(), const V3AigCutChoiceVec& cutMap = V3AigCutChoiceVec(), const bool& strash = true) {
    assert (handler); assert (ntk); V3Ntk* const pNtk = handler->getNtk(); assert (pNtk);
    assert ((bool)(dynamic_cast<V3BvNtk*>(pNtk)) == (bool)(dynamic_cast<V3BvNtk*>(ntk)));
    const uint32_t ntkIndex = hierInfo.getNtkSize() - 1;
@@ -139,13 +139,22 @@ void duplicateNtk(V3NtkHandler* const handler, V3Ntk* const ntk, V3NetVec& p2cMa
          if (V3NetUD == c2pMap[id.id]) c2pMap[id.id] = V3NetId::makeNetId(orderMap[i].id, id.cp);
       }
       else {
-         if (AIG_NODE == type) {
-            id = pNtk->getInputNetId(orderMap[i], 0); assert (V3NetUD != id); assert (V3NetUD != p2cMap[id.id]);
-            inputs.push_back(V3NetId::makeNetId(p2cMap[id.id].id, p2cMap[id.id].cp ^ id.cp));
-            id = pNtk->getInputNetId(orderMap[i], 1); assert (V3NetUD != id); assert (V3NetUD != p2cMap[id.id]);
-            inputs.push_back(V3NetId::makeNetId(p2cMap[id.id].id, p2cMap[id.id].cp ^ id.cp));
+         if (repMap.size() && repMap[orderMap[i].id] != orderMap[i] &&  // Merged by Parallel Strash or FRAIG
+             V3NetUD != p2cMap[repMap[orderMap[i].id].id]) {
+            id = repMap[orderMap[i].id];
+            p2cMap[orderMap[i].id] = V3NetId::makeNetId(p2cMap[id.id].id, p2cMap[id.id].cp ^ id.cp); continue;
+         }
+         if (AIG_NODE == type && cutMap.size() && V3AigCutSize >= cutMap[orderMap[i].id].size)  // Replaced by Cut Rewrite
+            id = p2cMap[orderMap[i].id] = rewriteAigCutBuild(ntk, cutMap[orderMap[i].id], p2cMap, netHash);
+         else {
+            if (AIG_NODE == type) {
+               id = pNtk->getInputNetId(orderMap[i], 0); assert (V3NetUD != id); assert (V3NetUD != p2cMap[id.id]);
+               inputs.push_back(V3NetId::makeNetId(p2cMap[id.id].id, p2cMap[id.id].cp ^ id.cp));
+               id = pNtk->getInputNetId(orderMap[i], 1); assert (V3NetUD != id); assert (V3NetUD != p2cMap[id.id]);
+               inputs.push_back(V3NetId::makeNetId(p2cMap[id.id].id, p2cMap[id.id].cp ^ id.cp));
+            }
+            id = p2cMap[orderMap[i].id] = elaborateAigGate(ntk, type, inputs, netHash, strash); inputs.clear();
          }
-         id = p2cMap[orderMap[i].id] = elaborateAigGate(ntk, type, inputs, netHash); inputs.clear();
          while (c2pMap.size() < ntk->getNetSize()) c2pMap.push_back(V3NetUD);
          assert (c2pMap.size() == ntk->getNetSize()); assert (id.id < c2pMap.size());
          if (V3NetUD == c2pMap[id.id]) c2pMap[id.id] = V3NetId::makeNetId(orderMap[i].id, id.cp);
@@ -239,17 +248,17 @@ void duplicateNtk(V3NtkHandler* const handler, V3Ntk* const ntk, V3NetVec& p2cMa
 }
 
 // General Gate Type Elaboration Functions for V3 Ntk
-const V3NetId elaborateAigGate(V3AigNtk* const ntk, const V3GateType& type, V3InputVec& inputs, V3PortableType& netHash) {
+const V3NetId elaborateAigGate(V3AigNtk* const ntk, const V3GateType& type, V3InputVec& inputs, V3PortableType& netHash, const bool& strash) {
    assert (ntk); assert (AIG_NODE == type || AIG_FALSE == type);
    V3NetId id = V3NetUD; V3GateType gateType = type;
-   // Perform Strashing and Rewriting
-   const bool cpId = rewriteAigGate(ntk, gateType, inputs, netHash);
+   // Perform Strashing and Rewriting (Skipped if strash is Disabled by the Caller, e.g. after Parallel Strash)
+   const bool cpId = strash ? rewriteAigGate(ntk, gateType, inputs, netHash) : false;
    if (V3_PI == gateType) id = inputs[0].id;
    else {  // Construct AIG Gate
       if (AIG_NODE == gateType) {
          assert (2 == inputs.size()); id = ntk->createNet(1);
          assert (id.id < ntk->getNetSize()); ntk->setInput(id, inputs); ntk->createGate(gateType, id);
-         if (V3NtkHandler::strashON()) strashAigNodeGate(ntk, id, netHash);
+         if (strash && V3NtkHandler::strashON()) strashAigNodeGate(ntk, id, netHash);
       }
       else {
          assert (AIG_FALSE == gateType); assert (!inputs.size());
@@ -315,7 +324,7 @@ const V3NetId elaborateAigAndOrAndGate(V3AigNtk* const ntk, V3InputVec& inputs,
 }
 
 // General Duplication Functions for V3 Ntk  (Note that PO will NOT be created !!)
-V3Ntk* const duplicateNtk(V3NtkHandler* const handler, V3NetVec& p2cMap, V3NetVec& c2pMap) {
+V3Ntk* const duplicateNtk(V3NtkHandler* const handler, V3NetVec& p2cMap, V3NetVec& c2pMap, const V3NetVec& mergeMap) {
    assert (handler); assert (handler->getNtk());
    // Initialize Mapping Tables
    V3NetVec orderMap; c2pMap.clear();
@@ -327,16 +336,27 @@ V3Ntk* const duplicateNtk(V3NtkHandler* const handler, V3NetVec& p2cMap, V3NetVe
    // Create Duplicate Ntk
    V3Ntk* const ntk = createV3Ntk(dynamic_cast<V3BvNtk*>(handler->getNtk())); assert (ntk);
    duplicateInputNets(handler, ntk, p2cMap, c2pMap, orderMap);
+   // Compute Structural Representatives in Parallel, then Duplicate without Serial Strash
+   // NOTE: Representatives Given in mergeMap (e.g. Proven by FRAIG) are Used Instead
+   V3NetVec repMap = mergeMap; assert (!repMap.size() || handler->getNtk()->getNetSize() == repMap.size());
+   const bool parallelStrash = !isBvNtk && V3NtkHandler::strashON() && !V3NtkHandler::rewriteON() && !repMap.size() && 
+                               1 < V3NtkHandler::getStrashThreads() && !handler->getNtk()->getModuleSize();
+   // NOTE: Serial Strash is Disabled by a Local Flag, as Engine Threads may Duplicate Networks Concurrently
+   if (parallelStrash) strashAigNtkParallel(handler->getNtk(), orderMap, repMap, V3NtkHandler::getStrashThreads());
+   // Choose Cut-Based Replacements, and Drop AIG Nodes Covered by Them from orderMap
+   V3AigCutChoiceVec cutMap; cutMap.clear();
+   if (!isBvNtk && !repMap.size() && V3NtkHandler::cutRewriteON() && !handler->getNtk()->getModuleSize())
+      rewriteAigNtkByCut(handler->getNtk(), orderMap, cutMap);
    V3NtkHierInfo hierInfo; hierInfo.clear(); hierInfo.pushNtk(handler, 0);
-   duplicateNtk(handler, ntk, p2cMap, c2pMap, orderMap, netHash, hierInfo, 0);
+   duplicateNtk(handler, ntk, p2cMap, c2pMap, orderMap, netHash, hierInfo, 0, repMap, cutMap, !parallelStrash);
    duplicateInputGates(handler, ntk, p2cMap, c2pMap); return ntk;
 }
 
-V3Ntk* const elaborateNtk(V3NtkHandler* const handler, const V3NetVec& targetNets, V3NetVec& p2cMap, V3NetVec& c2pMap, V3PortableType& netHash) {
+V3Ntk* const elaborateNtk(V3NtkHandler* const handler, const V3NetVec& targetNets, V3NetVec& p2cMap, V3NetVec& c2pMap, V3PortableType& netHash, const bool& reduceLatch) {
    assert (handler); assert (handler->getNtk());
-   // Initialize Mapping Tables
+   // Initialize Mapping Tables  (Latches out of the COI of targetNets are Removed if reduceLatch)
    V3NetVec orderMap; c2pMap.clear();
-   duplicateReductionInit(handler->getNtk(), targetNets, p2cMap, orderMap);
+   duplicateReductionInit(handler->getNtk(), targetNets, p2cMap, orderMap, reduceLatch);
    assert (orderMap.size()); assert (!orderMap[0].id); c2pMap.push_back(orderMap[0]);
    // Initialize Net Hash Tables
    const bool isBvNtk = dynamic_cast<V3BvNtk*>(handler->getNtk());
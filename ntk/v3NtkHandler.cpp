@@ -30,6 +30,7 @@ string V3NtkHandler::V3AuxExpansionName   = V3ExpansionName;
 string V3NtkHandler::V3AuxNetNamePrefix   = V3NetNamePrefix;
 unsigned char V3NtkHandler::_extVerbosity = 0;
 unsigned char V3NtkHandler::_intVerbosity = 0;
+uint32_t      V3NtkHandler::_strashThreads = 1;
 
 // Constructor and Destructor
 V3NtkHandler::V3NtkHandler(V3NtkHandler* const p, V3Ntk* const ntk) : _handler(p) {
@@ -323,6 +324,7 @@ V3NtkHandler::printVerbositySettings() {
    if (reduceON())  Msg(MSG_IFO) << "-REDuce ";
    if (strashON())  Msg(MSG_IFO) << "-Strash ";
    if (rewriteON()) Msg(MSG_IFO) << "-REWrite ";
+   if (cutRewriteON()) Msg(MSG_IFO) << "-Cut_rewrite ";
    if (P2CMapON())  Msg(MSG_IFO) << "-Fwd_map ";
    if (C2PMapON())  Msg(MSG_IFO) << "-Bwd_map ";
 }
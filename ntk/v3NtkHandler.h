@@ -133,12 +133,16 @@ class V3NtkHandler
       static inline void setRewrite(const bool& t) { if (t) _extVerbosity |=  4ul; else _extVerbosity &= ~4ul;  }
       static inline void setP2CMap (const bool& t) { if (t) _extVerbosity |=  8ul; else _extVerbosity &= ~8ul;  }
       static inline void setC2PMap (const bool& t) { if (t) _extVerbosity |= 16ul; else _extVerbosity &= ~16ul; }
+      static inline void setCutRewrite(const bool& t) { if (t) _extVerbosity |= 32ul; else _extVerbosity &= ~32ul; }
+      static inline void setStrashThreads(const uint32_t& t) { _strashThreads = t ? t : 1; }
       // Verbosity Helper Functions
       static inline const bool reduceON()  { return _extVerbosity & 1ul;  }
       static inline const bool strashON()  { return _extVerbosity & 2ul;  }
       static inline const bool rewriteON() { return _extVerbosity & 4ul;  }
       static inline const bool P2CMapON()  { return _extVerbosity & 8ul;  }
       static inline const bool C2PMapON()  { return _extVerbosity & 16ul; }
+      static inline const bool cutRewriteON() { return _extVerbosity & 32ul; }
+      static inline const uint32_t getStrashThreads() { return _strashThreads; }
       inline const bool isMutable() const { return !(_refCount || _instRef); }
       // Ntk Printing Functions
       void printSummary() const;
@@ -177,6 +181,7 @@ class V3NtkHandler
       // Static Members for Global Control
       static unsigned char _extVerbosity;
       static unsigned char _intVerbosity;
+      static uint32_t      _strashThreads;
       // Ntk Handler Data Members
       uint32_t             _instRef;
       uint32_t             _refCount;
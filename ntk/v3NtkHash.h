@@ -10,6 +10,9 @@
 #define V3_NTK_HASH_H
 
 #include "v3Ntk.h"
+#include "v3FlatHash.h"
+
+#include <pthread.h>
 
 // Defines for Net Hash Data Types
 typedef pair<uint64_t, uint32_t>             V3MuxKey;
@@ -34,5 +37,31 @@ inline const uint64_t V3UnorderedNetType2HashKey(const V3NetType& id1, const V3N
 inline const V3MuxKey V3MuxNetType2HashKey(const V3NetType& fId, const V3NetType& tId, const V3NetType& sId) {
    return make_pair(V3OrderedNetType2HashKey(fId, tId), V3NetType2HashKey(sId)); }
 
+// class V3ConcurrentUI64Hash : Lock-Striped Hash Table for Parallel Structural Hashing
+// If two threads insert the same key, the smaller value is kept, so the content is schedule-independent.
+// Function find() takes no lock and is only valid after all insertions are joined.
+class V3ConcurrentUI64Hash
+{
+   public : 
+      V3ConcurrentUI64Hash(const uint32_t& s = 64) : _table(s ? s : 1), _mutex(s ? s : 1) {
+         for (uint32_t i = 0; i < _mutex.size(); ++i) pthread_mutex_init(&_mutex[i], NULL); }
+      ~V3ConcurrentUI64Hash() { for (uint32_t i = 0; i < _mutex.size(); ++i) pthread_mutex_destroy(&_mutex[i]); }
+      inline void insertMin(const uint64_t& key, const uint32_t& value) {
+         const uint32_t i = getStripe(key); pthread_mutex_lock(&_mutex[i]);
+         V3FlatHashMap<uint64_t, uint32_t>::iterator it = _table[i].find(key);
+         if (_table[i].end() == it) _table[i].insert(make_pair(key, value));
+         else if (value < it->second) it->second = value;
+         pthread_mutex_unlock(&_mutex[i]); }
+      inline const uint32_t find(const uint64_t& key) const {
+         const uint32_t i = getStripe(key);
+         V3FlatHashMap<uint64_t, uint32_t>::const_iterator it = _table[i].find(key);
+         return (_table[i].end() == it) ? V3NtkUD : it->second; }
+   private : 
+      inline const uint32_t getStripe(const uint64_t& key) const {
+         return (uint32_t)(((key * 0x9E3779B97F4A7C15ull) >> 32) % _table.size()); }
+      V3Vec<V3FlatHashMap<uint64_t, uint32_t> >::Vec   _table;
+      V3Vec<pthread_mutex_t>::Vec                      _mutex;
+};
+
 #endif
 
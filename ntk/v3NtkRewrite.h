@@ -36,5 +36,18 @@ const bool rewrite_AIG_NODE(V3AigNtk* const, V3GateType&, V3InputVec&, V3Portabl
 const bool rewriteBvGate   (V3BvNtk * const, V3GateType&, V3InputVec&, V3PortableType&);
 const bool rewriteAigGate  (V3AigNtk* const, V3GateType&, V3InputVec&, V3PortableType&);
 
+// Cut-Based AIG Rewriting
+const uint32_t V3AigCutSize = 4;
+
+struct V3AigCutChoice {
+   uint32_t leaves[V3AigCutSize];   // Leaves in Ascending Order of Net Index
+   uint16_t tt;                     // Function of the Node over leaves
+   uint8_t  size;                   // Number of leaves (> V3AigCutSize if the Node is NOT Replaced)
+};
+typedef V3Vec<V3AigCutChoice>::Vec  V3AigCutChoiceVec;
+
+const uint32_t rewriteAigNtkByCut(V3AigNtk* const, V3NetVec&, V3AigCutChoiceVec&);
+const V3NetId rewriteAigCutBuild (V3AigNtk* const, const V3AigCutChoice&, const V3NetVec&, V3PortableType&);
+
 #endif
 
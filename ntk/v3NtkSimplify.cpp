@@ -16,10 +16,10 @@
  * Class V3NtkSimplify Implementations
 \* -------------------------------------------------- */
 // Constructor and Destructor
-V3NtkSimplify::V3NtkSimplify(V3NtkHandler* const handler) : V3NtkHandler(handler) {
+V3NtkSimplify::V3NtkSimplify(V3NtkHandler* const handler, const V3NetVec& mergeMap) : V3NtkHandler(handler) {
    assert (_handler); assert (!_ntk); _c2pMap.clear(); _p2cMap.clear();
-   // Duplicate Ntk
-   _ntk = duplicateNtk(_handler, _p2cMap, _c2pMap); assert (_ntk);
+   // Duplicate Ntk (Nets in mergeMap are Replaced by their Representatives)
+   _ntk = duplicateNtk(_handler, _p2cMap, _c2pMap, mergeMap); assert (_ntk);
    // Duplicate PO
    for (uint32_t i = 0; i < handler->getNtk()->getOutputSize(); ++i) {
       V3NetId id = handler->getNtk()->getOutput(i); assert (V3NetUD != _p2cMap[id.id]);
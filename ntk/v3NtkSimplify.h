@@ -16,7 +16,7 @@ class V3NtkSimplify : public V3NtkHandler
 {
    public : 
       // Constructor and Destructor
-      V3NtkSimplify(V3NtkHandler* const);
+      V3NtkSimplify(V3NtkHandler* const, const V3NetVec& = V3NetVec());
       ~V3NtkSimplify();
       // Net Ancestry Functions
       const V3NetId getParentNetId(const V3NetId&) const;
@@ -181,5 +181,127 @@ void strashAigGate(V3AigNtk* const ntk, const V3NetId& id, V3PortableType& netHa
    if (AIG_FALSE != type) strashAigNodeGate(ntk, id, netHash);
 }
 
+// Level-Parallel Structural Hashing Helper Data and Functions
+// Levels narrower than this are hashed by the calling thread, as spawning workers would cost more.
+const uint32_t V3StrashParallelMinLevelSize = 4096;
+
+struct V3StrashParallelTask {
+   V3Ntk*                  ntk;
+   const V3NetVec*         orderMap;
+   const V3UI32Vec*        orderIdx;   // Index of Each Net in orderMap
+   const V3NetVec*         level;      // AIG_NODEs of the Current Level in orderMap Order
+   V3NetVec*               repMap;     // Representative of Each Net (Parent Ntk)
+   V3Vec<uint64_t>::Vec*   keys;       // Hash Keys of Nets in level
+   V3ConcurrentUI64Hash*   hash;
+   uint32_t                begin, end;
+   uint32_t                merged;
+   bool                    lookup;     // Insert Keys if false, Assign Representatives if true
+};
+
+inline const V3NetId strashAigRepInput(V3Ntk* const ntk, const V3NetVec& repMap, const V3NetId& id, const uint32_t& i) {
+   // Follow Representatives until a Node Represents Itself (Chains Arise from Merges of Later Rounds)
+   V3NetId in = ntk->getInputNetId(id, i); assert (in.id < repMap.size());
+   while (repMap[in.id].id != in.id) in = V3NetId::makeNetId(repMap[in.id].id, repMap[in.id].cp ^ in.cp);
+   return in;
+}
+
+void* strashAigLevelWorker(void* data) {
+   V3StrashParallelTask* const task = (V3StrashParallelTask*)data; assert (task);
+   V3Ntk* const ntk = task->ntk; V3NetVec& repMap = *(task->repMap);
+   const V3NetVec& level = *(task->level); V3Vec<uint64_t>::Vec& keys = *(task->keys);
+   for (uint32_t i = task->begin; i < task->end; ++i) {
+      const V3NetId& id = level[i]; assert (AIG_NODE == ntk->getGateType(id));
+      if (task->lookup) {
+         const uint32_t index = task->hash->find(keys[i]); assert (index <= (*(task->orderIdx))[id.id]);
+         if (index == (*(task->orderIdx))[id.id]) continue;
+         repMap[id.id] = V3NetId::makeNetId((*(task->orderMap))[index].id); ++task->merged;
+      }
+      else {
+         keys[i] = V3UnorderedNetType2HashKey(strashAigRepInput(ntk, repMap, id, 0), strashAigRepInput(ntk, repMap, id, 1));
+         task->hash->insertMin(keys[i], (*(task->orderIdx))[id.id]);
+      }
+   }
+   return 0;
+}
+
+const uint32_t strashAigLevelParallel(V3StrashParallelTask& task, const uint32_t& threads) {
+   assert (threads); const uint32_t size = task.level->size(); task.merged = 0;
+   if (1 == threads || size < V3StrashParallelMinLevelSize) {
+      task.begin = 0; task.end = size; strashAigLevelWorker(&task); return task.merged; }
+   V3Vec<V3StrashParallelTask>::Vec tasks(threads, task);
+   V3Vec<pthread_t>::Vec workers(threads); V3BoolVec spawned(threads, false);
+   const uint32_t chunk = (size + threads - 1) / threads;
+   for (uint32_t i = 0; i < threads; ++i) {
+      tasks[i].begin = (size < i * chunk) ? size : i * chunk;
+      tasks[i].end = (size < tasks[i].begin + chunk) ? size : tasks[i].begin + chunk;
+      spawned[i] = !pthread_create(&workers[i], NULL, strashAigLevelWorker, &tasks[i]);
+      if (!spawned[i]) strashAigLevelWorker(&tasks[i]);  // Fall Back to the Calling Thread
+   }
+   uint32_t merged = 0;
+   for (uint32_t i = 0; i < threads; ++i) {
+      if (spawned[i]) pthread_join(workers[i], NULL); merged += tasks[i].merged; }
+   return merged;
+}
+
+// Level-Parallel Structural Hashing Main Functions
+const bool isAigStrashReps(V3Ntk* const ntk, const V3NetVec& orderMap, const V3NetVec& repMap) {
+   // Check that repMap Maps each AIG_NODE to the First Node in orderMap with the Same Resolved Fanins,
+   // which is the Representative Chosen by Serial Structural Hashing
+   V3HashMap<uint64_t, uint32_t>::Hash firstHash; V3HashMap<uint64_t, uint32_t>::Hash::const_iterator it;
+   for (uint32_t i = 0; i < orderMap.size(); ++i) {
+      const V3NetId& id = orderMap[i];
+      if (AIG_NODE != ntk->getGateType(id)) { if (repMap[id.id] != V3NetId::makeNetId(id.id)) return false; continue; }
+      const uint64_t key = V3UnorderedNetType2HashKey(strashAigRepInput(ntk, repMap, id, 0), strashAigRepInput(ntk, repMap, id, 1));
+      it = firstHash.find(key);
+      if (firstHash.end() == it) { firstHash.insert(make_pair(key, id.id)); if (repMap[id.id] != V3NetId::makeNetId(id.id)) return false; }
+      else if (repMap[id.id] != V3NetId::makeNetId(it->second)) return false;
+   }
+   return true;
+}
+
+// Compute repMap over the Parent Ntk such that each AIG_NODE maps to the first structurally identical node
+// in orderMap.  Nodes of a topological level depend only on lower levels, so each level is hashed in parallel.
+// Levels are computed on resolved fanins, and a merge may lower the levels of its fanouts, leaving equal nodes
+// in different levels where the later level holds the first node.  Rounds are repeated until no level changes.
+// Return the number of merged nodes.
+const uint32_t strashAigNtkParallel(V3Ntk* const ntk, const V3NetVec& orderMap, V3NetVec& repMap, const uint32_t& threads) {
+   assert (ntk); assert (!dynamic_cast<V3BvNtk*>(ntk)); assert (threads);
+   // Initialize Representatives and Indices in orderMap
+   repMap.clear(); repMap.reserve(ntk->getNetSize());
+   for (uint32_t i = 0; i < ntk->getNetSize(); ++i) repMap.push_back(V3NetId::makeNetId(i));
+   V3UI32Vec orderIdx(ntk->getNetSize(), V3NtkUD);
+   for (uint32_t i = 0; i < orderMap.size(); ++i) orderIdx[orderMap[i].id] = i;
+   V3UI32Vec levels(ntk->getNetSize(), 0); V3Vec<uint64_t>::Vec keys; uint32_t merged = 0;
+   while (true) {
+      // Bucket Unmerged AIG_NODEs by Topological Level on Resolved Fanins
+      V3Vec<V3NetVec>::Vec levelList; bool changed = false;
+      for (uint32_t i = 0; i < orderMap.size(); ++i) {
+         const V3NetId& id = orderMap[i]; if (AIG_NODE != ntk->getGateType(id)) continue;
+         // Representatives Precede in orderMap, so One Step Shortens a Chain to its End
+         const V3NetId rep = repMap[id.id];
+         if (rep.id != id.id) { repMap[id.id] = V3NetId::makeNetId(repMap[rep.id].id, repMap[rep.id].cp ^ rep.cp); continue; }
+         const uint32_t l1 = levels[strashAigRepInput(ntk, repMap, id, 0).id];
+         const uint32_t l2 = levels[strashAigRepInput(ntk, repMap, id, 1).id];
+         const uint32_t level = (l1 > l2) ? l1 : l2;
+         if ((1 + level) != levels[id.id]) { levels[id.id] = 1 + level; changed = true; }
+         if (levelList.size() <= level) levelList.resize(1 + level);
+         levelList[level].push_back(id);
+      }
+      // Equal Nodes Share a Level if Levels are Unchanged since the Last Round, so All Merges are Found
+      if (!changed) break;
+      // Hash Level by Level, All Insertions of a Level are Joined before its Lookups
+      V3ConcurrentUI64Hash hash(16 * threads);
+      V3StrashParallelTask task; task.ntk = ntk; task.orderMap = &orderMap; task.orderIdx = &orderIdx;
+      task.repMap = &repMap; task.keys = &keys; task.hash = &hash;
+      for (uint32_t i = 0; i < levelList.size(); ++i) {
+         keys.resize(levelList[i].size()); task.level = &(levelList[i]);
+         task.lookup = false; strashAigLevelParallel(task, threads);
+         task.lookup = true; merged += strashAigLevelParallel(task, threads);
+      }
+   }
+   assert (isAigStrashReps(ntk, orderMap, repMap));
+   return merged;
+}
+
 #endif
 
@@ -33,4 +33,7 @@ const V3NetId strashAigGate(V3AigNtk* const, const V3GateType&, const V3InputVec
 void strashBvGate(V3BvNtk* const, const V3NetId& id, V3PortableType&);
 void strashAigGate(V3AigNtk* const, const V3NetId&, V3PortableType&);
 
+// Level-Parallel Structural Hashing Functions
+const uint32_t strashAigNtkParallel(V3Ntk* const, const V3NetVec&, V3NetVec&, const uint32_t&);
+
 #endif
@@ -47,12 +47,12 @@ const bool reportIncompatibleModule(V3Ntk* const, const V3NetVec&, const V3NetVe
 
 /* GENERAL V3 NTK DUPLICATION FUNCTIONS : Implemented in v3NtkDuplicate.cpp */
 // General Duplication Functions for V3 Ntk  (Note that PO will NOT be created !!)
-V3Ntk* const duplicateNtk(V3NtkHandler* const, V3NetVec&, V3NetVec&);
-V3Ntk* const elaborateNtk(V3NtkHandler* const, const V3NetVec&, V3NetVec&, V3NetVec&, V3PortableType&);
+V3Ntk* const duplicateNtk(V3NtkHandler* const, V3NetVec&, V3NetVec&, const V3NetVec& = V3NetVec());
+V3Ntk* const elaborateNtk(V3NtkHandler* const, const V3NetVec&, V3NetVec&, V3NetVec&, V3PortableType&, const bool& = false);
 V3Ntk* const flattenNtk(V3NtkHandler* const, V3NetVec&, V3NtkHierInfo&, const uint32_t&);
 V3Ntk* const attachToNtk(V3NtkHandler* const, V3Ntk* const, const V3NetVec&, V3NetVec&, V3NetVec&, V3PortableType&);
 // General Gate Type Elaboration Functions for V3 Ntk
-const V3NetId elaborateAigGate(V3AigNtk* const, const V3GateType&, V3InputVec&, V3PortableType&);
+const V3NetId elaborateAigGate(V3AigNtk* const, const V3GateType&, V3InputVec&, V3PortableType&, const bool& = true);
 const V3NetId elaborateBvGate(V3BvNtk* const, const V3GateType&, V3InputVec&, V3PortableType&);
 const V3NetId elaborateAigAndOrAndGate(V3AigNtk* const, V3InputVec&, V3PortableType&);
 
@@ -15,9 +15,12 @@
 /* -------------------------------------------------- *\
  * Class V3SvrBase Implementations
 \* -------------------------------------------------- */
+// Initialization to Static Members
+bool V3SvrBase::_extPolarityEncode = false;
+
 // Constructor and Destructor
 V3SvrBase::V3SvrBase(const V3Ntk* const ntk, const bool& freeBound) : _ntk(ntk), _freeBound(freeBound) {
-   _solves = 0; _runTime = 0;
+   _solves = 0; _runTime = 0; _stat = 0;
 }
 
 V3SvrBase::~V3SvrBase() {
@@ -318,6 +321,12 @@ V3SvrBase::addBoundedVerifyData(const V3NetId& id, const uint32_t& depth) {
    addSimpleBoundedVerifyData(id, depth);
 }
 
+void
+V3SvrBase::addPolarVerifyData(const V3NetId& id, const uint32_t& depth) {
+   // Note : Only id == 1 is Required to be Faithful, Full Encoding by Default
+   addBoundedVerifyData(id, depth);
+}
+
 const bool
 V3SvrBase::existVerifyData(const V3NetId& id, const uint32_t& depth) {
    return false;
@@ -331,6 +340,22 @@ V3SvrBase::assertBoundedVerifyData(const V3NetVec& assertIdVec, const uint32_t&
    }
 }
 
+// Preprocessing Functions
+void
+V3SvrBase::startPreprocess() {
+   // Note : Solvers without a Preprocessor Keep Encoding Directly
+}
+
+void
+V3SvrBase::freezeVerifyData(const V3NetId& id, const uint32_t& depth) {
+   // Note : Only Frozen Nets can be Referred to after preprocess()
+}
+
+const bool
+V3SvrBase::preprocess() {
+   return true;
+}
+
 // Private Network to Solver Functions
 void
 V3SvrBase::addVerifyData(const V3NetId& id, const uint32_t& depth) {
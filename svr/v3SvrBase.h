@@ -12,6 +12,8 @@
 #include "v3Ntk.h"
 #include "v3SvrType.h"
 
+class V3Stat;
+
 // V3SvrBase : Virtual Class for V3 Solver
 class V3SvrBase
 {
@@ -82,13 +84,22 @@ class V3SvrBase
       virtual void add_EQUALITY_Formula(const V3NetId&, const uint32_t&);
       virtual void add_GEQ_Formula(const V3NetId&, const uint32_t&);
       // Network to Solver Functions
-      void addBoundedVerifyData(const V3NetId&, const uint32_t&);
+      virtual void addBoundedVerifyData(const V3NetId&, const uint32_t&);
+      virtual void addPolarVerifyData(const V3NetId&, const uint32_t&);
       virtual const bool existVerifyData(const V3NetId&, const uint32_t&);
       void assertBoundedVerifyData(const V3NetVec&, const uint32_t&);
+      // Preprocessing Functions
+      virtual void startPreprocess();
+      virtual void freezeVerifyData(const V3NetId&, const uint32_t&);
+      virtual const bool preprocess();
       // Inline Base Functions
       inline const uint32_t totalSolves() const { return _solves; }
       inline const double totalTime() const { return _runTime; }
+      inline void setStat(V3Stat* const s) { _stat = s; }
       inline const bool validNetId(const V3NetId& id) const { return _ntk->getNetSize() > id.id; }
+      // Encoding Setting Functions
+      static inline void setPolarityEncode(const bool& p) { _extPolarityEncode = p; }
+      static inline const bool isPolarityEncode() { return _extPolarityEncode; }
    protected : 
       // Private Network to Solver Functions
       void addVerifyData(const V3NetId&, const uint32_t&);
@@ -96,9 +107,12 @@ class V3SvrBase
       // Data Members
       const V3Ntk* const   _ntk;       // Network Under Verification
       uint32_t             _solves;    // Number of Solve Called
-      double               _runTime;   // Total Runtime in Solving
+      double               _runTime;   // Total Runtime in Solving (Thread CPU Time)
+      V3Stat*              _stat;      // Statistic to Count SAT Calls and Conflicts (NULL if Disabled)
       // Configurations
       const bool           _freeBound; // Set FF Bounds Free
+      // Static Members
+      static bool          _extPolarityEncode;  // Polarity-aware Clustered CNF for AIG Ntk
 };
 
 #endif
@@ -10,6 +10,7 @@
 #define BV_SVR_BOOLECTOR_C
 
 #include "v3Msg.h"
+#include "v3Usage.h"
 #include "v3SvrBoolector.h"
 
 /* -------------------------------------------------- *\
@@ -118,9 +119,10 @@ V3SvrBoolector::simplify() {
 
 const bool
 V3SvrBoolector::solve() {
-   double ctime = (double)clock() / CLOCKS_PER_SEC;
+   const uint64_t ctime = getV3ThreadClockNs();
    uint32_t result = boolector_sat(_Solver); ++_solves;
-   _runTime += (((double)clock() / CLOCKS_PER_SEC) - ctime);
+   _runTime += ((getV3ThreadClockNs() - ctime) / 1e9);
+   if (_stat) _stat->count(V3_STAT_SAT_CALL);
    return (BOOLECTOR_SAT == result);
 }
 
@@ -0,0 +1,394 @@
+/****************************************************************************
+  FileName     [ v3SvrCnfSimp.cpp ]
+  PackageName  [ v3/src/svr ]
+  Synopsis     [ CNF Preprocessor for V3 MiniSat Solver. ]
+  Author       [ Cheng-Yin Wu ]
+  Copyright    [ Copyright(c) 2012-2014 DVLab, GIEE, NTU, Taiwan ]
+****************************************************************************/
+
+#ifndef V3_SVR_CNF_SIMP_C
+#define V3_SVR_CNF_SIMP_C
+
+#include "v3Msg.h"
+#include "v3SvrCnfSimp.h"
+
+#include <algorithm>
+
+// Limits of Preprocessing
+const uint32_t V3SvrCnfResolventLimit = 20;     // Maximum Size of a Resolvent
+const uint32_t V3SvrCnfElimProduct    = 256;    // Maximum #Pos x #Neg Occurrences for Elimination
+const uint32_t V3SvrCnfSubsumeLimit   = 1000;   // Maximum Occurrences Scanned for Subsumption
+
+// Return Values of getV3SvrCnfSubsume()
+const uint32_t V3SvrCnfSubsumed   = V3NtkUD;       // C Subsumes D
+const uint32_t V3SvrCnfUnrelated  = V3NtkUD - 1;   // Neither Subsumption nor Strengthening
+
+// Literal Conversion Helper Functions
+static inline const uint32_t getV3SvrCnfLit(const Lit& p) {
+   return (((uint32_t)var(p)) << 1) | (sign(p) ? 1 : 0); }
+static inline const Lit getV3SvrMLit(const uint32_t& l) {
+   return mkLit((Var)(l >> 1), l & 1); }
+
+static inline const uint64_t getV3SvrCnfSig(const V3UI32Vec& lits) {
+   uint64_t sig = 0; for (uint32_t i = 0; i < lits.size(); ++i) sig |= (1ull << ((lits[i] >> 1) & 63)); return sig; }
+
+// Sort Literals, Remove Duplicates and Return false for Tautologies
+static inline const bool normalizeV3SvrCnfLits(V3UI32Vec& lits) {
+   std::sort(lits.begin(), lits.end()); uint32_t j = 0;
+   for (uint32_t i = 0; i < lits.size(); ++i) {
+      if (j && lits[j - 1] == lits[i]) continue;
+      if (j && lits[j - 1] == (lits[i] ^ 1)) return false;
+      lits[j++] = lits[i];
+   }
+   lits.resize(j); return true;
+}
+
+// Test if Sorted Clause c Subsumes Sorted Clause d, Allowing One Literal of c to Appear Negated in d
+// Returns V3SvrCnfSubsumed, V3SvrCnfUnrelated, or the Literal of c whose Negation can be Removed from d
+static inline const uint32_t getV3SvrCnfSubsume(const V3UI32Vec& c, const V3UI32Vec& d) {
+   uint32_t flip = V3SvrCnfSubsumed;
+   for (uint32_t i = 0, j = 0; i < c.size(); ++i, ++j) {
+      while (j < d.size() && (d[j] >> 1) < (c[i] >> 1)) ++j;
+      if (j == d.size() || (d[j] >> 1) != (c[i] >> 1)) return V3SvrCnfUnrelated;
+      if (d[j] == c[i]) continue;
+      if (V3SvrCnfSubsumed != flip) return V3SvrCnfUnrelated;
+      flip = c[i];
+   }
+   return flip;
+}
+
+/* -------------------------------------------------- *\
+ * Class V3SvrCnfSimp Implementations
+\* -------------------------------------------------- */
+// Constructor and Destructor
+V3SvrCnfSimp::V3SvrCnfSimp() {
+   _clauses.clear(); _occurs.clear(); _value.clear(); _frozen.clear(); _elim.clear();
+   _trail.clear(); _qhead = 0; _subQueue.clear(); _elimStack.clear(); _ok = true; _done = false;
+   _inClauses = _nSubst = _nElim = _nSubsumed = _nStrength = 0;
+}
+
+V3SvrCnfSimp::~V3SvrCnfSimp() {
+   _clauses.clear(); _occurs.clear(); _value.clear(); _frozen.clear(); _elim.clear();
+   _trail.clear(); _subQueue.clear(); _elimStack.clear();
+}
+
+// Clause Buffering Functions
+void
+V3SvrCnfSimp::addClause(const vec<Lit>& lits) {
+   assert (!_done); ++_inClauses; if (!_ok) return;
+   V3UI32Vec cls(lits.size());
+   for (int i = 0; i < lits.size(); ++i) { cls[i] = getV3SvrCnfLit(lits[i]); growVar(var(lits[i])); }
+   if (!normalizeV3SvrCnfLits(cls)) return;
+   if (!cls.size()) _ok = false;
+   else if (1 == cls.size()) { if (!enqueue(cls[0])) _ok = false; }
+   else attachClause(cls);
+}
+
+// Preprocessing Functions
+const bool
+V3SvrCnfSimp::simplify() {
+   assert (!_done); _done = true;
+   // Occurrence Lists are Built Here, the Buffering Phase Only Appends Clauses
+   buildOccurs();
+   if (!_ok || !propagate()) return (_ok = false);
+   if (!substitute() || !propagate()) return (_ok = false);
+   if (!subsume()) return (_ok = false);
+   // Eliminate Cheap Variables First
+   V3Vec<pair<uint32_t, uint32_t> >::Vec order; order.reserve(_value.size());
+   for (uint32_t v = 0; v < _value.size(); ++v) {
+      if (_frozen[v] || _elim[v] || _value[v]) continue;
+      order.push_back(make_pair(_occurs[v << 1].size() * _occurs[1 | (v << 1)].size(), v));
+   }
+   std::sort(order.begin(), order.end());
+   for (uint32_t i = 0; i < order.size(); ++i) if (!eliminate(order[i].second)) return (_ok = false);
+   // Release Occurrence Lists, Clauses will be Exported to the Solver
+   _occurs.clear(); _subQueue.clear(); return true;
+}
+
+void
+V3SvrCnfSimp::exportClauses(MSolver* const solver) const {
+   assert (solver); assert (_done); vec<Lit> lits;
+   if (!_ok) { lits.clear(); solver->addClause(lits); return; }
+   for (uint32_t i = 0; i < _trail.size(); ++i) solver->addClause(getV3SvrMLit(_trail[i]));
+   for (uint32_t i = 0; i < _clauses.size(); ++i) {
+      if (_clauses[i].removed) continue; lits.clear();
+      for (uint32_t j = 0; j < _clauses[i].lits.size(); ++j) lits.push(getV3SvrMLit(_clauses[i].lits[j]));
+      solver->addClause(lits);
+   }
+}
+
+void
+V3SvrCnfSimp::extendModel(vec<lbool>& model) const {
+   // Removed Clauses are Visited in Reverse, and an Unsatisfied One Flips its Pivot
+   uint32_t i = _elimStack.size(), size, j; Var v;
+   while (i) {
+      size = _elimStack[--i]; assert (size && size <= i); i -= size;
+      for (j = 0; j < size; ++j) {
+         v = (Var)(_elimStack[i + j] >> 1); if (v >= model.size()) continue;
+         if ((_elimStack[i + j] & 1) ? (l_False == model[v]) : (l_True == model[v])) break;
+      }
+      if (j < size) continue; v = (Var)(_elimStack[i] >> 1);
+      if (v < model.size()) model[v] = (_elimStack[i] & 1) ? l_False : l_True;
+   }
+}
+
+// Print Data Functions
+void
+V3SvrCnfSimp::printInfo() const {
+   Msg(MSG_IFO) << "#InCls = " << _inClauses << ", #Subst = " << _nSubst << ", #Elim = " << _nElim
+                << ", #Subsumed = " << _nSubsumed << ", #Strengthened = " << _nStrength;
+}
+
+// Private Clause Functions
+void
+V3SvrCnfSimp::growVar(const Var& v) {
+   assert (v >= 0); if ((uint32_t)v < _value.size()) return;
+   _value.resize(1 + v, 0); _frozen.resize(1 + v, 0); _elim.resize(1 + v, 0);
+}
+
+const uint32_t
+V3SvrCnfSimp::attachClause(V3UI32Vec& lits) {
+   assert (lits.size() > 1); const uint32_t id = _clauses.size();
+   _clauses.push_back(V3SvrCnfClause()); V3SvrCnfClause& cls = _clauses.back();
+   cls.lits.swap(lits); cls.sig = getV3SvrCnfSig(cls.lits); cls.removed = false;
+   if (_done) {
+      for (uint32_t i = 0; i < cls.lits.size(); ++i) _occurs[cls.lits[i]].push_back(id);
+      _subQueue.push_back(id);
+   }
+   return id;
+}
+
+void
+V3SvrCnfSimp::removeClause(const uint32_t& id) {
+   // Occurrence Lists are Cleaned Lazily
+   assert (id < _clauses.size()); assert (!_clauses[id].removed);
+   _clauses[id].removed = true; V3UI32Vec().swap(_clauses[id].lits);
+}
+
+void
+V3SvrCnfSimp::strengthenClause(const uint32_t& id, const uint32_t& l) {
+   assert (id < _clauses.size()); assert (!_clauses[id].removed);
+   V3SvrCnfClause& cls = _clauses[id];
+   V3UI32Vec::iterator it = std::find(cls.lits.begin(), cls.lits.end(), l);
+   assert (cls.lits.end() != it); cls.lits.erase(it);
+   it = std::find(_occurs[l].begin(), _occurs[l].end(), id);
+   assert (_occurs[l].end() != it); _occurs[l].erase(it);
+   if (1 == cls.lits.size()) { const uint32_t unit = cls.lits[0]; removeClause(id); if (!enqueue(unit)) _ok = false; }
+   else { cls.sig = getV3SvrCnfSig(cls.lits); _subQueue.push_back(id); }
+}
+
+void
+V3SvrCnfSimp::cleanOccurs(const uint32_t& l) {
+   V3UI32Vec& occ = _occurs[l]; uint32_t j = 0;
+   for (uint32_t i = 0; i < occ.size(); ++i) if (!_clauses[occ[i]].removed) occ[j++] = occ[i];
+   occ.resize(j);
+}
+
+void
+V3SvrCnfSimp::buildOccurs() {
+   _occurs.clear(); _occurs.resize(_value.size() << 1);
+   for (uint32_t i = 0; i < _clauses.size(); ++i) {
+      if (_clauses[i].removed) continue;
+      for (uint32_t j = 0; j < _clauses[i].lits.size(); ++j) _occurs[_clauses[i].lits[j]].push_back(i);
+   }
+}
+
+const bool
+V3SvrCnfSimp::enqueue(const uint32_t& l) {
+   const unsigned char value = getLitValue(l);
+   if (value) return 1 == value;
+   _value[l >> 1] = (l & 1) ? 2 : 1; _trail.push_back(l); return true;
+}
+
+const bool
+V3SvrCnfSimp::propagate() {
+   assert (_done);
+   while (_ok && _qhead < _trail.size()) {
+      const uint32_t l = _trail[_qhead++];
+      // Satisfied Clauses are Removed
+      V3UI32Vec& occ = _occurs[l];
+      for (uint32_t i = 0; i < occ.size(); ++i) if (!_clauses[occ[i]].removed) removeClause(occ[i]);
+      V3UI32Vec().swap(occ);
+      // Falsified Literals are Removed (strengthenClause() Modifies the List)
+      const V3UI32Vec negOcc = _occurs[l ^ 1];
+      for (uint32_t i = 0; i < negOcc.size() && _ok; ++i)
+         if (!_clauses[negOcc[i]].removed) strengthenClause(negOcc[i], l ^ 1);
+   }
+   return _ok;
+}
+
+// Private Simplification Functions
+const bool
+V3SvrCnfSimp::substitute() {
+   // Equivalent Literals are Strongly Connected Components of the Binary Implication Graph
+   const uint32_t litSize = _value.size() << 1;
+   V3UI32Vec start(1 + litSize, 0), edge;
+   for (uint32_t i = 0; i < _clauses.size(); ++i) {
+      if (_clauses[i].removed || 2 != _clauses[i].lits.size()) continue;
+      ++start[1 + (_clauses[i].lits[0] ^ 1)]; ++start[1 + (_clauses[i].lits[1] ^ 1)];
+   }
+   for (uint32_t l = 0; l < litSize; ++l) start[1 + l] += start[l];
+   if (!start[litSize]) return true;
+   edge.resize(start[litSize]); V3UI32Vec fill(start.begin(), start.end() - 1);
+   for (uint32_t i = 0; i < _clauses.size(); ++i) {
+      if (_clauses[i].removed || 2 != _clauses[i].lits.size()) continue;
+      const uint32_t a = _clauses[i].lits[0], b = _clauses[i].lits[1];
+      edge[fill[a ^ 1]++] = b; edge[fill[b ^ 1]++] = a;
+   }
+   // Iterative Tarjan's Algorithm
+   V3UI32Vec index(litSize, V3NtkUD), low(litSize, 0), repr(litSize, V3NtkUD), sccStack, pos;
+   V3Vec<unsigned char>::Vec onStack(litSize, 0); V3UI32Vec callStack; uint32_t curIndex = 0;
+   for (uint32_t s = 0; s < litSize; ++s) {
+      if (V3NtkUD != index[s] || start[s] == start[1 + s]) continue;
+      index[s] = low[s] = curIndex++; sccStack.push_back(s); onStack[s] = 1;
+      callStack.push_back(s); pos.push_back(start[s]);
+      while (callStack.size()) {
+         const uint32_t v = callStack.back();
+         if (pos.back() < start[1 + v]) {
+            const uint32_t w = edge[pos.back()++];
+            if (V3NtkUD == index[w]) {
+               index[w] = low[w] = curIndex++; sccStack.push_back(w); onStack[w] = 1;
+               callStack.push_back(w); pos.push_back(start[w]);
+            }
+            else if (onStack[w] && index[w] < low[v]) low[v] = index[w];
+            continue;
+         }
+         callStack.pop_back(); pos.pop_back();
+         if (callStack.size() && low[v] < low[callStack.back()]) low[callStack.back()] = low[v];
+         if (low[v] != index[v]) continue;
+         // Pop the Component, the Complementary Component may have Set the Representatives
+         uint32_t i = sccStack.size(); while (sccStack[--i] != v) ;
+         const uint32_t begin = i; uint32_t r = sccStack[begin];
+         for (i = begin; i < sccStack.size(); ++i) {
+            // Members of the Component are Exactly the Nodes on Stack Indexed from v
+            if (onStack[sccStack[i] ^ 1] && index[sccStack[i] ^ 1] >= index[v]) return false;
+            if (_frozen[sccStack[i] >> 1]) r = sccStack[i];
+         }
+         for (i = begin; i < sccStack.size(); ++i) onStack[sccStack[i]] = 0;
+         if (V3NtkUD == repr[v]) {
+            for (i = begin; i < sccStack.size(); ++i) {
+               const uint32_t l = sccStack[i];
+               // Frozen Vars Keep Themselves, Equivalence Remains in the Binary Clauses
+               if ((r >> 1) != (l >> 1) && _frozen[l >> 1]) { repr[l] = l; repr[l ^ 1] = l ^ 1; }
+               else { repr[l] = r; repr[l ^ 1] = r ^ 1; }
+            }
+         }
+         sccStack.resize(begin);
+      }
+   }
+   // Record Substituted Vars for extendModel()
+   V3UI32Vec eqv(2);
+   for (uint32_t v = 0; v < _value.size(); ++v) {
+      const uint32_t r = repr[v << 1]; if (V3NtkUD == r || v == (r >> 1)) continue;
+      assert (!_frozen[v]); assert (!_elim[v]); assert (!_value[v]); _elim[v] = 1; ++_nSubst;
+      eqv[0] = v << 1; eqv[1] = r ^ 1; pushElimClause(v << 1, eqv);
+      eqv[0] = 1 | (v << 1); eqv[1] = r; pushElimClause(1 | (v << 1), eqv);
+   }
+   if (!_nSubst) return true;
+   // Rewrite Clauses with Representatives
+   for (uint32_t i = 0; i < _clauses.size(); ++i) {
+      if (_clauses[i].removed) continue;
+      V3UI32Vec& lits = _clauses[i].lits; bool changed = false;
+      for (uint32_t j = 0; j < lits.size(); ++j)
+         if (V3NtkUD != repr[lits[j]] && repr[lits[j]] != lits[j]) { lits[j] = repr[lits[j]]; changed = true; }
+      if (!changed) continue;
+      if (!normalizeV3SvrCnfLits(lits)) { removeClause(i); continue; }
+      if (1 == lits.size()) { const uint32_t unit = lits[0]; removeClause(i); if (!enqueue(unit)) return false; }
+      else _clauses[i].sig = getV3SvrCnfSig(lits);
+   }
+   buildOccurs(); return true;
+}
+
+const bool
+V3SvrCnfSimp::subsume() {
+   _subQueue.clear();
+   for (uint32_t i = 0; i < _clauses.size(); ++i) if (!_clauses[i].removed) _subQueue.push_back(i);
+   while (_subQueue.size()) {
+      const uint32_t id = _subQueue.back(); _subQueue.pop_back();
+      if (!backwardSubsume(id) || !propagate()) return false;
+   }
+   return true;
+}
+
+const bool
+V3SvrCnfSimp::backwardSubsume(const uint32_t& id) {
+   if (_clauses[id].removed) return true;
+   // Candidates Contain the Var of c with the Fewest Occurrences
+   const V3UI32Vec& c = _clauses[id].lits; uint32_t best = c[0];
+   for (uint32_t i = 1; i < c.size(); ++i)
+      if ((_occurs[c[i]].size() + _occurs[c[i] ^ 1].size()) < (_occurs[best].size() + _occurs[best ^ 1].size())) best = c[i];
+   if ((_occurs[best].size() + _occurs[best ^ 1].size()) > V3SvrCnfSubsumeLimit) return true;
+   for (uint32_t k = 0; k < 2; ++k) {
+      const V3UI32Vec occ = _occurs[best ^ k];
+      for (uint32_t i = 0; i < occ.size(); ++i) {
+         if (_clauses[id].removed) return true;
+         const uint32_t d = occ[i]; if (d == id || _clauses[d].removed) continue;
+         if (_clauses[d].lits.size() < c.size() || (_clauses[id].sig & ~_clauses[d].sig)) continue;
+         const uint32_t l = getV3SvrCnfSubsume(c, _clauses[d].lits);
+         if (V3SvrCnfSubsumed == l) { removeClause(d); ++_nSubsumed; }
+         else if (V3SvrCnfUnrelated != l) { strengthenClause(d, l ^ 1); ++_nStrength; if (!_ok) return false; }
+      }
+   }
+   return true;
+}
+
+const bool
+V3SvrCnfSimp::eliminate(const uint32_t& v) {
+   if (_frozen[v] || _elim[v] || _value[v]) return true;
+   const uint32_t p = v << 1; cleanOccurs(p); cleanOccurs(p ^ 1);
+   const V3UI32Vec pos = _occurs[p], neg = _occurs[p ^ 1];
+   if (!pos.size() && !neg.size()) return true;
+   if ((pos.size() * neg.size()) > V3SvrCnfElimProduct) return true;
+   // Elimination must not Increase the Number of Clauses
+   V3UI32Vec resolvent; uint32_t count = 0;
+   for (uint32_t i = 0; i < pos.size(); ++i)
+      for (uint32_t j = 0; j < neg.size(); ++j) {
+         if (!resolve(_clauses[pos[i]].lits, _clauses[neg[j]].lits, v, resolvent)) continue;
+         if (++count > (pos.size() + neg.size()) || resolvent.size() > V3SvrCnfResolventLimit) return true;
+      }
+   // Move Clauses of v to the Elimination Stack and Add Resolvents
+   V3Vec<V3UI32Vec>::Vec resolvents; resolvents.reserve(count);
+   for (uint32_t i = 0; i < pos.size(); ++i)
+      for (uint32_t j = 0; j < neg.size(); ++j)
+         if (resolve(_clauses[pos[i]].lits, _clauses[neg[j]].lits, v, resolvent)) resolvents.push_back(resolvent);
+   for (uint32_t i = 0; i < pos.size(); ++i) { pushElimClause(p, _clauses[pos[i]].lits); removeClause(pos[i]); }
+   for (uint32_t i = 0; i < neg.size(); ++i) { pushElimClause(p ^ 1, _clauses[neg[i]].lits); removeClause(neg[i]); }
+   V3UI32Vec().swap(_occurs[p]); V3UI32Vec().swap(_occurs[p ^ 1]); _elim[v] = 1; ++_nElim;
+   for (uint32_t i = 0; i < resolvents.size(); ++i) {
+      assert (resolvents[i].size());
+      if (1 == resolvents[i].size()) { if (!enqueue(resolvents[i][0])) return false; }
+      else attachClause(resolvents[i]);
+   }
+   if (!propagate()) return false;
+   while (_subQueue.size()) {
+      const uint32_t id = _subQueue.back(); _subQueue.pop_back();
+      if (!backwardSubsume(id) || !propagate()) return false;
+   }
+   return true;
+}
+
+const bool
+V3SvrCnfSimp::resolve(const V3UI32Vec& a, const V3UI32Vec& b, const uint32_t& v, V3UI32Vec& resolvent) const {
+   // Merge Two Sorted Clauses on Pivot v, Returns false for Tautologies
+   resolvent.clear(); uint32_t i = 0, j = 0;
+   while (i < a.size() || j < b.size()) {
+      if (i < a.size() && (a[i] >> 1) == v) { ++i; continue; }
+      if (j < b.size() && (b[j] >> 1) == v) { ++j; continue; }
+      if (j == b.size() || (i < a.size() && a[i] < b[j])) resolvent.push_back(a[i++]);
+      else if (i == a.size() || b[j] < a[i]) resolvent.push_back(b[j++]);
+      else { resolvent.push_back(a[i]); ++i; ++j; }
+      if (resolvent.size() > 1 && (resolvent[resolvent.size() - 2] ^ 1) == resolvent.back()) return false;
+   }
+   return true;
+}
+
+void
+V3SvrCnfSimp::pushElimClause(const uint32_t& pivot, const V3UI32Vec& lits) {
+   assert (lits.end() != std::find(lits.begin(), lits.end(), pivot));
+   _elimStack.push_back(pivot);
+   for (uint32_t i = 0; i < lits.size(); ++i) if (pivot != lits[i]) _elimStack.push_back(lits[i]);
+   _elimStack.push_back(lits.size());
+}
+
+#endif
+
@@ -0,0 +1,90 @@
+/****************************************************************************
+  FileName     [ v3SvrCnfSimp.h ]
+  PackageName  [ v3/src/svr ]
+  Synopsis     [ CNF Preprocessor for V3 MiniSat Solver. ]
+  Author       [ Cheng-Yin Wu ]
+  Copyright    [ Copyright(c) 2012-2014 DVLab, GIEE, NTU, Taiwan ]
+****************************************************************************/
+
+#ifndef V3_SVR_CNF_SIMP_H
+#define V3_SVR_CNF_SIMP_H
+
+#include "v3SvrType.h"
+
+// struct V3SvrCnfClause : Clause of V3SvrCnfSimp
+struct V3SvrCnfClause {
+   V3UI32Vec   lits;       // Sorted Literal Indices (var << 1 | sign)
+   uint64_t    sig;        // Variable Signature for Subsumption Tests
+   bool        removed;
+};
+
+// class V3SvrCnfSimp : CNF Preprocessor for MiniSat
+// Clauses are buffered here before they reach the solver, and are simplified by
+// unit propagation, equivalent literal substitution, subsumption (with self-subsuming
+// resolution) and bounded variable elimination.
+// Frozen variables are never substituted or eliminated, so they can still be assumed
+// or asserted after preprocessing. Removed variables are recovered by extendModel().
+class V3SvrCnfSimp
+{
+   public :
+      // Constructor and Destructor
+      V3SvrCnfSimp();
+      ~V3SvrCnfSimp();
+      // Clause Buffering Functions
+      void addClause(const vec<Lit>&);
+      inline void addClause(const Lit& a) { _tmpLits.clear(); _tmpLits.push(a); addClause(_tmpLits); }
+      inline void addClause(const Lit& a, const Lit& b) {
+         _tmpLits.clear(); _tmpLits.push(a); _tmpLits.push(b); addClause(_tmpLits); }
+      inline void setFrozen(const Var& v) { growVar(v); _frozen[v] = 1; }
+      // Preprocessing Functions
+      const bool simplify();
+      void exportClauses(MSolver* const) const;
+      void extendModel(vec<lbool>&) const;
+      // Inline Member Functions
+      inline const bool isBuffering() const { return !_done; }
+      inline const bool isEliminated(const Var& v) const { return (uint32_t)v < _elim.size() && _elim[v]; }
+      // Print Data Functions
+      void printInfo() const;
+   private :
+      // Private Clause Functions
+      void growVar(const Var&);
+      const uint32_t attachClause(V3UI32Vec&);
+      void removeClause(const uint32_t&);
+      void strengthenClause(const uint32_t&, const uint32_t&);
+      void cleanOccurs(const uint32_t&);
+      void buildOccurs();
+      const bool enqueue(const uint32_t&);
+      const bool propagate();
+      // Private Simplification Functions
+      const bool substitute();
+      const bool subsume();
+      const bool backwardSubsume(const uint32_t&);
+      const bool eliminate(const uint32_t&);
+      const bool resolve(const V3UI32Vec&, const V3UI32Vec&, const uint32_t&, V3UI32Vec&) const;
+      void pushElimClause(const uint32_t&, const V3UI32Vec&);
+      // Private Helper Functions
+      inline const unsigned char getLitValue(const uint32_t& l) const {
+         return _value[l >> 1] ? (((1 == _value[l >> 1]) ^ (l & 1)) ? 1 : 2) : 0; }
+      // Data Members
+      V3Vec<V3SvrCnfClause>::Vec _clauses;   // Clause Database
+      V3Vec<V3UI32Vec>::Vec      _occurs;    // Clauses Containing Each Literal (Lazily Cleaned)
+      V3Vec<unsigned char>::Vec  _value;     // Fixed Value of Each Var (1 : True, 2 : False)
+      V3Vec<unsigned char>::Vec  _frozen;    // Vars that must be Kept
+      V3Vec<unsigned char>::Vec  _elim;      // Vars Substituted or Eliminated
+      V3UI32Vec                  _trail;     // Literals Fixed to True
+      uint32_t                   _qhead;     // Propagation Head of _trail
+      V3UI32Vec                  _subQueue;  // Clauses to be Tested for Backward Subsumption
+      V3UI32Vec                  _elimStack; // Removed Clauses (Pivot First, then Size) for extendModel()
+      vec<Lit>                   _tmpLits;   // Buffer for Small Clauses
+      bool                       _ok;        // False if the CNF is Proven UNSAT
+      bool                       _done;      // Clauses are Directly Sent to the Solver after Preprocessing
+      // Statistics
+      uint32_t                   _inClauses; // Number of Buffered Clauses
+      uint32_t                   _nSubst;    // Number of Substituted Vars
+      uint32_t                   _nElim;     // Number of Eliminated Vars
+      uint32_t                   _nSubsumed; // Number of Subsumed Clauses
+      uint32_t                   _nStrength; // Number of Strengthened Clauses
+};
+
+#endif
+
@@ -10,6 +10,7 @@
 #define V3_SVR_MSAT_C
 
 #include "v3Msg.h"
+#include "v3Usage.h"
 #include "v3SvrMiniSat.h"
 #include "v3SvrSatHelper.h"
 
@@ -20,20 +21,25 @@
 V3SvrMiniSat::V3SvrMiniSat(const V3Ntk* const ntk, const bool& freeBound) : V3SvrBase(ntk, freeBound) {
    _Solver = new MSolver(); assert (_Solver); assumeRelease(); initRelease();
    _curVar = 0; _Solver->newVar(l_Undef, false); ++_curVar;  // 0 for Recycle Literal, if Needed
-   _ntkData.clear(); _ntkData.reserve(ntk->getNetSize());
-   for (uint32_t i = 0; i < ntk->getNetSize(); ++i) { _ntkData.push_back(V3SvrMVarData()); _ntkData.back().clear(); }
+   _ntkSlot = V3UI32Vec(ntk->getNetSize(), V3NtkUD); _slotSize = 0; _ntkData.clear();
+   _polarity = isPolarityEncode() && !dynamic_cast<const V3BvNtk*>(ntk); _ntkPhase.clear();
+   if (_polarity) initPolarData(); else _fanout.clear();
+   _simp = 0; _memClauses = 0;
 }
 
 V3SvrMiniSat::V3SvrMiniSat(const V3SvrMiniSat& solver) : V3SvrBase(solver._ntk, solver._freeBound) {
    _Solver = new MSolver(); assert (_Solver); assumeRelease(); initRelease();
    _curVar = 0; _Solver->newVar(l_Undef, false); ++_curVar;  // 0 for Recycle Literal, if Needed
-   _ntkData.clear(); _ntkData.reserve(_ntk->getNetSize());
-   for (uint32_t i = 0; i < _ntk->getNetSize(); ++i) { _ntkData.push_back(V3SvrMVarData()); _ntkData.back().clear(); }
+   _ntkSlot = solver._ntkSlot; _slotSize = solver._slotSize; _ntkData.clear();
+   assert (_ntk->getNetSize() >= _ntkSlot.size()); _ntkSlot.resize(_ntk->getNetSize(), V3NtkUD);
+   _polarity = solver._polarity; _fanout = solver._fanout; _ntkPhase.clear();
+   if (_polarity && _fanout.size() != _ntk->getNetSize()) initPolarData();
+   _simp = 0; _memClauses = 0;
 }
 
 V3SvrMiniSat::~V3SvrMiniSat() {
-   delete _Solver; assumeRelease(); initRelease();
-   for (uint32_t i = 0; i < _ntkData.size(); ++i) _ntkData[i].clear(); _ntkData.clear();
+   delete _Solver; assumeRelease(); initRelease(); if (_simp) delete _simp;
+   _ntkSlot.clear(); _ntkData.clear(); _fanout.clear(); _ntkPhase.clear();
 }
 
 // Basic Operation Functions
@@ -41,15 +47,17 @@ void
 V3SvrMiniSat::reset() {
    delete _Solver; _Solver = new MSolver(); assert (_Solver); assumeRelease(); initRelease();
    _curVar = 0; _Solver->newVar(l_Undef, false); ++_curVar;  // 0 for Recycle Literal, if Needed
-   for (uint32_t i = 0; i < _ntkData.size(); ++i) _ntkData[i].clear();
-   if (_ntkData.size() == _ntk->getNetSize()) return; _ntkData.clear(); _ntkData.reserve(_ntk->getNetSize());
-   for (uint32_t i = 0; i < _ntk->getNetSize(); ++i) { _ntkData.push_back(V3SvrMVarData()); _ntkData.back().clear(); }
+   // Slots of Nets are Kept, Only the Frames are Released
+   _ntkData.clear(); _ntkSlot.resize(_ntk->getNetSize(), V3NtkUD); _ntkPhase.clear();
+   if (_polarity && _fanout.size() != _ntk->getNetSize()) initPolarData();
+   if (_simp) { delete _simp; _simp = 0; } _memClauses = 0;
 }
 
 void
 V3SvrMiniSat::update() {
-   assert (_Solver); assert (_ntk->getNetSize() >= _ntkData.size());
-   V3SvrMVarData svrData; svrData.clear(); _ntkData.resize(_ntk->getNetSize(), svrData);
+   assert (_Solver); assert (_ntk->getNetSize() >= _ntkSlot.size());
+   _ntkSlot.resize(_ntk->getNetSize(), V3NtkUD);
+   if (_polarity && _fanout.size() != _ntk->getNetSize()) initPolarData();
 }
 
 void
@@ -59,7 +67,7 @@ V3SvrMiniSat::assumeInit() {
 
 void
 V3SvrMiniSat::assertInit() {
-   for (uint32_t i = 0; i < _init.size(); ++i) _Solver->addClause(_init[i]);
+   for (uint32_t i = 0; i < _init.size(); ++i) addClause(_init[i]);
 }
 
 void
@@ -70,18 +78,18 @@ V3SvrMiniSat::assumeRelease() { _assump.clear(); }
 
 void
 V3SvrMiniSat::assumeProperty(const size_t& var, const bool& invert) {
-   _assump.push(mkLit(getOriVar(var), invert ^ isNegFormula(var)));
+   assert (!isEliminatedVar(getOriVar(var))); _assump.push(mkLit(getOriVar(var), invert ^ isNegFormula(var)));
 }
 
 void
 V3SvrMiniSat::assertProperty(const size_t& var, const bool& invert) {
-   _Solver->addClause(mkLit(getOriVar(var), invert ^ isNegFormula(var)));
+   addClause(mkLit(getOriVar(var), invert ^ isNegFormula(var)));
 }
 
 void
 V3SvrMiniSat::assumeProperty(const V3NetId& id, const bool& invert, const uint32_t& depth) {
    assert (validNetId(id)); assert (1 == _ntk->getNetWidth(id));
-   const Var var = getVerifyData(id, depth); assert (var);
+   const Var var = getVerifyData(id, depth); assert (var); assert (!isEliminatedVar(var));
    _assump.push(mkLit(var, invert ^ isV3NetInverted(id)));
 }
 
@@ -89,7 +97,7 @@ void
 V3SvrMiniSat::assertProperty(const V3NetId& id, const bool& invert, const uint32_t& depth) {
    assert (validNetId(id)); assert (1 == _ntk->getNetWidth(id));
    const Var var = getVerifyData(id, depth); assert (var);
-   _Solver->addClause(mkLit(var, invert ^ isV3NetInverted(id)));
+   addClause(mkLit(var, invert ^ isV3NetInverted(id)));
 }
 
 const bool
@@ -97,18 +105,30 @@ V3SvrMiniSat::simplify() { return _Solver->simplify(); }
 
 const bool
 V3SvrMiniSat::solve() {
-   double ctime = (double)clock() / CLOCKS_PER_SEC;
+   if (_simp && _simp->isBuffering()) preprocess();
+   const uint64_t ctime = getV3ThreadClockNs(), conflicts = _Solver->conflicts, propagations = _Solver->propagations;
    _Solver->solve(); ++_solves;
-   _runTime += (((double)clock() / CLOCKS_PER_SEC) - ctime);
-   return _Solver->okay();
+   _runTime += ((getV3ThreadClockNs() - ctime) / 1e9);
+   if (_stat) {
+      _stat->count(V3_STAT_SAT_CALL); _stat->count(V3_STAT_CONFLICT, _Solver->conflicts - conflicts);
+      _stat->count(V3_STAT_PROPAGATION, _Solver->propagations - propagations);
+   }
+   if (_simp && _Solver->okay()) _simp->extendModel(_Solver->model);
+   accountMemory(); return _Solver->okay();
 }
 
 const bool
 V3SvrMiniSat::assump_solve() {
-   double ctime = (double)clock() / CLOCKS_PER_SEC;
+   if (_simp && _simp->isBuffering()) preprocess();
+   const uint64_t ctime = getV3ThreadClockNs(), conflicts = _Solver->conflicts, propagations = _Solver->propagations;
    bool result = _Solver->solve(_assump); ++_solves;
-   _runTime += (((double)clock() / CLOCKS_PER_SEC) - ctime);
-   return result;
+   _runTime += ((getV3ThreadClockNs() - ctime) / 1e9);
+   if (_stat) {
+      _stat->count(V3_STAT_SAT_CALL); _stat->count(V3_STAT_CONFLICT, _Solver->conflicts - conflicts);
+      _stat->count(V3_STAT_PROPAGATION, _Solver->propagations - propagations);
+   }
+   if (_simp && result) _simp->extendModel(_Solver->model);
+   accountMemory(); return result;
 }
 
 // Manipulation Helper Functions
@@ -138,7 +158,7 @@ V3SvrMiniSat::assertImplyUnion(const V3SvrDataVec& vars) {
    for (V3SvrDataVec::const_iterator it = vars.begin(); it != vars.end(); ++it) {
       assert (*it); lits.push(mkLit(getOriVar(*it), isNegFormula(*it)));
    }
-   _Solver->addClause(lits); lits.clear();
+   addClause(lits); lits.clear();
 }
 
 const size_t
@@ -156,9 +176,9 @@ V3SvrMiniSat::setTargetValue(const V3NetId& id, const V3BitVecX& value, const ui
       if (!(bLit == lit_Undef)) {
          if (!(aLit == lit_Undef)) {
             yLit = mkLit(newVar(1));
-            lits.push(aLit); lits.push(~yLit); _Solver->addClause(lits); lits.clear();
-            lits.push(bLit); lits.push(~yLit); _Solver->addClause(lits); lits.clear();
-            lits.push(~aLit); lits.push(~bLit); lits.push(yLit); _Solver->addClause(lits); lits.clear();
+            lits.push(aLit); lits.push(~yLit); addClause(lits); lits.clear();
+            lits.push(bLit); lits.push(~yLit); addClause(lits); lits.clear();
+            lits.push(~aLit); lits.push(~bLit); lits.push(yLit); addClause(lits); lits.clear();
             aLit = yLit; assert (!sign(aLit));
          }
          else aLit = bLit;
@@ -167,8 +187,8 @@ V3SvrMiniSat::setTargetValue(const V3NetId& id, const V3BitVecX& value, const ui
    if (aLit == lit_Undef) return 0;
    else if (sign(aLit)) {
       yLit = mkLit(newVar(1));
-      lits.push(~aLit); lits.push(yLit); _Solver->addClause(lits); lits.clear();
-      lits.push(aLit); lits.push(~yLit); _Solver->addClause(lits); lits.clear();
+      lits.push(~aLit); lits.push(yLit); addClause(lits); lits.clear();
+      lits.push(aLit); lits.push(~yLit); addClause(lits); lits.clear();
       aLit = yLit;
    }
    assert (!isNegFormula(getPosVar(var(aLit))));
@@ -183,7 +203,7 @@ V3SvrMiniSat::setImplyUnion(const V3SvrDataVec& vars) {
    for (V3SvrDataVec::const_iterator it = vars.begin(); it != vars.end(); ++it) {
       assert (*it); lits.push(mkLit(getOriVar(*it), isNegFormula(*it)));
    }
-   _Solver->addClause(lits); lits.clear();
+   addClause(lits); lits.clear();
    assert (!isNegFormula(getPosVar(var(lit))));
    return getPosVar(var(lit));
 }
@@ -198,7 +218,7 @@ V3SvrMiniSat::setImplyIntersection(const V3SvrDataVec& vars) {
    for (V3SvrDataVec::const_iterator it = vars.begin(); it != vars.end(); ++it) {
       assert (*it); lits.push(lit);
       lits.push(mkLit(getOriVar(*it), isNegFormula(*it)));
-      _Solver->addClause(lits); lits.clear();
+      addClause(lits); lits.clear();
    }
    assert (!isNegFormula(getPosVar(var(lit))));
    return getPosVar(var(lit));
@@ -209,7 +229,7 @@ V3SvrMiniSat::setImplyInit() {
    Lit lit = mkLit(newVar(1), true);
    vec<Lit> lits; lits.clear();
    for (uint32_t i = 0; i < _init.size(); ++i) {
-      lits.push(lit); lits.push(_init[i]); _Solver->addClause(lits); lits.clear();
+      lits.push(lit); lits.push(_init[i]); addClause(lits); lits.clear();
    }
    assert (!isNegFormula(getPosVar(var(lit))));
    return getPosVar(var(lit));
@@ -263,6 +283,7 @@ void
 V3SvrMiniSat::printInfo() const {
    Msg(MSG_IFO) << "#Vars = " << _Solver->nVars() << ", #Cls = " << _Solver->nClauses() << ", " 
                 << "#SV = " << totalSolves() << ", AccT = " << totalTime();
+   if (_simp) { Msg(MSG_IFO) << ", "; _simp->printInfo(); }
 }
 
 void
@@ -278,8 +299,16 @@ V3SvrMiniSat::getTime() const {
 
 const int
 V3SvrMiniSat::getMemory() const {
-   // NOTE: 1G for 16M clauses
-   return _Solver->nClauses() >> 4;
+   // NOTE: 1G for 16M clauses, Learnt Clauses Included
+   return (_Solver->nClauses() + _Solver->nLearnts()) >> 4;
+}
+
+void
+V3SvrMiniSat::accountMemory() {
+   // Report Clause Database Growth since the Last Call (NOTE: 1G for 16M clauses as in getMemory())
+   const uint64_t clauses = _Solver->nClauses() + _Solver->nLearnts();
+   if (clauses > _memClauses) v3MemAccount.allocate((clauses - _memClauses) << 6);
+   _memClauses = clauses;
 }
 
 // Gate Formula to Solver Functions
@@ -287,30 +316,30 @@ void
 V3SvrMiniSat::add_FALSE_Formula(const V3NetId& out, const uint32_t& depth) {
    // Check Output Validation
    assert (validNetId(out)); assert (AIG_FALSE == _ntk->getGateType(out)); assert (!getVerifyData(out, depth));
-   const uint32_t index = getV3NetIndex(out); assert (depth == _ntkData[index].size());
+   const uint32_t index = getV3NetIndex(out);
    // Set SATVar
-   _ntkData[index].push_back(newVar(1)); assert (getVerifyData(out, depth));
-   _Solver->addClause(mkLit(_ntkData[index].back(), true));
+   const Var var = setVerifyData(index, depth, newVar(1)); assert (getVerifyData(out, depth));
+   addClause(mkLit(var, true));
 }
 
 void
 V3SvrMiniSat::add_PI_Formula(const V3NetId& out, const uint32_t& depth) {
    // Check Output Validation
    assert (validNetId(out)); assert (V3_PI == _ntk->getGateType(out)); assert (!getVerifyData(out, depth));
-   const uint32_t index = getV3NetIndex(out); assert (depth == _ntkData[index].size());
+   const uint32_t index = getV3NetIndex(out);
    // Set SATVar
-   _ntkData[index].push_back(newVar(_ntk->getNetWidth(out))); assert (getVerifyData(out, depth));
+   setVerifyData(index, depth, newVar(_ntk->getNetWidth(out))); assert (getVerifyData(out, depth));
 }
 
 void
 V3SvrMiniSat::add_FF_Formula(const V3NetId& out, const uint32_t& depth) {
    // Check Output Validation
    assert (validNetId(out)); assert (V3_FF == _ntk->getGateType(out)); assert (!getVerifyData(out, depth));
-   const uint32_t index = getV3NetIndex(out); assert (depth == _ntkData[index].size());
+   const uint32_t index = getV3NetIndex(out);
    const uint32_t width = _ntk->getNetWidth(out); assert (width);
    if (_freeBound) {
       // Set SATVar
-      _ntkData[index].push_back(newVar(width));
+      setVerifyData(index, depth, newVar(width));
    }
    else if (depth) {
       // Build FF I/O Relation
@@ -318,16 +347,15 @@ V3SvrMiniSat::add_FF_Formula(const V3NetId& out, const uint32_t& depth) {
       const Var var1 = getVerifyData(in1, depth - 1); assert (var1);
       // Set SATVar
       if (isV3NetInverted(in1)) {
-         _ntkData[index].push_back(newVar(width));
+         const Var var = setVerifyData(index, depth, newVar(width));
          for (uint32_t i = 0; i < width; ++i) 
-            buf(_Solver, mkLit(_ntkData[index].back() + i), mkLit(var1 + i, true));
+            buf(this, mkLit(var + i), mkLit(var1 + i, true));
       }
-      else _ntkData[index].push_back(var1);
+      else setVerifyData(index, depth, var1);
    }
    else {
       // Set SATVar
-      _ntkData[index].push_back(newVar(width));
-      const Var& var = _ntkData[index].back();
+      const Var var = setVerifyData(index, depth, newVar(width));
       // Build FF Initial State
       const V3NetId in1 = _ntk->getInputNetId(out, 1); assert (validNetId(in1));
       const V3BvNtk* const ntk = dynamic_cast<const V3BvNtk*>(_ntk);
@@ -341,8 +369,8 @@ V3SvrMiniSat::add_FF_Formula(const V3NetId& out, const uint32_t& depth) {
             const Var var1 = getVerifyData(in1, 0); assert (var1);
             const Var initVar = newVar(width + 1);
             for (uint32_t i = 0; i < width; ++i) 
-               xor_2(_Solver, mkLit(1 + initVar + i, true), mkLit(var + i), mkLit(var1 + i, isV3NetInverted(in1)));
-            and_red(_Solver, mkLit(initVar), mkLit(1 + initVar), width); _init.push_back(mkLit(initVar));
+               xor_2(this, mkLit(1 + initVar + i, true), mkLit(var + i), mkLit(var1 + i, isV3NetInverted(in1)));
+            and_red(this, mkLit(initVar), mkLit(1 + initVar), width); _init.push_back(mkLit(initVar));
          }
       }
       else {
@@ -350,7 +378,7 @@ V3SvrMiniSat::add_FF_Formula(const V3NetId& out, const uint32_t& depth) {
          else if (out.id != in1.id) {  // Build Initial Circuit
             const Var var1 = getVerifyData(in1, 0); assert (var1);
             const Var initVar = newVar(1);
-            xor_2(_Solver, mkLit(initVar, true), mkLit(var), mkLit(var1, isV3NetInverted(in1)));
+            xor_2(this, mkLit(initVar, true), mkLit(var), mkLit(var1, isV3NetInverted(in1)));
             _init.push_back(mkLit(initVar));
          }
       }
@@ -363,47 +391,44 @@ V3SvrMiniSat::add_AND_Formula(const V3NetId& out, const uint32_t& depth) {
    // Check Output Validation
    assert (validNetId(out)); assert (!getVerifyData(out, depth));
    assert ((AIG_NODE == _ntk->getGateType(out)) || (BV_AND == _ntk->getGateType(out)));
-   const uint32_t index = getV3NetIndex(out); assert (depth == _ntkData[index].size());
+   const uint32_t index = getV3NetIndex(out);
    const uint32_t width = _ntk->getNetWidth(out); assert (width);
    // Set SATVar
-   _ntkData[index].push_back(newVar(_ntk->getNetWidth(out))); assert (getVerifyData(out, depth));
-   const Var& var = _ntkData[index].back();
+   const Var var = setVerifyData(index, depth, newVar(_ntk->getNetWidth(out))); assert (getVerifyData(out, depth));
    // Build AND I/O Relation
    const V3NetId in1 = _ntk->getInputNetId(out, 0); assert (validNetId(in1));
    const V3NetId in2 = _ntk->getInputNetId(out, 1); assert (validNetId(in2));
    const Var var1 = getVerifyData(in1, depth); assert (var1);
    const Var var2 = getVerifyData(in2, depth); assert (var2);
    for (uint32_t i = 0; i < width; ++i) 
-      and_2(_Solver, mkLit(var + i), mkLit(var1 + i, isV3NetInverted(in1)), mkLit(var2 + i, isV3NetInverted(in2)));
+      and_2(this, mkLit(var + i), mkLit(var1 + i, isV3NetInverted(in1)), mkLit(var2 + i, isV3NetInverted(in2)));
 }
 
 void
 V3SvrMiniSat::add_XOR_Formula(const V3NetId& out, const uint32_t& depth) {
    // Check Output Validation
    assert (validNetId(out)); assert (BV_XOR == _ntk->getGateType(out)); assert (!getVerifyData(out, depth));
-   const uint32_t index = getV3NetIndex(out); assert (depth == _ntkData[index].size());
+   const uint32_t index = getV3NetIndex(out);
    const uint32_t width = _ntk->getNetWidth(out); assert (width);
    // Set SATVar
-   _ntkData[index].push_back(newVar(_ntk->getNetWidth(out))); assert (getVerifyData(out, depth));
-   const Var& var = _ntkData[index].back();
+   const Var var = setVerifyData(index, depth, newVar(_ntk->getNetWidth(out))); assert (getVerifyData(out, depth));
    // Build XOR I/O Relation
    const V3NetId in1 = _ntk->getInputNetId(out, 0); assert (validNetId(in1));
    const V3NetId in2 = _ntk->getInputNetId(out, 1); assert (validNetId(in2));
    const Var var1 = getVerifyData(in1, depth); assert (var1);
    const Var var2 = getVerifyData(in2, depth); assert (var2);
    for (uint32_t i = 0; i < width; ++i) 
-      xor_2(_Solver, mkLit(var + i), mkLit(var1 + i, isV3NetInverted(in1)), mkLit(var2 + i, isV3NetInverted(in2)));
+      xor_2(this, mkLit(var + i), mkLit(var1 + i, isV3NetInverted(in1)), mkLit(var2 + i, isV3NetInverted(in2)));
 }
 
 void
 V3SvrMiniSat::add_MUX_Formula(const V3NetId& out, const uint32_t& depth) {
    // Check Output Validation
    assert (validNetId(out)); assert (BV_MUX == _ntk->getGateType(out)); assert (!getVerifyData(out, depth));
-   const uint32_t index = getV3NetIndex(out); assert (depth == _ntkData[index].size());
+   const uint32_t index = getV3NetIndex(out);
    const uint32_t width = _ntk->getNetWidth(out); assert (width);
    // Set SATVar
-   _ntkData[index].push_back(newVar(_ntk->getNetWidth(out))); assert (getVerifyData(out, depth));
-   const Var& var = _ntkData[index].back();
+   const Var var = setVerifyData(index, depth, newVar(_ntk->getNetWidth(out))); assert (getVerifyData(out, depth));
    // Build MUX I/O Relation
    const V3NetId fIn = _ntk->getInputNetId(out, 0); assert (validNetId(fIn));
    const V3NetId tIn = _ntk->getInputNetId(out, 1); assert (validNetId(tIn));
@@ -412,9 +437,9 @@ V3SvrMiniSat::add_MUX_Formula(const V3NetId& out, const uint32_t& depth) {
    const Var tVar = getVerifyData(tIn, depth); assert (tVar);
    const Var sVar = getVerifyData(sIn, depth); assert (sVar);
    for (uint32_t i = 0; i < width; ++i) {
-      mux_a(_Solver, mkLit(var + i), mkLit(sVar, isV3NetInverted(sIn)), mkLit(fVar + i, isV3NetInverted(fIn)));
-      mux_b(_Solver, mkLit(var + i), mkLit(sVar, isV3NetInverted(sIn)), mkLit(tVar + i, isV3NetInverted(tIn)));
-      mux_abo(_Solver, mkLit(var + i), mkLit(fVar + i, isV3NetInverted(fIn)), mkLit(tVar + i, isV3NetInverted(tIn)));
+      mux_a(this, mkLit(var + i), mkLit(sVar, isV3NetInverted(sIn)), mkLit(fVar + i, isV3NetInverted(fIn)));
+      mux_b(this, mkLit(var + i), mkLit(sVar, isV3NetInverted(sIn)), mkLit(tVar + i, isV3NetInverted(tIn)));
+      mux_abo(this, mkLit(var + i), mkLit(fVar + i, isV3NetInverted(fIn)), mkLit(tVar + i, isV3NetInverted(tIn)));
    }
 }
 
@@ -422,70 +447,66 @@ void
 V3SvrMiniSat::add_RED_AND_Formula(const V3NetId& out, const uint32_t& depth) {
    // Check Output Validation
    assert (validNetId(out)); assert (BV_RED_AND == _ntk->getGateType(out)); assert (!getVerifyData(out, depth));
-   const uint32_t index = getV3NetIndex(out); assert (depth == _ntkData[index].size());
+   const uint32_t index = getV3NetIndex(out);
    // Set SATVar
-   _ntkData[index].push_back(newVar(1)); assert (getVerifyData(out, depth));
-   const Var& var = _ntkData[index].back();
+   const Var var = setVerifyData(index, depth, newVar(1)); assert (getVerifyData(out, depth));
    // Build RED_AND I/O Relation
    const V3NetId in1 = _ntk->getInputNetId(out, 0); assert (validNetId(in1));
    const Var var1 = getVerifyData(in1, depth); assert (var1);
-   and_red(_Solver, mkLit(var), mkLit(var1, isV3NetInverted(in1)), _ntk->getNetWidth(in1));
+   and_red(this, mkLit(var), mkLit(var1, isV3NetInverted(in1)), _ntk->getNetWidth(in1));
 }
 
 void
 V3SvrMiniSat::add_RED_OR_Formula(const V3NetId& out, const uint32_t& depth) {
    // Check Output Validation
    assert (validNetId(out)); assert (BV_RED_OR == _ntk->getGateType(out)); assert (!getVerifyData(out, depth));
-   const uint32_t index = getV3NetIndex(out); assert (depth == _ntkData[index].size());
+   const uint32_t index = getV3NetIndex(out);
    // Set SATVar
-   _ntkData[index].push_back(newVar(1)); assert (getVerifyData(out, depth));
-   const Var& var = _ntkData[index].back();
+   const Var var = setVerifyData(index, depth, newVar(1)); assert (getVerifyData(out, depth));
    // Build RED_OR I/O Relation
    const V3NetId in1 = _ntk->getInputNetId(out, 0); assert (validNetId(in1));
    const Var var1 = getVerifyData(in1, depth); assert (var1);
-   or_red(_Solver, mkLit(var), mkLit(var1, isV3NetInverted(in1)), _ntk->getNetWidth(in1));
+   or_red(this, mkLit(var), mkLit(var1, isV3NetInverted(in1)), _ntk->getNetWidth(in1));
 }
 
 void
 V3SvrMiniSat::add_RED_XOR_Formula(const V3NetId& out, const uint32_t& depth) {
    // Check Output Validation
    assert (validNetId(out)); assert (BV_RED_XOR == _ntk->getGateType(out)); assert (!getVerifyData(out, depth));
-   const uint32_t index = getV3NetIndex(out); assert (depth == _ntkData[index].size());
+   const uint32_t index = getV3NetIndex(out);
    // Set SATVar
    const V3NetId in1 = _ntk->getInputNetId(out, 0); assert (validNetId(in1));
    const Var var1 = getVerifyData(in1, depth); assert (var1);
    const uint32_t width = _ntk->getNetWidth(in1); assert (width);
-   _ntkData[index].push_back(newVar((width > 1) ? (width - 1) : 1)); assert (getVerifyData(out, depth));
-   const Var& var = _ntkData[index].back();
+   const Var var = setVerifyData(index, depth, newVar((width > 1) ? (width - 1) : 1)); assert (getVerifyData(out, depth));
    // Build RED_XOR I/O Relation
-   xor_red(_Solver, mkLit(var), mkLit(var1, isV3NetInverted(in1)), _ntk->getNetWidth(in1));
+   xor_red(this, mkLit(var), mkLit(var1, isV3NetInverted(in1)), _ntk->getNetWidth(in1));
 }
 
 void
 V3SvrMiniSat::add_ADD_Formula(const V3NetId& out, const uint32_t& depth) {
    // Check Output Validation
    assert (validNetId(out)); assert (BV_ADD == _ntk->getGateType(out)); assert (!getVerifyData(out, depth));
-   const uint32_t index = getV3NetIndex(out); assert (depth == _ntkData[index].size());
+   const uint32_t index = getV3NetIndex(out);
    const uint32_t width = _ntk->getNetWidth(out); assert (width);
    // Set SATVar
-   _ntkData[index].push_back(newVar((width * 2) - 1)); assert (getVerifyData(out, depth));
-   const Var& var = _ntkData[index].back();
+   const Var var = setVerifyData(index, depth, newVar((width * 2) - 1)); assert (getVerifyData(out, depth));
    // Build ADD I/O Relation
    const V3NetId in1 = _ntk->getInputNetId(out, 0); assert (validNetId(in1));
    const V3NetId in2 = _ntk->getInputNetId(out, 1); assert (validNetId(in2));
    const Var var1 = getVerifyData(in1, depth); assert (var1);
    const Var var2 = getVerifyData(in2, depth); assert (var2);
-   xor_2(_Solver, mkLit(var), mkLit(var1, isV3NetInverted(in1)), mkLit(var2, isV3NetInverted(in2)));  // xor
+   xor_2(this, mkLit(var), mkLit(var1, isV3NetInverted(in1)), mkLit(var2, isV3NetInverted(in2)));  // xor
    if (width > 1) 
-      carry_2_woc(_Solver, mkLit(var + width), mkLit(var1, isV3NetInverted(in1)), 
+      carry_2_woc(this, mkLit(var + width), mkLit(var1, isV3NetInverted(in1)), 
                            mkLit(var2, isV3NetInverted(in2)));  // carry
    for (uint32_t i = 1; i < width; ++i) {
       // FA_sum
-      xor_3(_Solver, mkLit(var + i), mkLit(var1 + i, isV3NetInverted(in1)), 
+      xor_3(this, mkLit(var + i), mkLit(var1 + i, isV3NetInverted(in1)), 
                      mkLit(var2 + i, isV3NetInverted(in2)), mkLit(var + width - 1 + i));
       // FA_carry
       if (i < width - 1) 
-         carry_2(_Solver, mkLit(var + width + i), mkLit(var1 + i, isV3NetInverted(in1)), 
+         carry_2(this, mkLit(var + width + i), mkLit(var1 + i, isV3NetInverted(in1)), 
                           mkLit(var2 + i, isV3NetInverted(in2)), mkLit(var + width - 1 + i));
    }
 }
@@ -494,27 +515,26 @@ void
 V3SvrMiniSat::add_SUB_Formula(const V3NetId& out, const uint32_t& depth) {
    // Check Output Validation
    assert (validNetId(out)); assert (BV_SUB == _ntk->getGateType(out)); assert (!getVerifyData(out, depth));
-   const uint32_t index = getV3NetIndex(out); assert (depth == _ntkData[index].size());
+   const uint32_t index = getV3NetIndex(out);
    const uint32_t width = _ntk->getNetWidth(out); assert (width);
    // Set SATVar
-   _ntkData[index].push_back(newVar((width * 2) - 1)); assert (getVerifyData(out, depth));
-   const Var& var = _ntkData[index].back();
+   const Var var = setVerifyData(index, depth, newVar((width * 2) - 1)); assert (getVerifyData(out, depth));
    // Build SUB I/O Relation
    const V3NetId in1 = _ntk->getInputNetId(out, 0); assert (validNetId(in1));
    const V3NetId in2 = _ntk->getInputNetId(out, 1); assert (validNetId(in2));
    const Var var1 = getVerifyData(in1, depth); assert (var1);
    const Var var2 = getVerifyData(in2, depth); assert (var2);
-   xor_2(_Solver, mkLit(var), mkLit(var1, isV3NetInverted(in1)), mkLit(var2, isV3NetInverted(in2)));  // xor
+   xor_2(this, mkLit(var), mkLit(var1, isV3NetInverted(in1)), mkLit(var2, isV3NetInverted(in2)));  // xor
    if (width > 1) 
-      borrow_2_woB(_Solver, mkLit(var + width), mkLit(var1, isV3NetInverted(in1)), 
+      borrow_2_woB(this, mkLit(var + width), mkLit(var1, isV3NetInverted(in1)), 
                             mkLit(var2, isV3NetInverted(in2)));  // borrow
    for (uint32_t i = 1; i < width; ++i) {
       // Sub_Diff
-      xor_3(_Solver, mkLit(var + i), mkLit(var1 + i, isV3NetInverted(in1)), 
+      xor_3(this, mkLit(var + i), mkLit(var1 + i, isV3NetInverted(in1)), 
                      mkLit(var2 + i, isV3NetInverted(in2)), mkLit(var + width - 1 + i));
       // FA_carry
       if (i < width - 1) 
-         borrow_2(_Solver, mkLit(var + width + i), mkLit(var1 + i, isV3NetInverted(in1)), 
+         borrow_2(this, mkLit(var + width + i), mkLit(var1 + i, isV3NetInverted(in1)), 
                            mkLit(var2 + i, isV3NetInverted(in2)), mkLit(var + width - 1 + i));
    }
 }
@@ -523,15 +543,14 @@ void
 V3SvrMiniSat::add_MULT_Formula(const V3NetId& out, const uint32_t& depth) {
    // Check Output Validation
    assert (validNetId(out)); assert (BV_MULT == _ntk->getGateType(out)); assert (!getVerifyData(out, depth));
-   const uint32_t index = getV3NetIndex(out); assert (depth == _ntkData[index].size());
+   const uint32_t index = getV3NetIndex(out);
    const uint32_t width = _ntk->getNetWidth(out); assert (width);
    // Set SATVar
    // Note : #variables = C(n, 2) for corresponding Ai * Bj = and(Ai, Bj)
    //                   + 2 * C(n-1, 2) for sum_out and carry of full adders
    //                   - (n-1) carries are not necessary for bounded multiplication
-   _ntkData[index].push_back(newVar((width * (width + 1) >> 1) + ((width - 1) * (width - 1))));
+   const Var var = setVerifyData(index, depth, newVar((width * (width + 1) >> 1) + ((width - 1) * (width - 1))));
    assert (getVerifyData(out, depth));
-   const Var& var = _ntkData[index].back();
    // Build MULT I/O Relation
    const V3NetId in1 = _ntk->getInputNetId(out, 0); assert (validNetId(in1));
    const V3NetId in2 = _ntk->getInputNetId(out, 1); assert (validNetId(in2));
@@ -542,11 +561,11 @@ V3SvrMiniSat::add_MULT_Formula(const V3NetId& out, const uint32_t& depth) {
    for (uint32_t i = 1; i < width; ++i) prev_vars[i] = var + width + i - 1;
 
    // 1. AND results for corresponding ai * bj
-   and_2(_Solver, mkLit(var), mkLit(var1, isV3NetInverted(in1)), 
+   and_2(this, mkLit(var), mkLit(var1, isV3NetInverted(in1)), 
                   mkLit(var2, isV3NetInverted(in2)));  // C[0] = a[0] * b[0]
    for (uint32_t i = 0; i < width; ++i) {
       for (uint32_t j = (i == 0) ? i + 1 : i; j < width; ++j) {
-         and_2(_Solver, mkLit(curVar), mkLit(var1 + j - i, isV3NetInverted(in1)), 
+         and_2(this, mkLit(curVar), mkLit(var1 + j - i, isV3NetInverted(in1)), 
                         mkLit(var2 + i, isV3NetInverted(in2))); ++curVar;
       }
    }
@@ -555,15 +574,15 @@ V3SvrMiniSat::add_MULT_Formula(const V3NetId& out, const uint32_t& depth) {
    // 2. Adders for sum_out and carry
    Var baseVar = var + (width << 1) - 1;  // Also for efficient var lookup built in 1.
    for (uint32_t i = 1; i < width; ++i) {
-      xor_2(_Solver, mkLit(var + i), mkLit(prev_vars[i]), mkLit(baseVar));  // C[i] = sum_out(prev_vars[i], baseVar);
+      xor_2(this, mkLit(var + i), mkLit(prev_vars[i]), mkLit(baseVar));  // C[i] = sum_out(prev_vars[i], baseVar);
       if (i != (width - 1)) {
-         carry_2_woc(_Solver, mkLit(curVar), mkLit(prev_vars[i]), mkLit(baseVar)); ++curVar;
+         carry_2_woc(this, mkLit(curVar), mkLit(prev_vars[i]), mkLit(baseVar)); ++curVar;
       }
       ++baseVar;
       for (uint32_t j = i + 1; j < width; ++j) {
-         xor_3(_Solver, mkLit(curVar), mkLit(prev_vars[j]), mkLit(baseVar), mkLit(curVar - 1)); ++curVar;
+         xor_3(this, mkLit(curVar), mkLit(prev_vars[j]), mkLit(baseVar), mkLit(curVar - 1)); ++curVar;
          if (j != (width - 1)) {
-            carry_2(_Solver, mkLit(curVar), mkLit(prev_vars[j]), mkLit(baseVar), mkLit(curVar - 2)); ++curVar;
+            carry_2(this, mkLit(curVar), mkLit(prev_vars[j]), mkLit(baseVar), mkLit(curVar - 2)); ++curVar;
             prev_vars[j] = curVar - 2;
          }
          else prev_vars[j] = curVar - 1;
@@ -578,11 +597,10 @@ void
 V3SvrMiniSat::add_DIV_Formula(const V3NetId& out, const uint32_t& depth) {
    // Check Output Validation
    assert (validNetId(out)); assert (BV_DIV == _ntk->getGateType(out)); assert (!getVerifyData(out, depth));
-   const uint32_t index = getV3NetIndex(out); assert (depth == _ntkData[index].size());
+   const uint32_t index = getV3NetIndex(out);
    const uint32_t width = _ntk->getNetWidth(out); assert (width);
    // Set SATVar
-   _ntkData[index].push_back(newVar(width)); assert (getVerifyData(out, depth));
-   const Var& var = _ntkData[index].back();
+   const Var var = setVerifyData(index, depth, newVar(width)); assert (getVerifyData(out, depth));
    // Build DIV I/O Relation
    const V3NetId in1 = _ntk->getInputNetId(out, 0); assert (validNetId(in1));
    const V3NetId in2 = _ntk->getInputNetId(out, 1); assert (validNetId(in2));
@@ -597,22 +615,22 @@ V3SvrMiniSat::add_DIV_Formula(const V3NetId& out, const uint32_t& depth) {
       // Compute s = r - id2 and the final borrow
       for (j = 0; j < width; ++j) sVec[j] = mkLit(newVar(1));
       for (j = 0; j < width - 1; ++j) qVec[j] = mkLit(newVar(1)); qVec[j] = mkLit(var + i, 1);
-      xor_2(_Solver, sVec[0], rVec[0], mkLit(var2, isV3NetInverted(in2)));  // xor
-      borrow_2_woB(_Solver, qVec[0], rVec[0], mkLit(var2, isV3NetInverted(in2)));  // borrow
+      xor_2(this, sVec[0], rVec[0], mkLit(var2, isV3NetInverted(in2)));  // xor
+      borrow_2_woB(this, qVec[0], rVec[0], mkLit(var2, isV3NetInverted(in2)));  // borrow
       for (j = 1; j < width; ++j) {
          // Sub_Diff
-         xor_3(_Solver, sVec[j], rVec[j], mkLit(var2 + j, isV3NetInverted(in2)), qVec[j - 1]);
+         xor_3(this, sVec[j], rVec[j], mkLit(var2 + j, isV3NetInverted(in2)), qVec[j - 1]);
          // FA_carry
-         borrow_2(_Solver, qVec[j], rVec[j], mkLit(var2 + j, isV3NetInverted(in2)), qVec[j - 1]);
+         borrow_2(this, qVec[j], rVec[j], mkLit(var2 + j, isV3NetInverted(in2)), qVec[j - 1]);
       }
       // Set remainder = borrow ? rVec : sVec
       if (i) {  // Omit the computation of final remainder
          qVec = rVec;
          for (j = 0; j < width; ++j) {
             rVec[j] = mkLit(newVar(1));
-            mux_a(_Solver, rVec[j], mkLit(var + i), qVec[j]);
-            mux_b(_Solver, rVec[j], mkLit(var + i), sVec[j]);
-            mux_abo(_Solver, rVec[j], qVec[j], sVec[j]);
+            mux_a(this, rVec[j], mkLit(var + i), qVec[j]);
+            mux_b(this, rVec[j], mkLit(var + i), sVec[j]);
+            mux_abo(this, rVec[j], qVec[j], sVec[j]);
          }
       }
    }
@@ -622,11 +640,10 @@ void
 V3SvrMiniSat::add_MODULO_Formula(const V3NetId& out, const uint32_t& depth) {
    // Check Output Validation
    assert (validNetId(out)); assert (BV_MODULO == _ntk->getGateType(out)); assert (!getVerifyData(out, depth));
-   const uint32_t index = getV3NetIndex(out); assert (depth == _ntkData[index].size());
+   const uint32_t index = getV3NetIndex(out);
    const uint32_t width = _ntk->getNetWidth(out); assert (width);
    // Set SATVar
-   _ntkData[index].push_back(newVar(width)); assert (getVerifyData(out, depth));
-   const Var& var = _ntkData[index].back();
+   const Var var = setVerifyData(index, depth, newVar(width)); assert (getVerifyData(out, depth));
    // Build DIV I/O Relation
    const V3NetId in1 = _ntk->getInputNetId(out, 0); assert (validNetId(in1));
    const V3NetId in2 = _ntk->getInputNetId(out, 1); assert (validNetId(in2));
@@ -641,21 +658,21 @@ V3SvrMiniSat::add_MODULO_Formula(const V3NetId& out, const uint32_t& depth) {
       // Compute s = r - id2 and the final borrow
       for (j = 0; j < width; ++j) sVec[j] = mkLit(newVar(1));
       for (j = 0; j < width; ++j) qVec[j] = mkLit(newVar(1));
-      xor_2(_Solver, sVec[0], rVec[0], mkLit(var2, isV3NetInverted(in2)));  // xor
-      borrow_2_woB(_Solver, qVec[0], rVec[0], mkLit(var2, isV3NetInverted(in2)));  // borrow
+      xor_2(this, sVec[0], rVec[0], mkLit(var2, isV3NetInverted(in2)));  // xor
+      borrow_2_woB(this, qVec[0], rVec[0], mkLit(var2, isV3NetInverted(in2)));  // borrow
       for (j = 1; j < width; ++j) {
          // Sub_Diff
-         xor_3(_Solver, sVec[j], rVec[j], mkLit(var2 + j, isV3NetInverted(in2)), qVec[j - 1]);
+         xor_3(this, sVec[j], rVec[j], mkLit(var2 + j, isV3NetInverted(in2)), qVec[j - 1]);
          // FA_carry
-         borrow_2(_Solver, qVec[j], rVec[j], mkLit(var2 + j, isV3NetInverted(in2)), qVec[j - 1]);
+         borrow_2(this, qVec[j], rVec[j], mkLit(var2 + j, isV3NetInverted(in2)), qVec[j - 1]);
       }
       // Set remainder = borrow ? rVec : sVec
       const Lit borrow = qVec[j - 1]; qVec = rVec;
       for (j = 0; j < width; ++j) {
          rVec[j] = i ? mkLit(newVar(1)) : mkLit(var + j);
-         mux_a(_Solver, rVec[j], borrow, sVec[j]);
-         mux_b(_Solver, rVec[j], borrow, qVec[j]);
-         mux_abo(_Solver, rVec[j], sVec[j], qVec[j]);
+         mux_a(this, rVec[j], borrow, sVec[j]);
+         mux_b(this, rVec[j], borrow, qVec[j]);
+         mux_abo(this, rVec[j], sVec[j], qVec[j]);
       }
    }
 }
@@ -664,7 +681,7 @@ void
 V3SvrMiniSat::add_SHL_Formula(const V3NetId& out, const uint32_t& depth) {
    // Check Output Validation
    assert (validNetId(out)); assert (BV_SHL == _ntk->getGateType(out)); assert (!getVerifyData(out, depth));
-   const uint32_t index = getV3NetIndex(out); assert (depth == _ntkData[index].size());
+   const uint32_t index = getV3NetIndex(out);
    const uint32_t width = _ntk->getNetWidth(out); assert (width);
    // Set SATVar
    const V3NetId in1 = _ntk->getInputNetId(out, 0); assert (validNetId(in1));
@@ -673,15 +690,14 @@ V3SvrMiniSat::add_SHL_Formula(const V3NetId& out, const uint32_t& depth) {
    const Var var2 = getVerifyData(in2, depth); assert (var2);
    // Build SHL I/O Relation
    if (BV_CONST == _ntk->getGateType(in2) && (sizeof(int) << 3) > _ntk->getNetWidth(in2)) {
-      _ntkData[index].push_back(newVar(width));
-      const Var& var = _ntkData[index].back();
+      const Var var = setVerifyData(index, depth, newVar(width));
       const V3BvNtk* const ntk = dynamic_cast<const V3BvNtk*>(_ntk); assert (ntk);
       const V3BitVecX value = ntk->getInputConstValue(in2);
       if (value.size() == value.firstX()) {
          const int shift = value.value();
          for (int i = width; i > 0; --i) {
-            if (i > shift) buf(_Solver, mkLit(var + i - 1), mkLit(var1 + ((i - 1) - shift), isV3NetInverted(in1)));
-            else _Solver->addClause(mkLit(var + i - 1, true));
+            if (i > shift) buf(this, mkLit(var + i - 1), mkLit(var1 + ((i - 1) - shift), isV3NetInverted(in1)));
+            else addClause(mkLit(var + i - 1, true));
          }
          assert (getVerifyData(out, depth)); return;
       }
@@ -689,8 +705,7 @@ V3SvrMiniSat::add_SHL_Formula(const V3NetId& out, const uint32_t& depth) {
    const int aWidth = _ntk->getNetWidth(in1), bWidth = _ntk->getNetWidth(in2);
    int shift_width = (int)ceil(log2(aWidth + 1));
    shift_width = (shift_width < bWidth) ? shift_width : bWidth;
-   _ntkData[index].push_back(newVar(aWidth * shift_width));
-   const Var& var = _ntkData[index].back();
+   const Var var = setVerifyData(index, depth, newVar(aWidth * shift_width));
    int start_index, prev_index, pow_shift;
    bool is_prev_inverted;
    // Compute OR msb of var2 starting from index = shift_width
@@ -699,19 +714,19 @@ V3SvrMiniSat::add_SHL_Formula(const V3NetId& out, const uint32_t& depth) {
    vec<Lit> ORlits; ORlits.clear(); Var ORVar = newVar(1); shift[shift_width - 1] = mkLit(ORVar);
    for (int i = shift_width - 1; i < bWidth; ++i) {
       ORlits.push(mkLit(var2 + i, !isV3NetInverted(in2)));
-      ORlits.push(mkLit(ORVar)); _Solver->addClause(ORlits); ORlits.clear();
+      ORlits.push(mkLit(ORVar)); addClause(ORlits); ORlits.clear();
    }
    for (int i = shift_width - 1; i < bWidth; ++i) ORlits.push(mkLit(var2 + i, isV3NetInverted(in2)));
-   ORlits.push(mkLit(ORVar, 1)); _Solver->addClause(ORlits); ORlits.clear();
+   ORlits.push(mkLit(ORVar, 1)); addClause(ORlits); ORlits.clear();
    for (int i = 0; i < shift_width; ++i) {
       start_index = var + ((shift_width - 1 - i) * aWidth);
       prev_index = (i == 0) ? var1 : (start_index + aWidth);
       is_prev_inverted = (i == 0) ? isV3NetInverted(in1) : false;
       pow_shift = (int)pow(2.00, i);  // Sub-Shift Process : a << pow_shift
       for (int j = 0; j < pow_shift; ++j)
-         and_2(_Solver, mkLit(start_index + j), mkLit(prev_index + j, is_prev_inverted), ~shift[i]);  // c[j] = a[j] & !shift
+         and_2(this, mkLit(start_index + j), mkLit(prev_index + j, is_prev_inverted), ~shift[i]);  // c[j] = a[j] & !shift
       for (int j = pow_shift; j < aWidth; ++j)
-         sh_select(_Solver, mkLit(start_index + j), mkLit(prev_index + j - pow_shift, is_prev_inverted), 
+         sh_select(this, mkLit(start_index + j), mkLit(prev_index + j - pow_shift, is_prev_inverted), 
                             mkLit(prev_index + j, is_prev_inverted), shift[i]);
    }
    assert (getVerifyData(out, depth));
@@ -721,7 +736,7 @@ void
 V3SvrMiniSat::add_SHR_Formula(const V3NetId& out, const uint32_t& depth) {
    // Check Output Validation
    assert (validNetId(out)); assert (BV_SHR == _ntk->getGateType(out)); assert (!getVerifyData(out, depth));
-   const uint32_t index = getV3NetIndex(out); assert (depth == _ntkData[index].size());
+   const uint32_t index = getV3NetIndex(out);
    const uint32_t width = _ntk->getNetWidth(out); assert (width);
    // Set SATVar
    const V3NetId in1 = _ntk->getInputNetId(out, 0); assert (validNetId(in1));
@@ -730,15 +745,14 @@ V3SvrMiniSat::add_SHR_Formula(const V3NetId& out, const uint32_t& depth) {
    const Var var2 = getVerifyData(in2, depth); assert (var2);
    // Build SHR I/O Relation
    if (BV_CONST == _ntk->getGateType(in2) && (sizeof(int) << 3) > _ntk->getNetWidth(in2)) {
-      _ntkData[index].push_back(newVar(width));
-      const Var& var = _ntkData[index].back();
+      const Var var = setVerifyData(index, depth, newVar(width));
       const V3BvNtk* const ntk = dynamic_cast<const V3BvNtk*>(_ntk); assert (ntk);
       const V3BitVecX value = ntk->getInputConstValue(in2);
       if (value.size() == value.firstX()) {
          const int shift = value.value();
          for (int i = width; i > 0; --i) {	  
-            if (i > shift) buf(_Solver, mkLit(var + ((i - 1) - shift)), mkLit(var1 + i - 1, isV3NetInverted(in1)));
-            else _Solver->addClause(mkLit(var + width + i - shift - 1, true));
+            if (i > shift) buf(this, mkLit(var + ((i - 1) - shift)), mkLit(var1 + i - 1, isV3NetInverted(in1)));
+            else addClause(mkLit(var + width + i - shift - 1, true));
          }
          assert (getVerifyData(out, depth)); return;
       }
@@ -746,8 +760,7 @@ V3SvrMiniSat::add_SHR_Formula(const V3NetId& out, const uint32_t& depth) {
    const int aWidth = _ntk->getNetWidth(in1), bWidth = _ntk->getNetWidth(in2);
    int shift_width = (int)ceil(log2(aWidth + 1));
    shift_width = (shift_width < bWidth) ? shift_width : bWidth;
-   _ntkData[index].push_back(newVar(aWidth * shift_width));
-   const Var& var = _ntkData[index].back();
+   const Var var = setVerifyData(index, depth, newVar(aWidth * shift_width));
    int start_index, prev_index, pow_shift;
    bool is_prev_inverted;
    // Compute OR msb of var2 starting from index = shift_width
@@ -756,20 +769,20 @@ V3SvrMiniSat::add_SHR_Formula(const V3NetId& out, const uint32_t& depth) {
    vec<Lit> ORlits; ORlits.clear(); Var ORVar = newVar(1); shift[shift_width - 1] = mkLit(ORVar);
    for (int i = shift_width - 1; i < bWidth; ++i) {
       ORlits.push(mkLit(var2 + i, !isV3NetInverted(in2)));
-      ORlits.push(mkLit(ORVar)); _Solver->addClause(ORlits); ORlits.clear();
+      ORlits.push(mkLit(ORVar)); addClause(ORlits); ORlits.clear();
    }
    for (int i = shift_width - 1; i < bWidth; ++i) ORlits.push(mkLit(var2 + i, isV3NetInverted(in2)));
-   ORlits.push(mkLit(ORVar, 1)); _Solver->addClause(ORlits); ORlits.clear();
+   ORlits.push(mkLit(ORVar, 1)); addClause(ORlits); ORlits.clear();
    for (int i = 0; i < shift_width; ++i) {
       start_index = var + ((shift_width - 1 - i) * aWidth);
       prev_index = (i == 0) ? var1 : (start_index + aWidth);
       is_prev_inverted = (i == 0) ? isV3NetInverted(in1) : false;
       pow_shift = (int)pow(2.00, i);  // Sub-Shift Process : a >> pow_shift
       for (int j = 0; j < aWidth - pow_shift; ++j)
-         sh_select(_Solver, mkLit(start_index + j), mkLit(prev_index + pow_shift + j, is_prev_inverted), 
+         sh_select(this, mkLit(start_index + j), mkLit(prev_index + pow_shift + j, is_prev_inverted), 
                             mkLit(prev_index + j, is_prev_inverted), shift[i]);
       for (int j = aWidth - pow_shift; j < aWidth; ++j)
-         and_2(_Solver, mkLit(start_index + j), mkLit(prev_index + j, is_prev_inverted), ~shift[i]);  // c[j] = a[j] & !shift
+         and_2(this, mkLit(start_index + j), mkLit(prev_index + j, is_prev_inverted), ~shift[i]);  // c[j] = a[j] & !shift
    }
    assert (getVerifyData(out, depth));
 }
@@ -778,23 +791,22 @@ void
 V3SvrMiniSat::add_CONST_Formula(const V3NetId& out, const uint32_t& depth) {
    // Check Output Validation
    assert (validNetId(out)); assert (BV_CONST == _ntk->getGateType(out)); assert (!getVerifyData(out, depth));
-   const uint32_t index = getV3NetIndex(out); assert (depth == _ntkData[index].size());
+   const uint32_t index = getV3NetIndex(out);
    const uint32_t width = _ntk->getNetWidth(out); assert (width);
    // Set SATVar
-   _ntkData[index].push_back(newVar(width)); assert (getVerifyData(out, depth));
-   const Var& var = _ntkData[index].back();
+   const Var var = setVerifyData(index, depth, newVar(width)); assert (getVerifyData(out, depth));
    // Build CONST I/O Relation
    const V3BvNtk* const ntk = dynamic_cast<const V3BvNtk*>(_ntk); assert (ntk);
    const V3BitVecX value = ntk->getInputConstValue(V3NetId::makeNetId(out.id)); assert (width == value.size());
    for (uint32_t i = 0; i < width; ++i)
-      if ('X' != value[i]) _Solver->addClause(mkLit(var + i, '0' == value[i]));
+      if ('X' != value[i]) addClause(mkLit(var + i, '0' == value[i]));
 }
 
 void
 V3SvrMiniSat::add_SLICE_Formula(const V3NetId& out, const uint32_t& depth) {
    // Check Output Validation
    assert (validNetId(out)); assert (BV_SLICE == _ntk->getGateType(out)); assert (!getVerifyData(out, depth));
-   const uint32_t index = getV3NetIndex(out); assert (depth == _ntkData[index].size());
+   const uint32_t index = getV3NetIndex(out);
    // Build SLICE I/O Relation
    const V3NetId in1 = _ntk->getInputNetId(out, 0); assert (validNetId(in1));
    const Var var1 = getVerifyData(in1, depth); assert (var1);
@@ -805,19 +817,17 @@ V3SvrMiniSat::add_SLICE_Formula(const V3NetId& out, const uint32_t& depth) {
    if (msb >= lsb) {
       if (isV3NetInverted(in1)) {
          const uint32_t width = _ntk->getNetWidth(out); assert (width);
-         _ntkData[index].push_back(newVar(width));
-         const Var& var = _ntkData[index].back();
+         const Var var = setVerifyData(index, depth, newVar(width));
          for (uint32_t i = 0; i < width; ++i) 
-            buf(_Solver, mkLit(var + i), mkLit(var1 + lsb + i, isV3NetInverted(in1)));
+            buf(this, mkLit(var + i), mkLit(var1 + lsb + i, isV3NetInverted(in1)));
       }
-      else _ntkData[index].push_back(var1 + lsb);
+      else setVerifyData(index, depth, var1 + lsb);
    }
    else {
       const uint32_t width = _ntk->getNetWidth(out); assert (width);
-      _ntkData[index].push_back(newVar(width));
-      const Var& var = _ntkData[index].back();
+      const Var var = setVerifyData(index, depth, newVar(width));
       for (uint32_t i = 0; i < width; ++i) 
-         buf(_Solver, mkLit(var + i), mkLit(var1 + lsb - i, isV3NetInverted(in1)));
+         buf(this, mkLit(var + i), mkLit(var1 + lsb - i, isV3NetInverted(in1)));
    }
    assert (getVerifyData(out, depth));
 }
@@ -826,11 +836,10 @@ void
 V3SvrMiniSat::add_MERGE_Formula(const V3NetId& out, const uint32_t& depth) {
    // Check Output Validation
    assert (validNetId(out)); assert (BV_MERGE == _ntk->getGateType(out)); assert (!getVerifyData(out, depth));
-   const uint32_t index = getV3NetIndex(out); assert (depth == _ntkData[index].size());
+   const uint32_t index = getV3NetIndex(out);
    const uint32_t width = _ntk->getNetWidth(out); assert (width);
    // Set SATVar
-   _ntkData[index].push_back(newVar(width)); assert (getVerifyData(out, depth));
-   const Var& var = _ntkData[index].back();
+   const Var var = setVerifyData(index, depth, newVar(width)); assert (getVerifyData(out, depth));
    // Build MERGE I/O Relation
    const V3NetId in1 = _ntk->getInputNetId(out, 0); assert (validNetId(in1));
    const V3NetId in2 = _ntk->getInputNetId(out, 1); assert (validNetId(in2));
@@ -838,60 +847,99 @@ V3SvrMiniSat::add_MERGE_Formula(const V3NetId& out, const uint32_t& depth) {
    const Var var2 = getVerifyData(in2, depth); assert (var2);
    const uint32_t width_in1 = _ntk->getNetWidth(in1), width_in2 = _ntk->getNetWidth(in2);
    for (int i = 0, j = (int)width_in2; i < j; ++i) 
-      buf(_Solver, mkLit(var + i), mkLit(var2 + i, isV3NetInverted(in2)));
+      buf(this, mkLit(var + i), mkLit(var2 + i, isV3NetInverted(in2)));
    for (int i = 0, j = (int)width_in1; i < j; ++i) 
-      buf(_Solver, mkLit(var + width_in2 + i), mkLit(var1 + i, isV3NetInverted(in1)));
+      buf(this, mkLit(var + width_in2 + i), mkLit(var1 + i, isV3NetInverted(in1)));
 }
 
 void
 V3SvrMiniSat::add_EQUALITY_Formula(const V3NetId& out, const uint32_t& depth) {
    // Check Output Validation
    assert (validNetId(out)); assert (BV_EQUALITY == _ntk->getGateType(out)); assert (!getVerifyData(out, depth));
-   const uint32_t index = getV3NetIndex(out); assert (depth == _ntkData[index].size());
+   const uint32_t index = getV3NetIndex(out);
    // Set SATVar
    const V3NetId in1 = _ntk->getInputNetId(out, 0); assert (validNetId(in1));
    const uint32_t width = _ntk->getNetWidth(in1); assert (width);
-   _ntkData[index].push_back(newVar(width + 1)); assert (getVerifyData(out, depth));
-   const Var& var = _ntkData[index].back();
+   const Var var = setVerifyData(index, depth, newVar(width + 1)); assert (getVerifyData(out, depth));
    // Build EQUALITY I/O Relation
    const V3NetId in2 = _ntk->getInputNetId(out, 1); assert (validNetId(in2));
    const Var var1 = getVerifyData(in1, depth); assert (var1);
    const Var var2 = getVerifyData(in2, depth); assert (var2);
    for (uint32_t i = 0; i < width; ++i) 
-      xor_2(_Solver, mkLit(1 + var + i, true), 
+      xor_2(this, mkLit(1 + var + i, true), 
                      mkLit(var1 + i, isV3NetInverted(in1)), mkLit(var2 + i, isV3NetInverted(in2)));
-   and_red(_Solver, mkLit(var), mkLit(1 + var), width);
+   and_red(this, mkLit(var), mkLit(1 + var), width);
 }
 
 void
 V3SvrMiniSat::add_GEQ_Formula(const V3NetId& out, const uint32_t& depth) {
    // Check Output Validation
    assert (validNetId(out)); assert (BV_GEQ == _ntk->getGateType(out)); assert (!getVerifyData(out, depth));
-   const uint32_t index = getV3NetIndex(out); assert (depth == _ntkData[index].size());
+   const uint32_t index = getV3NetIndex(out);
    // Set SATVar
    const V3NetId in1 = _ntk->getInputNetId(out, 0); assert (validNetId(in1));
    const uint32_t width = _ntk->getNetWidth(in1); assert (width);
-   _ntkData[index].push_back(newVar(width * 3)); assert (getVerifyData(out, depth));
-   const Var& var = _ntkData[index].back();
+   const Var var = setVerifyData(index, depth, newVar(width * 3)); assert (getVerifyData(out, depth));
    // Build GEQ I/O Relation
    const V3NetId in2 = _ntk->getInputNetId(out, 1); assert (validNetId(in2));
    const Var var1 = getVerifyData(in1, depth); assert (var1);
    const Var var2 = getVerifyData(in2, depth); assert (var2);
-   geq(_Solver, mkLit(var + width), mkLit(var1, isV3NetInverted(in1)), mkLit(var2, isV3NetInverted(in2)));  // geq
+   geq(this, mkLit(var + width), mkLit(var1, isV3NetInverted(in1)), mkLit(var2, isV3NetInverted(in2)));  // geq
    for (uint32_t i = 1; i < width; ++i) {
-      xor_2(_Solver, mkLit(var + i, true), 
+      xor_2(this, mkLit(var + i, true), 
                      mkLit(var1 + i, isV3NetInverted(in1)), mkLit(var2 + i, isV3NetInverted(in2)));  // equal
-      greater_2(_Solver, mkLit(var + width + i), mkLit(var1 + i, isV3NetInverted(in1)), 
+      greater_2(this, mkLit(var + width + i), mkLit(var1 + i, isV3NetInverted(in1)), 
                          mkLit(var2 + i, isV3NetInverted(in2)));  // geq
    }
-   geqInt(_Solver, var + (width * 2), var + width, var + 1, width);
-   or_red(_Solver, mkLit(var), mkLit(var + (width * 2)), width);  // OR part
+   geqInt(this, var + (width * 2), var + width, var + 1, width);
+   or_red(this, mkLit(var), mkLit(var + (width * 2)), width);  // OR part
 }
 
 // Network to Solver Functions
+void
+V3SvrMiniSat::addBoundedVerifyData(const V3NetId& id, const uint32_t& depth) {
+   if (!_polarity) return V3SvrBase::addBoundedVerifyData(id, depth);
+   assert (validNetId(id)); addPolarAigData(id, depth, 3);
+}
+
+void
+V3SvrMiniSat::addPolarVerifyData(const V3NetId& id, const uint32_t& depth) {
+   if (!_polarity) return V3SvrBase::addBoundedVerifyData(id, depth);
+   assert (validNetId(id)); addPolarAigData(id, depth, isV3NetInverted(id) ? 2 : 1);
+}
+
 const bool
 V3SvrMiniSat::existVerifyData(const V3NetId& id, const uint32_t& depth) {
-   return getVerifyData(id, depth);
+   // Nets Encoded for a Single Polarity are NOT Regarded as Existing
+   return _polarity ? (3 == getVerifyPhase(id, depth)) : getVerifyData(id, depth);
+}
+
+// Preprocessing Functions
+void
+V3SvrMiniSat::startPreprocess() {
+   // Clauses are Buffered from Now on, Nets Encoded before are Kept in the Solver
+   // Their Vars may Appear in Buffered Clauses as well, so They are Frozen against Elimination
+   assert (!_simp); _simp = new V3SvrCnfSimp(); assert (_simp);
+   for (Var v = 0; v < _curVar; ++v) _simp->setFrozen(v);
+}
+
+void
+V3SvrMiniSat::freezeVerifyData(const V3NetId& id, const uint32_t& depth) {
+   assert (_simp); assert (_simp->isBuffering());
+   const Var var = getVerifyData(id, depth); assert (var);
+   for (uint32_t i = 0; i < _ntk->getNetWidth(id); ++i) _simp->setFrozen(var + i);
+}
+
+const bool
+V3SvrMiniSat::preprocess() {
+   assert (_simp); assert (_simp->isBuffering());
+   // Vars of Pending Assumptions and Initial States must Survive
+   for (int i = 0; i < _assump.size(); ++i) _simp->setFrozen(var(_assump[i]));
+   for (uint32_t i = 0; i < _init.size(); ++i) _simp->setFrozen(var(_init[i]));
+   const uint64_t ctime = getV3ThreadClockNs();
+   const bool ok = _simp->simplify(); _simp->exportClauses(_Solver);
+   _runTime += ((getV3ThreadClockNs() - ctime) / 1e9);
+   return ok;
 }
 
 // MiniSat Functions
@@ -904,9 +952,177 @@ V3SvrMiniSat::newVar(const uint32_t& width) {
 
 const Var
 V3SvrMiniSat::getVerifyData(const V3NetId& id, const uint32_t& depth) const {
-   assert (validNetId(id));
-   if (depth >= _ntkData[getV3NetIndex(id)].size()) return 0;
-   else return _ntkData[getV3NetIndex(id)][depth];
+   assert (validNetId(id)); const uint32_t slot = _ntkSlot[getV3NetIndex(id)];
+   if (depth >= _ntkData.size() || slot >= _ntkData[depth].size()) return 0;
+   else return _ntkData[depth][slot];
+}
+
+const Var
+V3SvrMiniSat::setVerifyData(const uint32_t& index, const uint32_t& depth, const Var& var) {
+   assert (index < _ntkSlot.size()); assert (var);
+   // Assign a Dense Slot on the First Encoding of the Net
+   if (V3NtkUD == _ntkSlot[index]) _ntkSlot[index] = _slotSize++;
+   const uint32_t slot = _ntkSlot[index];
+   // Frames are Sized to the Slots Encoded so far
+   while (depth >= _ntkData.size()) {
+      _ntkData.push_back(V3SvrMVarData()); _ntkData.back().reserve(_slotSize); }
+   V3SvrMVarData& frame = _ntkData[depth]; if (slot >= frame.size()) frame.resize(_slotSize, 0);
+   assert (!frame[slot]); frame[slot] = var; return var;
+}
+
+// Polarity-aware AIG Encoding Functions
+// Pending Net for V3SvrMiniSat::addPolarAigData()
+struct V3SvrPolarItem {
+   V3NetId        id;         // Positive Net
+   uint32_t       depth;
+   unsigned char  phase;      // Requested Phases
+   bool           expanded;   // Fanins have been Requested
+};
+
+// Maximum Number of Leaves in a Multi-input AND Cluster
+const uint32_t V3SvrAigClusterSize = 16;
+
+static inline const unsigned char getV3SvrPhase(const unsigned char& phase, const bool& inv) {
+   return inv ? (((phase & 1) << 1) | ((phase >> 1) & 1)) : phase;
+}
+
+static inline void pushPolarItem(V3Vec<V3SvrPolarItem>::Vec& items, const V3NetId& id, const uint32_t& depth, const unsigned char& phase) {
+   V3SvrPolarItem item; item.id = V3NetId::makeNetId(id.id); item.depth = depth;
+   item.phase = getV3SvrPhase(phase, id.cp); item.expanded = false; items.push_back(item);
+}
+
+void
+V3SvrMiniSat::initPolarData() {
+   // Count Fanouts for Gate Clustering
+   assert (_polarity); _fanout = V3UI32Vec(_ntk->getNetSize(), 0);
+   for (uint32_t i = 0; i < _ntk->getNetSize(); ++i) {
+      const V3NetId id = V3NetId::makeNetId(i); const V3GateType type = _ntk->getGateType(id);
+      if (AIG_NODE != type && V3_FF != type) continue;
+      ++_fanout[_ntk->getInputNetId(id, 0).id]; ++_fanout[_ntk->getInputNetId(id, 1).id];
+   }
+   for (uint32_t i = 0; i < _ntk->getOutputSize(); ++i) ++_fanout[_ntk->getOutput(i).id];
+}
+
+void
+V3SvrMiniSat::addPolarAigData(const V3NetId& id, const uint32_t& depth, const unsigned char& phase) {
+   // Note : phase is for the Positive Net, Fanins are Requested only in Phases the Gate Needs
+   assert (_polarity); assert (phase && phase < 4);
+   V3Vec<V3SvrPolarItem>::Vec items; pushPolarItem(items, V3NetId::makeNetId(id.id), depth, phase);
+   V3NetVec leaves; V3GateType type; unsigned char need;
+   while (items.size()) {
+      const V3SvrPolarItem item = items.back(); assert (validNetId(item.id));
+      need = item.phase & ~getVerifyPhase(item.id, item.depth);
+      if (!need) { items.pop_back(); continue; }
+      if (item.expanded) { items.pop_back(); addPolarAigFormula(item.id, item.depth, need); continue; }
+      items.back().expanded = true; type = _ntk->getGateType(item.id);
+      if (V3_FF == type) {
+         if (_freeBound) continue;
+         if (item.depth) pushPolarItem(items, _ntk->getInputNetId(item.id, 0), item.depth - 1, need);
+         else if (item.id.id != _ntk->getInputNetId(item.id, 1).id)
+            pushPolarItem(items, _ntk->getInputNetId(item.id, 1), 0, 3);
+      }
+      else if (AIG_NODE == type) {
+         type = getAigCluster(item.id, leaves);
+         if (BV_XOR == type) {
+            pushPolarItem(items, leaves[0], item.depth, 3); pushPolarItem(items, leaves[1], item.depth, 3); }
+         else if (BV_MUX == type) {
+            pushPolarItem(items, leaves[0], item.depth, 3);
+            pushPolarItem(items, leaves[1], item.depth, need); pushPolarItem(items, leaves[2], item.depth, need); }
+         else for (uint32_t i = 0; i < leaves.size(); ++i) pushPolarItem(items, leaves[i], item.depth, need);
+      }
+      else assert (V3_PIO >= type || AIG_FALSE == type);
+   }
+}
+
+void
+V3SvrMiniSat::addPolarAigFormula(const V3NetId& out, const uint32_t& depth, const unsigned char& need) {
+   assert (!isV3NetInverted(out)); assert (need && need < 4);
+   const V3GateType type = _ntk->getGateType(out);
+   if (AIG_NODE != type) {
+      // Sources and FF are Encoded as Usual, FF at depth > 0 Shares its Fanin's Phases
+      if (!getVerifyData(out, depth)) addVerifyData(out, depth);
+      return setVerifyPhase(out, depth, (V3_FF == type && depth && !_freeBound) ? need : 3);
+   }
+   V3NetVec leaves; const V3GateType cluster = getAigCluster(out, leaves);
+   Var var = getVerifyData(out, depth); if (!var) var = setVerifyData(getV3NetIndex(out), depth, newVar(1));
+   vec<Lit> lits, in; lits.clear(); in.clear(); const Lit y = mkLit(var);
+   for (uint32_t i = 0; i < leaves.size(); ++i) {
+      assert (getVerifyData(leaves[i], depth)); in.push(mkLit(getVerifyData(leaves[i], depth), isV3NetInverted(leaves[i]))); }
+   if (BV_XOR == cluster) {
+      // y = a ^ b
+      if (1 & need) {
+         lits.push(~y); lits.push( in[0]); lits.push( in[1]); addClause(lits); lits.clear();
+         lits.push(~y); lits.push(~in[0]); lits.push(~in[1]); addClause(lits); lits.clear();
+      }
+      if (2 & need) {
+         lits.push( y); lits.push(~in[0]); lits.push( in[1]); addClause(lits); lits.clear();
+         lits.push( y); lits.push( in[0]); lits.push(~in[1]); addClause(lits); lits.clear();
+      }
+   }
+   else if (BV_MUX == cluster) {
+      // y = s ? t : f, with Redundant Clauses on (t, f) for Propagation
+      if (1 & need) {
+         lits.push(~y); lits.push(~in[0]); lits.push( in[1]); addClause(lits); lits.clear();
+         lits.push(~y); lits.push( in[0]); lits.push( in[2]); addClause(lits); lits.clear();
+         lits.push(~y); lits.push( in[1]); lits.push( in[2]); addClause(lits); lits.clear();
+      }
+      if (2 & need) {
+         lits.push( y); lits.push(~in[0]); lits.push(~in[1]); addClause(lits); lits.clear();
+         lits.push( y); lits.push( in[0]); lits.push(~in[2]); addClause(lits); lits.clear();
+         lits.push( y); lits.push(~in[1]); lits.push(~in[2]); addClause(lits); lits.clear();
+      }
+   }
+   else {
+      // y = AND(leaves)
+      assert (AIG_NODE == cluster);
+      if (1 & need) for (int i = 0; i < in.size(); ++i) { lits.push(~y); lits.push(in[i]); addClause(lits); lits.clear(); }
+      if (2 & need) { lits.push(y); for (int i = 0; i < in.size(); ++i) lits.push(~in[i]); addClause(lits); lits.clear(); }
+   }
+   setVerifyPhase(out, depth, need);
+}
+
+const V3GateType
+V3SvrMiniSat::getAigCluster(const V3NetId& id, V3NetVec& leaves) const {
+   // Returns BV_XOR for (a, b), BV_MUX for (s, t, f), or AIG_NODE for AND over leaves
+   assert (AIG_NODE == _ntk->getGateType(id)); leaves.clear();
+   const V3NetId in1 = _ntk->getInputNetId(id, 0), in2 = _ntk->getInputNetId(id, 1);
+   // XOR and MUX : y = !(a0 & a1) & !(b0 & b1) with ai == !bj
+   if (isV3NetInverted(in1) && isV3NetInverted(in2) && in1.id != in2.id && isAigClusterNode(in1) && isAigClusterNode(in2)) {
+      const V3NetId a[2] = { _ntk->getInputNetId(in1, 0), _ntk->getInputNetId(in1, 1) };
+      const V3NetId b[2] = { _ntk->getInputNetId(in2, 0), _ntk->getInputNetId(in2, 1) };
+      if ((a[0] == ~b[0] && a[1] == ~b[1]) || (a[0] == ~b[1] && a[1] == ~b[0])) {
+         leaves.push_back(a[0]); leaves.push_back(a[1]); return BV_XOR; }
+      for (uint32_t i = 0; i < 2; ++i)
+         for (uint32_t j = 0; j < 2; ++j) {
+            if (a[i] != ~b[j]) continue;
+            leaves.push_back(a[i]); leaves.push_back(~a[1 - i]); leaves.push_back(~b[1 - j]); return BV_MUX;
+         }
+   }
+   // Multi-input AND : Expand Non-inverted Single-fanout AIG_NODE Fanins
+   V3NetVec pending; pending.push_back(in2); pending.push_back(in1);
+   while (pending.size()) {
+      const V3NetId in = pending.back(); pending.pop_back();
+      if (!isV3NetInverted(in) && isAigClusterNode(in) && (2 + leaves.size() + pending.size()) <= V3SvrAigClusterSize) {
+         pending.push_back(_ntk->getInputNetId(in, 1)); pending.push_back(_ntk->getInputNetId(in, 0)); }
+      else leaves.push_back(in);
+   }
+   assert (leaves.size() > 1); return AIG_NODE;
+}
+
+const unsigned char
+V3SvrMiniSat::getVerifyPhase(const V3NetId& id, const uint32_t& depth) const {
+   assert (validNetId(id)); const uint32_t slot = _ntkSlot[getV3NetIndex(id)];
+   if (depth >= _ntkPhase.size() || slot >= _ntkPhase[depth].size()) return 0;
+   else return _ntkPhase[depth][slot];
+}
+
+void
+V3SvrMiniSat::setVerifyPhase(const V3NetId& id, const uint32_t& depth, const unsigned char& phase) {
+   assert (getVerifyData(id, depth)); const uint32_t slot = _ntkSlot[getV3NetIndex(id)];
+   while (depth >= _ntkPhase.size()) {
+      _ntkPhase.push_back(V3SvrMPhaseData()); _ntkPhase.back().reserve(_slotSize); }
+   V3SvrMPhaseData& frame = _ntkPhase[depth]; if (slot >= frame.size()) frame.resize(_slotSize, 0);
+   frame[slot] |= phase;
 }
 
 #endif
@@ -10,6 +10,7 @@
 #define V3_SVR_MSAT_H
 
 #include "v3SvrBase.h"
+#include "v3SvrCnfSimp.h"
 
 // V3SvrMiniSat : V3 Solver with MiniSAT as Engine
 class V3SvrMiniSat : public V3SvrBase
@@ -79,11 +80,40 @@ class V3SvrMiniSat : public V3SvrBase
       void add_EQUALITY_Formula(const V3NetId&, const uint32_t&);
       void add_GEQ_Formula(const V3NetId&, const uint32_t&);
       // Network to Solver Functions
+      void addBoundedVerifyData(const V3NetId&, const uint32_t&);
+      void addPolarVerifyData(const V3NetId&, const uint32_t&);
       const bool existVerifyData(const V3NetId&, const uint32_t&);
+      // Preprocessing Functions
+      void startPreprocess();
+      void freezeVerifyData(const V3NetId&, const uint32_t&);
+      const bool preprocess();
+      // Clause Interface Functions (Called by Helpers in v3SvrSatHelper.h)
+      inline void addClause(const vec<Lit>& lits) {
+         assert (!hasEliminatedVar(lits));
+         if (_simp && _simp->isBuffering()) _simp->addClause(lits); else _Solver->addClause(lits); }
+      inline void addClause(const Lit& lit) {
+         assert (!isEliminatedVar(var(lit)));
+         if (_simp && _simp->isBuffering()) _simp->addClause(lit); else _Solver->addClause(lit); }
    private : 
       // MiniSat Functions
       const Var newVar(const uint32_t&);
       const Var getVerifyData(const V3NetId&, const uint32_t&) const;
+      const Var setVerifyData(const uint32_t&, const uint32_t&, const Var&);
+      void accountMemory();
+      // Polarity-aware AIG Encoding Functions
+      void initPolarData();
+      void addPolarAigData(const V3NetId&, const uint32_t&, const unsigned char&);
+      void addPolarAigFormula(const V3NetId&, const uint32_t&, const unsigned char&);
+      const V3GateType getAigCluster(const V3NetId&, V3NetVec&) const;
+      const unsigned char getVerifyPhase(const V3NetId&, const uint32_t&) const;
+      void setVerifyPhase(const V3NetId&, const uint32_t&, const unsigned char&);
+      inline const bool isAigClusterNode(const V3NetId& id) const {
+         return AIG_NODE == _ntk->getGateType(id) && 1 == _fanout[id.id]; }
+      // Preprocessing Helper Functions : Vars Removed by Preprocessing must Not be Used Again
+      inline const bool isEliminatedVar(const Var& v) const { return _simp && _simp->isEliminated(v); }
+      inline const bool hasEliminatedVar(const vec<Lit>& lits) const {
+         for (int i = 0; i < lits.size(); ++i) if (isEliminatedVar(var(lits[i]))) return true;
+         return false; }
       // Helper Functions : Transformation Between Internal and External Representations
       inline const Var getOriVar(const size_t& v) const { return (Var)(v >> 1ul); }
       inline const size_t getPosVar(const Var& v) const { return (((size_t)v) << 1ul); }
@@ -93,7 +123,17 @@ class V3SvrMiniSat : public V3SvrBase
       Var            _curVar;    // Latest Fresh Variable
       vec<Lit>       _assump;    // Assumption List for assumption solve
       V3SvrMLitData  _init;      // Initial state Var storage
-      V3SvrMVarTable _ntkData;   // Mapping between V3NetId and Solver Data
+      V3UI32Vec      _ntkSlot;   // Dense Slot of Each Net (V3NtkUD if Never Encoded)
+      uint32_t       _slotSize;  // Number of Assigned Slots
+      V3SvrMVarTable _ntkData;   // Frame-major Mapping between Slots and Solver Data
+      // Polarity-aware Encoding Data (AIG Ntk Only)
+      bool              _polarity;  // Encode with Polarities and Gate Clusters
+      V3UI32Vec         _fanout;    // Number of Fanouts of Each Net
+      V3SvrMPhaseTable  _ntkPhase;  // Frame-major Encoded Phases of Slots (1 : Net = 1 Side, 2 : Net = 0 Side)
+      // CNF Preprocessing Data
+      V3SvrCnfSimp*     _simp;      // Clause Buffer and Preprocessor (NULL if Disabled)
+      // Memory Accounting Data
+      uint64_t          _memClauses;   // Number of Clauses Reported to v3MemAccount
 };
 
 #endif
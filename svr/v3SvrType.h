@@ -28,7 +28,9 @@ typedef V3Vec<V3SvrDataVec>::Vec    V3SvrDataTable;
 // Defines for MiniSAT
 typedef V3Vec<Var>::Vec             V3SvrMVarData;
 typedef V3Vec<Lit>::Vec             V3SvrMLitData;
-typedef V3Vec<V3SvrMVarData>::Vec   V3SvrMVarTable;
+typedef V3Vec<V3SvrMVarData>::Vec   V3SvrMVarTable;  // Indexed by Frame, then by Net Slot
+typedef V3Vec<unsigned char>::Vec   V3SvrMPhaseData;
+typedef V3Vec<V3SvrMPhaseData>::Vec V3SvrMPhaseTable;
 
 // Defines for Boolector
 typedef struct BtorNode             BtorExp;
@@ -18,16 +18,26 @@
 #include <cstring>
 #include <iomanip>
 
+#include <time.h>
 #include <stdio.h>
 #include <unistd.h>
+#include <pthread.h>
+#include <sys/syscall.h>
 #include <sys/resource.h>
 
 #undef   MYCLK_TCK
 #define  MYCLK_TCK sysconf(_SC_CLK_TCK)
 
+// Period of Resident Memory Sampling (in Microseconds)
+#define  V3_MEM_SAMPLE_PERIOD 20000
+
 class V3Usage;
 class V3Stat;
+class V3StatDB;
+class V3MemAccount;
 extern V3Usage v3Usage;
+extern V3StatDB v3StatDB;
+extern V3MemAccount v3MemAccount;
 
 class V3Usage 
 {
@@ -117,19 +127,192 @@ class V3Usage
       double   _totalUsedTime;
 };
 
+// class V3MemAccount : Low-overhead Memory Accounting for Memory Bound Checks
+// A background sampler refreshes the resident set size, and storage growth reported by
+// solvers and networks in between is added on top of it, so reading the usage is a single
+// atomic load instead of parsing /proc under a lock.
+class V3MemAccount
+{
+   public : 
+      // Constructor and Destructor
+      V3MemAccount() { pthread_mutex_init(&_mutex, NULL); _memBytes = 0; _sampling = false; }
+      ~V3MemAccount() { pthread_mutex_destroy(&_mutex); }
+      // Accounting Functions
+      inline void allocate(const uint64_t& bytes) { __atomic_fetch_add(&_memBytes, bytes, __ATOMIC_RELAXED); }
+      inline const uint64_t getMemBytes() {
+         if (!__atomic_load_n(&_sampling, __ATOMIC_ACQUIRE)) sample();
+         return __atomic_load_n(&_memBytes, __ATOMIC_RELAXED); }
+      inline const double getMemUsage() { return getMemBytes() / 1048576.0; }
+      // Sampler Functions
+      void startSampler() {
+         pthread_mutex_lock(&_mutex);
+         if (!__atomic_load_n(&_sampling, __ATOMIC_RELAXED)) {
+            pthread_t sampler; sample();
+            if (pthread_create(&sampler, NULL, &samplerMain, (void*)this))
+               Msg(MSG_WAR) << "Failed to Create the Memory Sampler, Memory will be Sampled on Demand !!" << endl;
+            else { pthread_detach(sampler); __atomic_store_n(&_sampling, true, __ATOMIC_RELEASE); }
+         }
+         pthread_mutex_unlock(&_mutex);
+      }
+   private : 
+      // Private Functions
+      void sample() {
+         FILE* file = fopen("/proc/self/statm", "r"); if (!file) return;
+         long pages = 0; if (1 == fscanf(file, "%*s%ld", &pages))
+            __atomic_store_n(&_memBytes, (uint64_t)pages * (uint64_t)sysconf(_SC_PAGESIZE), __ATOMIC_RELAXED);
+         fclose(file);
+      }
+      static void* samplerMain(void* account) {
+         while (true) { usleep(V3_MEM_SAMPLE_PERIOD); ((V3MemAccount*)account)->sample(); }
+         return 0;
+      }
+      // Private Members
+      uint64_t          _memBytes;     // Sampled Resident Memory plus Growth Reported after Sampling
+      bool              _sampling;     // Whether the Background Sampler is Running
+      pthread_mutex_t   _mutex;
+};
+
+// Event Counters of V3Stat
+enum V3StatCounter
+{
+   V3_STAT_SAT_CALL     = 0,
+   V3_STAT_CONFLICT     = 1,
+   V3_STAT_PROPAGATION  = 2,
+   V3_STAT_CUBE         = 3,
+   V3_STAT_COUNTER_TOTAL
+};
+
+const string V3StatCounterStr[] = { "sat_calls", "conflicts", "propagations", "cubes" };
+
+// Thread-aware Clock Functions (in Nanoseconds)
+static inline const uint64_t getV3WallClockNs() {
+   timespec t; clock_gettime(CLOCK_MONOTONIC, &t); return ((uint64_t)t.tv_sec * 1000000000ull) + t.tv_nsec; }
+static inline const uint64_t getV3ThreadClockNs() {
+   timespec t; clock_gettime(CLOCK_THREAD_CPUTIME_ID, &t); return ((uint64_t)t.tv_sec * 1000000000ull) + t.tv_nsec; }
+static inline const uint64_t getV3ThreadId() { return (uint64_t)syscall(SYS_gettid); }
+
+// struct V3StatRecord : Snapshot of a V3Stat for Export
+struct V3StatRecord
+{
+   string      group;
+   string      name;
+   string      ref;
+   uint64_t    thread;
+   uint32_t    called;
+   uint64_t    wallNs;
+   uint64_t    cpuNs;
+   uint64_t    count[V3_STAT_COUNTER_TOTAL];
+};
+
+// class V3StatDB : Records of Finished V3Stat from All Threads
+// V3Stat objects are owned by verification engines and are deleted with them,
+// so each one archives its final record here for later export.
+class V3StatDB
+{
+   public : 
+      // Constructor and Destructor
+      V3StatDB() { pthread_mutex_init(&_mutex, NULL); _records.clear(); }
+      ~V3StatDB() { pthread_mutex_destroy(&_mutex); _records.clear(); }
+      // Record Functions
+      inline void push(const V3StatRecord& r) {
+         pthread_mutex_lock(&_mutex); _records.push_back(r); pthread_mutex_unlock(&_mutex); }
+      inline void reset() { pthread_mutex_lock(&_mutex); _records.clear(); pthread_mutex_unlock(&_mutex); }
+      inline const size_t size() { pthread_mutex_lock(&_mutex); const size_t s = _records.size(); pthread_mutex_unlock(&_mutex); return s; }
+      // Export Functions
+      void report(ostream& os) {
+         pthread_mutex_lock(&_mutex);
+         for (size_t i = 0; i < _records.size(); ++i) {
+            const V3StatRecord& r = _records[i];
+            os << left << setw(8) << r.group << setw(20) << r.name << "[Thread = " << r.thread << "; "
+               << "Total Called = " << r.called << ", Wall = " << fixed << setprecision(6) << (r.wallNs / 1e9)
+               << ", CPU = " << setprecision(6) << (r.cpuNs / 1e9);
+            for (uint32_t j = 0; j < V3_STAT_COUNTER_TOTAL; ++j)
+               if (r.count[j]) os << ", " << V3StatCounterStr[j] << " = " << r.count[j];
+            os << "]" << endl;
+         }
+         pthread_mutex_unlock(&_mutex);
+      }
+      void writeJSON(ostream& os) {
+         pthread_mutex_lock(&_mutex); os << "[" << endl;
+         for (size_t i = 0; i < _records.size(); ++i) {
+            const V3StatRecord& r = _records[i];
+            os << "  {\"group\": \"" << escapeJSON(r.group) << "\", \"name\": \"" << escapeJSON(r.name)
+               << "\", \"ref\": \"" << escapeJSON(r.ref) << "\", \"thread\": " << r.thread
+               << ", \"calls\": " << r.called << ", \"wall_ns\": " << r.wallNs << ", \"cpu_ns\": " << r.cpuNs;
+            for (uint32_t j = 0; j < V3_STAT_COUNTER_TOTAL; ++j) os << ", \"" << V3StatCounterStr[j] << "\": " << r.count[j];
+            os << "}" << ((1 + i) < _records.size() ? "," : "") << endl;
+         }
+         os << "]" << endl; pthread_mutex_unlock(&_mutex);
+      }
+      void writeCSV(ostream& os) {
+         pthread_mutex_lock(&_mutex); os << "group,name,ref,thread,calls,wall_ns,cpu_ns";
+         for (uint32_t j = 0; j < V3_STAT_COUNTER_TOTAL; ++j) os << "," << V3StatCounterStr[j];
+         os << endl;
+         for (size_t i = 0; i < _records.size(); ++i) {
+            const V3StatRecord& r = _records[i];
+            os << escapeCSV(r.group) << "," << escapeCSV(r.name) << "," << escapeCSV(r.ref) << "," << r.thread << ","
+               << r.called << "," << r.wallNs << "," << r.cpuNs;
+            for (uint32_t j = 0; j < V3_STAT_COUNTER_TOTAL; ++j) os << "," << r.count[j];
+            os << endl;
+         }
+         pthread_mutex_unlock(&_mutex);
+      }
+   private : 
+      // Private Helper Functions
+      static const string escapeJSON(const string& str) {
+         string out = ""; char hex[8];
+         for (size_t i = 0; i < str.size(); ++i) {
+            const unsigned char c = (unsigned char)str[i];
+            if ('"' == c || '\\' == c) { out += '\\'; out += str[i]; }
+            else if (c < 0x20) { snprintf(hex, sizeof(hex), "\\u%04x", c); out += hex; }  // Control Characters
+            else out += str[i];
+         }
+         return out;
+      }
+      static const string escapeCSV(const string& str) {
+         if (string::npos == str.find_first_of(",\"\n")) return str;
+         string out = "\"";
+         for (size_t i = 0; i < str.size(); ++i) { if ('"' == str[i]) out += '"'; out += str[i]; }
+         return out + "\"";
+      }
+      // Private Members
+      vector<V3StatRecord> _records;
+      pthread_mutex_t      _mutex;
+};
+
+// class V3Stat : Profiling Statistic of a Verification Step
+// Time is measured with the monotonic wall clock and the CPU clock of the calling thread,
+// so engines running concurrently in a portfolio report their own usage.
+// NOTE : start() and end() must be called from the same thread !!
 class V3Stat
 {
    public : 
       // Constructor and Destructor
-      V3Stat(const string& name, V3Stat* const ref = 0) : _statName(name), _refStat(ref) {
-         _timeAccum = 0; _isStarted = 0; _numCalled = 0;
+      V3Stat(const string& name, V3Stat* const ref = 0, const string& group = "")
+         : _statName(name), _refName(ref ? ref->_statName : ""),
+           _groupName((ref && !group.size()) ? ref->_groupName : group), _refStat(ref) {
+         _wallAccum = _cpuAccum = 0; _isStarted = 0; _numCalled = 0; _threadId = 0;
+         for (uint32_t i = 0; i < V3_STAT_COUNTER_TOTAL; ++i) _count[i] = 0;
+      }
+      ~V3Stat() {
+         if (!_numCalled && !_count[V3_STAT_SAT_CALL] && !_count[V3_STAT_CUBE]) return;
+         V3StatRecord r; r.group = _groupName; r.name = _statName; r.ref = _refName;
+         r.thread = _threadId; r.called = _numCalled; r.wallNs = _wallAccum; r.cpuNs = _cpuAccum;
+         for (uint32_t i = 0; i < V3_STAT_COUNTER_TOTAL; ++i) r.count[i] = _count[i];
+         v3StatDB.push(r);
       }
-      ~V3Stat() {}
       // Inline Member Functions
-      inline void start() { assert (!_isStarted); _startTime = clock(); ++_numCalled; _isStarted = 1; }
-      inline void end() { assert (_isStarted); _timeAccum += (clock() - _startTime) / CLOCKS_PER_SEC; _isStarted = 0; }
+      inline void start() {
+         assert (!_isStarted); if (!_threadId) _threadId = getV3ThreadId();
+         _startWall = getV3WallClockNs(); _startCpu = getV3ThreadClockNs(); ++_numCalled; _isStarted = 1; }
+      inline void end() {
+         assert (_isStarted); _wallAccum += (getV3WallClockNs() - _startWall);
+         _cpuAccum += (getV3ThreadClockNs() - _startCpu); _isStarted = 0; }
+      inline void count(const V3StatCounter& c, const uint64_t& n = 1) { assert (c < V3_STAT_COUNTER_TOTAL); _count[c] += n; }
+      inline const uint64_t getCount(const V3StatCounter& c) const { assert (c < V3_STAT_COUNTER_TOTAL); return _count[c]; }
       inline const uint32_t getNumCalled() const { assert (!_isStarted); return _numCalled; }
-      inline const double getAccumTime() const { assert (!_isStarted); return _timeAccum; }
+      inline const double getAccumTime() const { assert (!_isStarted); return _cpuAccum / 1e9; }
+      inline const double getAccumWallTime() const { assert (!_isStarted); return _wallAccum / 1e9; }
       inline const double getAvgTime() const { return getAccumTime() / (double)(getNumCalled()); }
       inline const double getAccumToRef() const { return _refStat ? getAccumTime() / _refStat->getAccumTime() : 0; }
       // Operator Overloads
@@ -137,16 +320,25 @@ class V3Stat
          os << left << fixed << setw(20) << stat._statName << "["
             << "Avg Time = " << setprecision(5) << stat.getAvgTime() << "; "
             << "Total Called = " << setprecision(8) << stat.getNumCalled() << ", "
-            << "Time = " << setprecision(6) << stat.getAccumTime();
+            << "Time = " << setprecision(6) << stat.getAccumTime() << ", "
+            << "Wall = " << setprecision(6) << stat.getAccumWallTime();
          if (stat._refStat) os << "  (" << setprecision(5) << (100.00 * stat.getAccumToRef()) << " %)";
+         for (uint32_t i = 0; i < V3_STAT_COUNTER_TOTAL; ++i)
+            if (stat._count[i]) os << ", " << V3StatCounterStr[i] << " = " << stat._count[i];
          os << "]"; return os;
       }
    private : 
       // Private Members
       const string   _statName;
+      const string   _refName;      // Kept as the Reference may be Deleted First
+      const string   _groupName;
       V3Stat* const  _refStat;
-      double         _timeAccum;
-      double         _startTime;
+      uint64_t       _wallAccum;    // Accumulated Wall-clock Time (ns)
+      uint64_t       _cpuAccum;     // Accumulated Thread CPU Time (ns)
+      uint64_t       _startWall;
+      uint64_t       _startCpu;
+      uint64_t       _threadId;     // Thread of the First start()
+      uint64_t       _count[V3_STAT_COUNTER_TOTAL];
       uint32_t       _isStarted :  1;
       uint32_t       _numCalled : 31;
 };
@@ -175,14 +175,14 @@ V3MCWritePropertyCmd::help() const {
 //----------------------------------------------------------------------
 // RUN <-TIMEout (unsigned maxTime)>
 //     <-MEMoryout (unsigned maxMemory)>
-//     <-THReadout (unsigned maxThread)>
+//     <-THReadout (unsigned maxThread)> [-ADaptive] [-CLuster] [-SLice]
 //----------------------------------------------------------------------
 V3CmdExecStatus
 V3MCRunCmd::exec(const string& option) {
    vector<string> options;
    V3CmdExec::lexOptions(option, options);
 
-   bool time = false, mem = false, thrd = false;
+   bool time = false, mem = false, thrd = false, adaptive = false, cluster = false, slice = false;
    bool timeON = false, memON = false, thrdON = false;
    uint32_t maxTime = 0, maxMem = 0, maxThrd = 0;
 
@@ -207,6 +207,27 @@ V3MCRunCmd::exec(const string& option) {
          else if (memON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned maxMemory)");
          else thrd = thrdON = true;
       }
+      else if (v3StrNCmp("-ADaptive", token, 3) == 0) {
+         if (adaptive) return V3CmdExec::errorOption(CMD_OPT_EXTRA, token);
+         else if (timeON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned maxTime)");
+         else if (memON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned maxMemory)");
+         else if (thrdON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned maxThread)");
+         else adaptive = true;
+      }
+      else if (v3StrNCmp("-CLuster", token, 3) == 0) {
+         if (cluster) return V3CmdExec::errorOption(CMD_OPT_EXTRA, token);
+         else if (timeON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned maxTime)");
+         else if (memON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned maxMemory)");
+         else if (thrdON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned maxThread)");
+         else cluster = true;
+      }
+      else if (v3StrNCmp("-SLice", token, 3) == 0) {
+         if (slice) return V3CmdExec::errorOption(CMD_OPT_EXTRA, token);
+         else if (timeON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned maxTime)");
+         else if (memON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned maxMemory)");
+         else if (thrdON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned maxThread)");
+         else slice = true;
+      }
       else if (timeON || memON || thrdON) {
          int temp; if (!v3Str2Int(token, temp)) return V3CmdExec::errorOption(CMD_OPT_ILLEGAL, token);
          if (temp <= 0) return V3CmdExec::errorOption(CMD_OPT_ILLEGAL, token);
@@ -228,7 +249,7 @@ V3MCRunCmd::exec(const string& option) {
    V3NtkHandler* const handler = v3Handler.getCurHandler();
    if (handler) {
       if (handler->getPropertyList().size())
-         startVerificationFromProp(handler, maxThrd, (double)maxTime, (double)maxMem);
+         startVerificationFromProp(handler, maxThrd, (double)maxTime, (double)maxMem, adaptive, cluster, slice);
       else Msg(MSG_ERR) << "NO Property Found !!" << endl;
    }
    else Msg(MSG_ERR) << "Empty Ntk !!" << endl;
@@ -240,7 +261,7 @@ void
 V3MCRunCmd::usage(const bool& verbose) const {
    Msg(MSG_IFO) << "Usage: RUN <-TIMEout (unsigned maxTime)>" << endl;
    Msg(MSG_IFO) << "           <-MEMoryout (unsigned maxMemory)>" << endl;
-   Msg(MSG_IFO) << "           <-THReadout (unsigned maxThread)>" << endl;
+   Msg(MSG_IFO) << "           <-THReadout (unsigned maxThread)> [-ADaptive] [-CLuster] [-SLice]" << endl;
    if (verbose) {
       Msg(MSG_IFO) << "Param: (unsigned maxTime)  : Wall Timeout limit in seconds." << endl;
       Msg(MSG_IFO) << "       (unsigned maxMemory): Memoryout limit in Mega Bytes." << endl;
@@ -248,6 +269,9 @@ V3MCRunCmd::usage(const bool& verbose) const {
       Msg(MSG_IFO) << "       -TIMEout            : Indicate the next number is the timeout limit." << endl;
       Msg(MSG_IFO) << "       -MEMoryout          : Indicate the next number is the memoryout limit." << endl;
       Msg(MSG_IFO) << "       -THReadout          : Indicate the next number is the CPU core limit." << endl;
+      Msg(MSG_IFO) << "       -ADaptive           : Move cores from stalled engines to the ones making progress." << endl;
+      Msg(MSG_IFO) << "       -CLuster            : Verify properties with overlapping COI as groups." << endl;
+      Msg(MSG_IFO) << "       -SLice              : Share COI-reduced networks of properties among checkers." << endl;
    }
 }
 
@@ -11,6 +11,7 @@
 
 #include "v3MCMain.h"
 #include "v3NtkUtil.h"
+#include "v3AlgSimulate.h"
 
 // V3 Vernfication Instance Elaboration Functions
 void mergeFairnessConstraints(V3Ntk* const ntk, V3NetTable& constr) {
@@ -75,8 +76,9 @@ void combineConstraintsToOutputs(V3Ntk* const ntk, const V3UI32Vec& poList, cons
    }
 }
 
-V3NtkHandler* const elaborateSafetyNetwork(V3NtkHandler* const handler, const V3UI32Vec& poList, V3NetTable& invConstr) {
+V3NtkHandler* const elaborateSafetyNetwork(V3NtkHandler* const handler, const V3UI32Vec& poList, V3NetTable& invConstr, const bool& reduceLatch) {
    // This Function Creates a Simplified Network with Outputs Ordered by poList
+   // All PIs are Kept in Order, while Latches out of the COI are Removed if reduceLatch
    assert (handler); assert (handler->getNtk()); assert (poList.size());
    assert (poList.size() == invConstr.size());
    // Collect Property Signals and Invariant Constraints
@@ -94,7 +96,7 @@ V3NtkHandler* const elaborateSafetyNetwork(V3NtkHandler* const handler, const V3
    }
    // Elaborate and Simplify the Network
    V3NetVec p2cMap, c2pMap; p2cMap.clear(); c2pMap.clear(); V3PortableType netHash;
-   V3Ntk* const simpNtk = elaborateNtk(handler, targetNets, p2cMap, c2pMap, netHash); assert (simpNtk);
+   V3Ntk* const simpNtk = elaborateNtk(handler, targetNets, p2cMap, c2pMap, netHash, reduceLatch); assert (simpNtk);
    // Set Output Names for Properties
    V3NtkHandler* const pNtk = new V3NtkHandler(0, simpNtk); assert (pNtk); V3NetId id;
    for (uint32_t i = 0; i < poList.size(); ++i) {
@@ -113,6 +115,72 @@ V3NtkHandler* const elaborateSafetyNetwork(V3NtkHandler* const handler, const V3
    return pNtk;
 }
 
+V3NtkHandler* const elaborateSlicedNetwork(V3NtkHandler* const handler, const uint32_t& po) {
+   // This Function Creates a Network on the COI of Output po, with the Same Output Indices as handler,
+   // where All Other Outputs are Constant 0. Hence Shared Bounds of po can be Used Directly, while
+   // Counterexamples should be Mapped back by mapSlicedResult() for Latches out of the COI.
+   assert (handler); assert (handler->getNtk()); assert (po < handler->getNtk()->getOutputSize());
+   V3NetTable invConstr(1, V3NetVec());
+   V3NtkHandler* const pNtk = elaborateSafetyNetwork(handler, V3UI32Vec(1, po), invConstr, true); assert (pNtk);
+   V3Ntk* const ntk = pNtk->getNtk(); assert (ntk); assert (1 == ntk->getOutputSize());
+   const V3NetId id = ntk->getOutput(0); pNtk->resetOutName(0, ""); ntk->removeLastOutput();
+   for (uint32_t i = 0; i < handler->getNtk()->getOutputSize(); ++i)
+      ntk->createOutput((po == i) ? id : V3NetId::makeNetId(0));
+   pNtk->resetOutName(po, handler->getOutputName(po));
+   return pNtk;
+}
+
+V3NtkHandler* const elaborateClusterNetwork(V3NtkHandler* const handler, const V3UI32Vec& poList) {
+   // This Function Creates a Network on the Joint COI of poList, with Outputs Ordered by poList
+   // and an Additional Last Output Asserted whenever Any of the Properties Fires.
+   // Counterexamples should be Mapped back by mapSlicedResult() for Latches out of the COI.
+   assert (handler); assert (handler->getNtk()); assert (poList.size());
+   V3NetTable invConstr(poList.size(), V3NetVec());
+   V3NtkHandler* const pNtk = elaborateSafetyNetwork(handler, poList, invConstr, true); assert (pNtk);
+   V3Ntk* const ntk = pNtk->getNtk(); assert (ntk); assert (poList.size() == ntk->getOutputSize());
+   const V3GateType type = dynamic_cast<V3BvNtk*>(ntk) ? BV_AND : AIG_NODE;
+   // Create the Disjunction of Property Outputs
+   V3InputVec inputs(2, 0); V3NetId id; inputs[0] = ~(ntk->getOutput(0));
+   for (uint32_t i = 1; i < poList.size(); ++i) {
+      inputs[1] = ~(ntk->getOutput(i)); id = ntk->createNet(); assert (V3NetUD != id);
+      ntk->setInput(id, inputs); ntk->createGate(type, id); inputs[0] = id;
+   }
+   ntk->createOutput(~(inputs[0].id));
+   pNtk->resetOutName(poList.size(), handler->getOutputName(poList[0]) + "_cluster");
+   return pNtk;
+}
+
+const V3VrfResult mapSlicedResult(V3NtkHandler* const handler, const V3UI32Vec& poList, const V3VrfResult& result) {
+   // This Function Maps a Counterexample on the Network Elaborated for the COI of poList back to handler.
+   // PIs are Identical, and Latches of the Slice are the Ones in the COI in the Order of handler.
+   assert (handler); assert (handler->getNtk()); assert (poList.size());
+   if (!result.isCex()) return result;
+   const V3CexTrace& cex = *(result.getCexTrace()); V3Ntk* const ntk = handler->getNtk();
+   V3CexTrace* const mapCex = new V3CexTrace(cex.getTraceSize()); assert (mapCex);
+   for (uint32_t i = 0; i < cex.getTraceDataSize(); ++i) mapCex->pushData(cex.getData(i));
+   if (cex.getInit()) {
+      // Mark Latches in the COI of poList
+      V3BoolVec m(ntk->getNetSize(), false);
+      for (uint32_t i = 0; i < poList.size(); ++i) dfsMarkFaninCone(ntk, ntk->getOutput(poList[i]), m);
+      // Latches out of the COI Take Initial Values Simulated on handler
+      V3AlgSimulate* simulator = 0;
+      if (dynamic_cast<V3BvNtk*>(ntk)) simulator = new V3AlgBvSimulate(handler);
+      else simulator = new V3AlgAigSimulate(handler); assert (simulator);
+      simulator->reset(); simulator->updateNextStateValue();
+      uint32_t initSize = 0; for (uint32_t i = 0; i < ntk->getLatchSize(); ++i) initSize += ntk->getNetWidth(ntk->getLatch(i));
+      const V3BitVecX& sliceInit = *(cex.getInit()); V3BitVecX init(initSize), value;
+      for (uint32_t i = 0, j = 0, k = 0; i < ntk->getLatchSize(); ++i) {
+         const uint32_t width = ntk->getNetWidth(ntk->getLatch(i));
+         if (m[ntk->getLatch(i).id]) { value = sliceInit.bv_slice(j + width - 1, j); j += width; assert (j <= sliceInit.size()); }
+         else value = simulator->getSimValue(ntk->getLatch(i)).bv_slice(width - 1, 0);
+         for (uint32_t b = 0; b < width; ++b, ++k) {
+            if ('0' == value[b]) init.set0(k); else if ('1' == value[b]) init.set1(k); else init.setX(k); }
+      }
+      mapCex->setInit(init); delete simulator;
+   }
+   V3VrfResult mapResult; mapResult.setCexTrace(mapCex); return mapResult;
+}
+
 V3NtkHandler* const elaborateLivenessNetwork(V3NtkHandler* const handler, const V3UI32Vec& poList, V3NetTable& invConstr, V3NetTable& fairConstr) {
    // This Function Create a Simplified Network with Outputs Ordered by poList.
    // Moreover, Fairness Constraints are Strengthened by Other Fairness Constraints.
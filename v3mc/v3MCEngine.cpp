@@ -24,6 +24,11 @@
 #include "v3MCEngine.h"
 #include "v3StgExtract.h"
 
+// Memory Budget of an Engine w.r.t. its Fair Share of the Shared Memory Bound
+#define V3MC_ENGINE_MEMORY_SHARE 2.00
+// Number of Latches from which Uniqueness Constraints are Added Lazily
+#define V3MC_LAZY_UNIQUENESS_LATCHES 1000
+
 // V3 Verification Engine Configuration Functions
 V3VrfBase* getChecker(const V3MCEngineType& type, V3NtkHandler* const handler, const uint32_t& ntkSize) {
    assert (type < V3MC_TOTAL); assert (handler); assert (handler->getNtk());
@@ -43,6 +48,7 @@ V3VrfBase* getChecker(const V3MCEngineType& type, V3NtkHandler* const handler, c
       checker->setIncDepth(ceil(5.00 * ratio));
       checker->setFireOnly(true);
       checker->setUniqueness(true);
+      checker->setLazyUniqueness(V3MC_LAZY_UNIQUENESS_LATCHES <= handler->getNtk()->getLatchSize());
       checker->setMaxDepth(V3NtkUD);
       return checker;
    }
@@ -51,6 +57,7 @@ V3VrfBase* getChecker(const V3MCEngineType& type, V3NtkHandler* const handler, c
       checker->setPreDepth(ceil(30.00 * ratio));
       checker->setIncDepth(ceil(5.00 * ratio));
       checker->setUniqueness(true);
+      checker->setLazyUniqueness(V3MC_LAZY_UNIQUENESS_LATCHES <= handler->getNtk()->getLatchSize());
       checker->setMaxDepth(V3NtkUD);
       return checker;
    }
@@ -59,6 +66,7 @@ V3VrfBase* getChecker(const V3MCEngineType& type, V3NtkHandler* const handler, c
       checker->setIncDepth(ceil(20.00 * ratio));
       checker->setProveOnly(true);
       checker->setUniqueness(true);
+      checker->setLazyUniqueness(V3MC_LAZY_UNIQUENESS_LATCHES <= handler->getNtk()->getLatchSize());
       checker->setMaxDepth(V3NtkUD);
       return checker;
    }
@@ -220,6 +228,7 @@ V3VrfBase* getChecker(const V3MCEngineType& type, V3NtkHandler* const handler, c
       klChecker->setRecycle(300);
       checker->setChecker(klChecker);
       checker->setIncDepth(ceil(10.00 * ratio));
+      checker->setIncCounter(true);
       checker->setMaxDepth(V3NtkUD);
       return checker;
    }
@@ -229,6 +238,7 @@ V3VrfBase* getChecker(const V3MCEngineType& type, V3NtkHandler* const handler, c
       klChecker->setRecycle(300);
       checker->setChecker(klChecker);
       checker->setIncDepth(ceil(10.00 * ratio));
+      checker->setIncCounter(true);
       checker->setMaxDepth(V3NtkUD);
       return checker;
    }
@@ -269,6 +279,12 @@ V3VrfBase* getChecker(const V3MCEngineType& type, V3NtkHandler* const handler, c
    else return 0;  // V3MC_IDLE or V3MC_TOTAL
 }
 
+const double getCheckerMemoryBudget(const V3MCEngineType& type, const double& maxMemory, const uint32_t& cores) {
+   // Engines Rarely Peak Together, so each is Allowed to Exceed its Fair Share of maxMemory
+   assert (type < V3MC_TOTAL); if ((V3MC_SIM == type) || !cores) return 0;
+   return (V3MC_ENGINE_MEMORY_SHARE * maxMemory) / (double)cores;
+}
+
 void getDefaultCheckerList(const V3MCMainType& type, const uint32_t& pSize, V3MCEngineList& checkers) {
    checkers.clear();
    switch (type) {
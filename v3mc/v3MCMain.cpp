@@ -14,6 +14,19 @@
 #include "v3NumUtil.h"
 #include "v3VrfResult.h"
 
+// Adaptive Portfolio Settings
+#define V3MC_PORTFOLIO_STALL_CALLS    3     // Consecutive Calls without Progress before an Engine Stalls
+#define V3MC_PORTFOLIO_MIN_PROGRESS   0.01  // Least Progress of a Call that is Not Regarded as a Stall
+#define V3MC_PORTFOLIO_DECAY          0.50  // Weight of the Latest Call in the Moving Average
+
+// Property Clustering Settings
+#define V3MC_CLUSTER_MIN_SIMILARITY   0.80  // Least Jaccard Similarity of Latch COIs in a Cluster
+#define V3MC_CLUSTER_MAX_SIZE         64    // Max Number of Properties in a Cluster
+
+// Property Slicing Settings
+#define V3MC_SLICE_MAX_RATIO          0.50  // Max Ratio of Latches in a Slice to Use it instead of the Whole Network
+#define V3MC_SLICE_MAX_CHECKERS       16    // Max Number of Checkers on Slices Kept by an Engine Thread
+
 /* -------------------------------------------------- *\
  * Class V3MCResource Implementations
 \* -------------------------------------------------- */
@@ -126,7 +139,170 @@ V3MCResult::updateResult(const uint32_t& p, const V3VrfResult& result) {
    if (update) _result[p] = result; unlock(); return update;
 }
 
+/* -------------------------------------------------- *\
+ * Class V3MCPortfolio Implementations
+\* -------------------------------------------------- */
+// Constructor and Destructor
+V3MCPortfolio::V3MCPortfolio(const V3MCMainType& t, const V3MCEngineList& e) : V3VrfShared(), _type(t) {
+   assert (e.size()); _engine = e; _index = 0;
+   _running = V3UI32Vec(e.size(), 0); _calls = V3UI32Vec(e.size(), 0);
+   _stalls = V3UI32Vec(e.size(), 0); _score = V3DblVec(e.size(), 0);
+}
+
+V3MCPortfolio::~V3MCPortfolio() {
+}
+
+// Member Functions
+const V3MCEngineType
+V3MCPortfolio::selectEngine() {
+   lock(); uint32_t i = 0, select = 0;  // 0 : Untried, 1 : Best Progress, 2 : All Engines Stall
+   // Try Every Engine Once in the Default Order
+   for (; i < _engine.size(); ++i) if (!_calls[i] && !_running[i]) break;
+   if (_engine.size() == i) {
+      // Prefer the Engine with the Best Progress per Running Checker
+      double best = -1, score; select = 1;
+      for (uint32_t j = 0; j < _engine.size(); ++j) {
+         if (V3MC_PORTFOLIO_STALL_CALLS <= _stalls[j]) continue;
+         score = _score[j] / (double)(1 + _running[j]); if (score > best) { best = score; i = j; }
+      }
+      if (_engine.size() == i) { i = (_index++) % _engine.size(); select = 2; }
+   }
+   ++_running[i]; const V3MCEngineType type = _engine[i];
+   V3VrfShared::printLock();
+   Msg(MSG_IFO) << "PORTFOLIO " << V3MCMainTypeStr[_type] << " : Start " << V3MCEngineTypeStr[type] << " (";
+   if (!select) Msg(MSG_IFO) << "untried";
+   else if (1 == select) Msg(MSG_IFO) << "score = " << _score[i];
+   else Msg(MSG_IFO) << "all engines stall";
+   Msg(MSG_IFO) << "), running = " << _running[i] << endl;
+   V3VrfShared::printUnlock();
+   unlock(); return type;
+}
+
+void
+V3MCPortfolio::reportProgress(const V3MCEngineType& type, const double& progress) {
+   lock(); const uint32_t i = getEngineIndex(type);
+   if (_engine.size() != i) {
+      _score[i] = (_calls[i]++) ? (((1.00 - V3MC_PORTFOLIO_DECAY) * _score[i]) + (V3MC_PORTFOLIO_DECAY * progress)) : progress;
+      if (progress >= V3MC_PORTFOLIO_MIN_PROGRESS) _stalls[i] = 0;
+      else if (V3MC_PORTFOLIO_STALL_CALLS == ++_stalls[i]) {
+         V3VrfShared::printLock();
+         Msg(MSG_IFO) << "PORTFOLIO " << V3MCMainTypeStr[_type] << " : " << V3MCEngineTypeStr[type]
+                      << " Stalls after " << _calls[i] << " calls, score = " << _score[i] << endl;
+         V3VrfShared::printUnlock();
+      }
+   }
+   unlock();
+}
+
+const bool
+V3MCPortfolio::isStalled(const V3MCEngineType& type) {
+   lock(); const uint32_t i = getEngineIndex(type); uint32_t j = 0;
+   // Release the Core Only if Another Engine Makes More Progress
+   if (_engine.size() != i && V3MC_PORTFOLIO_STALL_CALLS <= _stalls[i])
+      for (; j < _engine.size(); ++j) if (V3MC_PORTFOLIO_STALL_CALLS > _stalls[j] && _score[j] > _score[i]) break;
+   const bool stalled = (_engine.size() != i) && (_engine.size() != j) && (V3MC_PORTFOLIO_STALL_CALLS <= _stalls[i]);
+   if (stalled) {
+      V3VrfShared::printLock();
+      Msg(MSG_IFO) << "PORTFOLIO " << V3MCMainTypeStr[_type] << " : Stop " << V3MCEngineTypeStr[type]
+                   << " (score = " << _score[i] << ") in Favor of " << V3MCEngineTypeStr[_engine[j]]
+                   << " (score = " << _score[j] << ")" << endl;
+      V3VrfShared::printUnlock();
+   }
+   unlock(); return stalled;
+}
+
+void
+V3MCPortfolio::releaseEngine(const V3MCEngineType& type) {
+   lock(); const uint32_t i = getEngineIndex(type);
+   if (_engine.size() != i) { assert (_running[i]); --_running[i]; } unlock();
+}
+
+// Private Member Functions
+const uint32_t
+V3MCPortfolio::getEngineIndex(const V3MCEngineType& type) const {
+   uint32_t i = 0; for (; i < _engine.size(); ++i) if (type == _engine[i]) break; return i;
+}
+
 // V3 Verification Checker Functions
+V3NtkHandler* const getSlicedNetwork(V3MCMainParam* const p, const V3UI32Vec& propList) {
+   // Get the Network Sliced to the COI of Properties from the Slice Cache, or Create One
+   assert (p); assert (p->_sliceNtk); assert (propList.size());
+   V3NtkHandler* handler = p->_sliceNtk->getNtk(propList); if (handler) return handler;
+   handler = (1 == propList.size()) ? elaborateSlicedNetwork(p->_handler, propList[0])
+                                    : elaborateClusterNetwork(p->_handler, propList);
+   return p->_sliceNtk->insertNtk(propList, handler);
+}
+
+void checkPropertyClusters(V3MCMainParam* const p, const V3MCEngineType& type, const uint32_t& threadIdx, V3BoolVec& solved) {
+   // Verify Each Cluster with One Checker on its Joint COI, where the Bad Signal is the Disjunction of Properties.
+   // A Proof Covers the Whole Cluster; a Counterexample Decides the Fired Properties and the Rest is Verified Again.
+   assert (p); assert (p->_cluster.size()); V3NtkHandler* const pNtk = p->_handler; assert (pNtk);
+   struct timeval curTime; double remainTime, maxTime; V3UI32Vec members;
+   for (uint32_t c = 0; c < p->_cluster.size(); ++c) {
+      const V3UI32Vec& cluster = p->_cluster[(threadIdx + c) % p->_cluster.size()];
+      while (true) {
+         // Collect Unsolved Properties of the Cluster
+         members.clear(); members.reserve(cluster.size());
+         for (uint32_t i = 0; i < cluster.size(); ++i)
+            if (!solved[cluster[i]] && V3NtkUD != p->_sharedBound->getBound(cluster[i])) members.push_back(cluster[i]);
+         if (members.size() < 2) break;
+         // Check Resource Bounds
+         if (p->_sharedMem && !p->_sharedMem->isMemValid()) return;
+         const uint32_t unsolvedSize = p->_sharedBound->getUnsolvedSize(); if (!unsolvedSize) return;
+         gettimeofday(&curTime, NULL); remainTime = p->_maxTime - getTimeUsed(p->_initTime, curTime);
+         if (remainTime < 1.0) return;
+         maxTime = 2 + ceil((remainTime * members.size()) / (double)unsolvedSize);
+         if (maxTime > remainTime) maxTime = remainTime;
+         // Create Checker on the Cluster Network
+         V3NtkHandler* const clusterNtk = p->_sliceNtk ? getSlicedNetwork(p, members) : elaborateClusterNetwork(pNtk, members);
+         assert (clusterNtk);
+         uint32_t size = members.size() + 1;
+         if (!V3SafeMult(size, size)) size = V3NtkUD;
+         if (!V3SafeMult(size, clusterNtk->getNtk()->getNetSize())) size = V3NtkUD;
+         V3VrfBase* const checker = getChecker(type, clusterNtk, size);
+         if (!checker) { if (p->_sliceNtk) p->_sliceNtk->releaseNtk(clusterNtk); else delete clusterNtk; return; }
+         if (v3MCInteractive) {
+            V3VrfShared::printLock();
+            Msg(MSG_DBG) << V3MCMainTypeStr[p->_type] << "/" << V3MCEngineTypeStr[type]
+                         << " Start Verifying Cluster of " << members.size() << " POs from PO[" << members[0]
+                         << "] with MaxTime = " << maxTime << ", Ntk = " << clusterNtk->getNtk()->getNetSize() << "." << endl;
+            V3VrfShared::printUnlock();
+         }
+         // Shared Bounds and Invariants are Indexed on the Main Network, so They are NOT Set
+         checker->setMaxTime(maxTime);
+         checker->setIncVerifyUsingCurResult(true);
+         checker->setIncKeepLastReachability(true);
+         checker->setIncContinueOnLastSolver(false);
+         checker->setIncLastDepthToKeepGoing(0);
+         checker->setSharedMem(p->_sharedMem);
+         if (p->_sharedMem) checker->setMaxMemory(getCheckerMemoryBudget(type, p->_sharedMem->getMaxMemory(),
+                                                                         p->_res->getAvailableCores(p->_type)));
+         checker->verifyProperty(members.size());
+         // Map Results of Cluster Outputs back to Properties
+         uint32_t newSolved = 0;
+         for (uint32_t i = 0; i < members.size(); ++i) {
+            if (!(checker->getResult(i).isCex() || checker->getResult(i).isInv())) continue;
+            solved[members[i]] = true; ++newSolved;
+            // Counterexamples on the Cluster Network are Mapped into New Traces, which are Owned by p->_result
+            V3VrfResult result = mapSlicedResult(pNtk, members, checker->getResult(i));
+            if (!p->_result->updateResult(members[i], result) && result.isCex()) result.clear();
+            if (v3MCInteractive) {
+               V3VrfShared::printLock();
+               struct timeval endTime; gettimeofday(&endTime, NULL);
+               Msg(MSG_DBG) << V3MCMainTypeStr[p->_type] << "/" << V3MCEngineTypeStr[type]
+                            << (checker->getResult(i).isCex() ? " Disproves " : " Proves ") << "Property ("
+                            << members[i] << ") " << pNtk->getOutputName(members[i]) << " in Cluster at time = "
+                            << getTimeUsed(p->_initTime, endTime) << " sec" << endl;
+               V3VrfShared::printUnlock();
+            }
+         }
+         delete checker; if (p->_sliceNtk) p->_sliceNtk->releaseNtk(clusterNtk); else delete clusterNtk;
+         // Verify the Cluster Again Only if a Counterexample Decided Part of It
+         if (!newSolved || (members.size() == newSolved)) break;
+      }
+   }
+}
+
 void* startChecker(void* param) {
    V3MCMainParam* const p = ((V3MCParam*)param)->_mainParam; assert (p); assert (p->_res);
    V3NtkHandler* const pNtk = p->_handler; assert (pNtk); assert (pNtk->getNtk());
@@ -148,6 +324,9 @@ void* startChecker(void* param) {
       if (!V3SafeMult(unsolvedSize, handler->getNtk()->getNetSize())) unsolvedSize = V3NtkUD;
    }
    V3VrfBase* checker = unsolvedSize ? getChecker(type, handler, unsolvedSize) : 0;
+   // The Checker Holds the Reference to the Shared Network and Releases it when Deleted
+   if (checker) checker->setSharedNtk(p->_sharedNtk);
+   else if (p->_sharedNtk && (pNtk != handler)) p->_sharedNtk->releaseNtk(handler);
    if (checker) {
       if (v3MCInteractive) {
          V3VrfShared::printLock();
@@ -158,6 +337,16 @@ void* startChecker(void* param) {
       const double ratio = 1.00 - (1.00 / (double)(((V3MCParam*)param)->_threadIdx));
       const uint32_t startPropIndex = floor((double)(pNtk->getNtk()->getOutputSize()) * ratio);
       V3BoolVec solved(pNtk->getNtk()->getOutputSize(), false);
+      V3DblVec converge(pNtk->getNtk()->getOutputSize(), 0); bool stalled = false;
+      // Checkers on Property Slices are Kept with their Slices, so Later Rounds Continue Incrementally
+      const bool slicing = p->_sliceNtk && !isPropertyIndep && (V3MC_LIVE != p->_type);
+      V3Vec<V3NtkHandler*>::Vec sliceNtk(pNtk->getNtk()->getOutputSize(), 0);
+      V3Vec<V3VrfBase*>::Vec sliceVrf(pNtk->getNtk()->getOutputSize(), 0);
+      V3UI32Vec sliceUse(pNtk->getNtk()->getOutputSize(), 0); uint32_t sliceStamp = 0, sliceSize = 0;
+      V3BoolVec noSlice(pNtk->getNtk()->getOutputSize(), false);
+      // Verify Property Clusters as Groups before Single Properties
+      if (p->_cluster.size() && !isPropertyIndep)
+         checkPropertyClusters(p, type, ((V3MCParam*)param)->_threadIdx, solved);
       struct timeval curTime; double remainTime, maxTime;
       for (uint32_t round = 1; round <= 5; round += 1) {
          // Check Memory Bound
@@ -186,54 +375,97 @@ void* startChecker(void* param) {
                maxTime = 2 + ceil(remainTime / (double)unsolvedSize);
                if (!V3SafeMult(maxTime, pow(round, 2)) || maxTime > remainTime) maxTime = remainTime;
             }
-            checker->setMaxTime(maxTime);
-            // Set Check Remaining Properties By the Latest Result
-            checker->setIncVerifyUsingCurResult(unsolvedSize > 1);
+            // Verify on the Network Sliced to the COI of the Property if it is Much Smaller
+            if (slicing && !sliceVrf[property] && !noSlice[property]) {
+               V3NtkHandler* const slice = getSlicedNetwork(p, V3UI32Vec(1, property)); assert (slice);
+               const double ratio = (double)(slice->getNtk()->getLatchSize()) / (double)(1 + pNtk->getNtk()->getLatchSize());
+               V3VrfBase* const sliceChecker = (ratio > V3MC_SLICE_MAX_RATIO) ? 0 : getChecker(type, slice, unsolvedSize);
+               if (!sliceChecker) { p->_sliceNtk->releaseNtk(slice); noSlice[property] = true; }
+               else {
+                  // Drop the Least Recently Used Slice Checker if Too Many are Kept
+                  if (V3MC_SLICE_MAX_CHECKERS <= sliceSize) {
+                     uint32_t victim = V3NtkUD;
+                     for (uint32_t i = 0; i < sliceVrf.size(); ++i)
+                        if (sliceVrf[i] && (V3NtkUD == victim || sliceUse[i] < sliceUse[victim])) victim = i;
+                     assert (V3NtkUD != victim); delete sliceVrf[victim]; p->_sliceNtk->releaseNtk(sliceNtk[victim]);
+                     sliceVrf[victim] = 0; sliceNtk[victim] = 0; --sliceSize;
+                  }
+                  sliceNtk[property] = slice; sliceVrf[property] = sliceChecker; ++sliceSize;
+               }
+            }
+            const bool onSlice = slicing && sliceVrf[property];
+            V3VrfBase* const vrf = onSlice ? sliceVrf[property] : checker;
+            if (onSlice) sliceUse[property] = ++sliceStamp;
+            vrf->setMaxTime(maxTime);
+            // Set Check Remaining Properties By the Latest Result (Other Outputs of a Slice are Constant)
+            vrf->setIncVerifyUsingCurResult(!onSlice && (unsolvedSize > 1));
             if (v3MCInteractive) {
                V3VrfShared::printLock();
                Msg(MSG_DBG) << V3MCMainTypeStr[p->_type] << "/" << V3MCEngineTypeStr[type]
-                            << " Start Verifying PO[" << property << "] At Round = " << round
+                            << " Start Verifying PO[" << property << "]" << (onSlice ? " on Slice" : "") << " At Round = " << round
                             << " with MaxTime = " << maxTime << ", Unsolved = " << unsolvedSize << "." << endl;
                V3VrfShared::printUnlock();
             }
             // Start Verification
             if (constr.size() && ((V3MC_LIVE == p->_type) || (V3MC_SIM == type)))
-               for (uint32_t i = 0; i < constr.size(); ++i) checker->setConstraint(constr[i], i);
-            checker->setIncKeepLastReachability((V3MC_LIVE == p->_type) ? false : true);
-            checker->setIncContinueOnLastSolver(false);
-            checker->setIncLastDepthToKeepGoing(0);
-            checker->setSharedBound(p->_sharedBound);
-            checker->setSharedInv(p->_sharedInv);
-            checker->setSharedNtk(p->_sharedNtk);
-            checker->setSharedMem(p->_sharedMem);
-            checker->verifyProperty(property);
+               for (uint32_t i = 0; i < constr.size(); ++i) vrf->setConstraint(constr[i], i);
+            vrf->setIncKeepLastReachability((V3MC_LIVE == p->_type) ? false : true);
+            vrf->setIncContinueOnLastSolver(false);
+            vrf->setIncLastDepthToKeepGoing(0);
+            vrf->setSharedBound(p->_sharedBound);
+            // Cube Invariants and Optimized Networks are on the Whole Network, so NOT for Slices
+            vrf->setSharedInv(onSlice ? 0 : p->_sharedInv);
+            vrf->setSharedNtk(onSlice ? 0 : p->_sharedNtk);
+            vrf->setSharedMem(p->_sharedMem);
+            // Set Memory Budget so that a Memory-hungry Engine Degrades before Starving the Others
+            if (p->_sharedMem) vrf->setMaxMemory(getCheckerMemoryBudget(type, p->_sharedMem->getMaxMemory(),
+                                                                        p->_res->getAvailableCores(p->_type)));
+            vrf->verifyProperty(property);
             // Set Result for Reporting
-            bool decided = false;
+            bool decided = false; uint32_t newSolved = 0;
             for (uint32_t i = 0; i < solved.size(); ++i) {
-               if (!(checker->getResult(i).isCex() || checker->getResult(i).isInv())) continue;
-               decided = true; if (solved[i]) continue; solved[i] = true;
-               p->_result->updateResult(i, checker->getResult(i));
+               if (!(vrf->getResult(i).isCex() || vrf->getResult(i).isInv())) continue;
+               decided = true; if (solved[i]) continue; solved[i] = true; ++newSolved;
+               if (onSlice) {
+                  V3VrfResult result = mapSlicedResult(pNtk, V3UI32Vec(1, property), vrf->getResult(i));
+                  if (!p->_result->updateResult(i, result) && result.isCex()) result.clear();
+               }
+               else p->_result->updateResult(i, vrf->getResult(i));
                if (v3MCInteractive) {
                   V3VrfShared::printLock();
                   uint32_t netSize = (p->_sharedNtk ? p->_sharedNtk->getNetSize() : 0);
                   if (!netSize) netSize = pNtk->getNtk()->getNetSize();
                   struct timeval endTime; gettimeofday(&endTime, NULL);
                   Msg(MSG_DBG) << V3MCMainTypeStr[p->_type] << "/" << V3MCEngineTypeStr[type]
-                               << (checker->getResult(i).isCex() ? " Disproves " : " Proves ") << "Property ("
+                               << (vrf->getResult(i).isCex() ? " Disproves " : " Proves ") << "Property ("
                                << i << ") " << pNtk->getOutputName(i) << " at time = " << getTimeUsed(p->_initTime, endTime)
                                << " sec, ntk = " << netSize << endl;
                   V3VrfShared::printUnlock();
                }
             }
+            const uint32_t reached = vrf->getReachedBound(); const double convergence = vrf->getConvergence();
+            // Report Progress (Results, Deeper Bounds and Fixpoint Distance) to the Portfolio
+            if (p->_portfolio) {
+               double progress = newSolved;
+               if (reached > latestBound) progress += (double)(reached - latestBound) / (double)(1 + reached);
+               if (convergence > converge[property]) {
+                  progress += convergence - converge[property]; converge[property] = convergence;
+               }
+               p->_portfolio->reportProgress(type, progress);
+               if ((stalled = p->_portfolio->isStalled(type))) break;
+            }
             if (isPropertyIndep && !decided) break;
             if (p->_sharedMem && !p->_sharedMem->isMemValid()) break;
             tried[property] = true;
          }
-         if (isPropertyIndep) break;
+         if (isPropertyIndep || stalled) break;
       }
+      for (uint32_t i = 0; i < sliceVrf.size(); ++i) {
+         if (!sliceVrf[i]) continue; delete sliceVrf[i]; p->_sliceNtk->releaseNtk(sliceNtk[i]); }
       delete checker; checker = 0;
    }
    // Release Core Before Return
+   if (p->_portfolio) p->_portfolio->releaseEngine(type);
    p->_res->decOccupiedCores(p->_type);
    if (v3MCInteractive) {
       V3VrfShared::printLock();
@@ -252,6 +484,7 @@ void* startVerificationMain(void* param) {
    V3Vec<pthread_t>::Vec threads; threads.clear(); threads.reserve(32);
    V3Vec<V3MCParam>::Vec params; params.clear(); params.reserve(32);
    V3MCEngineList checkers; getDefaultCheckerList(p->_type, handler->getNtk()->getOutputSize(), checkers);
+   p->_portfolio = p->_adaptive ? new V3MCPortfolio(p->_type, checkers) : 0;
    // Start Property Checking
    if (v3MCInteractive) {
       V3VrfShared::printLock();
@@ -261,6 +494,18 @@ void* startVerificationMain(void* param) {
    }
    // Reorder Properties
    if (V3MC_SAFE == p->_type) reorderPropertyByNetLevel(handler, p->_constr, false);
+   // Cluster Properties with Overlapping COI (Keep Clusters of Multiple Properties)
+   p->_cluster.clear();
+   if (p->_clustering && (V3MC_LIVE != p->_type) && (handler->getNtk()->getOutputSize() > 1)) {
+      V3UI32Table cluster; clusterPropertyByCOI(handler, cluster, V3MC_CLUSTER_MIN_SIMILARITY, V3MC_CLUSTER_MAX_SIZE);
+      for (uint32_t i = 0; i < cluster.size(); ++i) if (cluster[i].size() > 1) p->_cluster.push_back(cluster[i]);
+      if (v3MCInteractive) {
+         V3VrfShared::printLock();
+         Msg(MSG_DBG) << V3MCMainTypeStr[p->_type] << " Clusters : " << p->_cluster.size() << " Groups out of "
+                      << cluster.size() << " Clusters" << endl;
+         V3VrfShared::printUnlock();
+      }
+   }
    if (v3MCInteractive) {
       V3VrfShared::printLock();
       Msg(MSG_DBG) << V3MCMainTypeStr[p->_type] << " Properties: " << endl;
@@ -283,7 +528,8 @@ void* startVerificationMain(void* param) {
             V3VrfShared::printUnlock();
          }
          for (uint32_t i = 0; i < threads.size(); ++i) pthread_join(threads[i], 0);
-         return 0;
+         if (p->_portfolio) { delete p->_portfolio; p->_portfolio = 0; }
+         if (p->_sliceNtk) { delete p->_sliceNtk; p->_sliceNtk = 0; } return 0;
       }
       // Resource Control and Update
       const uint32_t occupied = p->_res->getOccupiedCores(p->_type);
@@ -321,7 +567,7 @@ void* startVerificationMain(void* param) {
             // Create Thread for New Verification Engines
             threads.push_back(pthread_t()); params.push_back(V3MCParam());
             params.back()._mainParam = p;
-            params.back()._engineType = checkers[index % checkers.size()];
+            params.back()._engineType = p->_portfolio ? p->_portfolio->selectEngine() : checkers[index % checkers.size()];
             params.back()._threadIdx = params.size(); ++index;
             pthread_create(&threads.back(), NULL, &startChecker, (void*)&params.back());
          }
@@ -409,7 +655,9 @@ void* startVerificationMain(void* param) {
                Msg(MSG_DBG) << V3MCMainTypeStr[p->_type] << " Completed. Waiting for children termination ..." << endl;
                V3VrfShared::printUnlock();
             }
-            for (uint32_t i = 0; i < threads.size(); ++i) pthread_join(threads[i], 0); return 0;
+            for (uint32_t i = 0; i < threads.size(); ++i) pthread_join(threads[i], 0);
+            if (p->_portfolio) { delete p->_portfolio; p->_portfolio = 0; }
+            if (p->_sliceNtk) { delete p->_sliceNtk; p->_sliceNtk = 0; } return 0;
          }
          gettimeofday(&endTime, NULL); if (p->_maxTime <= getTimeUsed(p->_initTime, endTime)) break;
          //if (!unsolved) { if (complete) { sleep(1); exit(0); } sleep(1000000); }
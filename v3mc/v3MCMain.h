@@ -68,6 +68,34 @@ class V3MCResult : public V3VrfShared
       V3VrfResultVec    _result;    // Verification results (i.e. cex or inv, will be deleted after output)
 };
 
+// class V3MCPortfolio : Adaptive Engine Selection for Main Threads
+// Checkers report the progress of each verification call (new results, deeper bounds
+// reached, and frames closer to a fixpoint). Engines that stall give up their cores,
+// and new checkers are created for the engines that currently make the most progress.
+class V3MCPortfolio : public V3VrfShared
+{
+   public :
+      // Constructor and Destructor
+      V3MCPortfolio(const V3MCMainType&, const V3MCEngineList&);
+      ~V3MCPortfolio();
+      // Member Functions
+      const V3MCEngineType selectEngine();
+      void reportProgress(const V3MCEngineType&, const double&);
+      const bool isStalled(const V3MCEngineType&);
+      void releaseEngine(const V3MCEngineType&);
+   private :
+      // Private Member Functions
+      const uint32_t getEngineIndex(const V3MCEngineType&) const;
+      // Private Data Members
+      const V3MCMainType      _type;         // Type of the Main Thread
+      V3MCEngineList          _engine;       // Candidate Engines in Default Order
+      V3UI32Vec               _running;      // Number of Running Checkers of Each Engine
+      V3UI32Vec               _calls;        // Number of Reported Verification Calls
+      V3UI32Vec               _stalls;       // Number of Consecutive Calls without Progress
+      V3DblVec                _score;        // Moving Average of Progress per Call
+      uint32_t                _index;        // Round-robin Index when All Engines Stall
+};
+
 // class V3MCMainParam : Parameters for Model Checking Main Threads
 struct V3MCMainParam
 {
@@ -81,8 +109,13 @@ struct V3MCMainParam
    V3VrfSharedBound*    _mirrorBound;  // Mirror Bound of Checkers
    V3VrfSharedInv*      _sharedInv;    // Shared Cube Invariants
    V3VrfSharedNtk*      _sharedNtk;    // Shared Network Data
+   V3VrfSharedNtk*      _sliceNtk;     // Cache of Property-Sliced Networks (0 : No Slicing)
    V3VrfSharedMem*      _sharedMem;    // Shared Memory Usage
    V3MCResource*        _res;          // Resource Data
+   V3MCPortfolio*       _portfolio;    // Adaptive Engine Selection (0 : Round-robin)
+   bool                 _adaptive;     // Enable Adaptive Engine Selection
+   bool                 _clustering;   // Enable Group Verification of Property Clusters
+   V3UI32Table          _cluster;      // Property Clusters with Overlapping Latch COI
    struct timeval       _initTime;     // Initial Time
    double               _maxTime;      // Runtime Limit
    double               _maxMemory;    // Total Available Memory
@@ -106,17 +139,20 @@ void* startVerificationMain(void*);
 
 // V3 Verification Engine Functions  (v3MCEngine.cpp)
 V3VrfBase* getChecker(const V3MCEngineType&, V3NtkHandler* const, const uint32_t&);
+const double getCheckerMemoryBudget(const V3MCEngineType&, const double&, const uint32_t&);
 void getDefaultCheckerList(const V3MCMainType&, const uint32_t&, V3MCEngineList&);
 
 // V3 Verification Property Reordering Functions  (v3MCReorder.cpp)
 void reorderPropertyByNetId(V3NtkHandler* const, V3NetTable&, const bool&);
 void reorderPropertyByNetLevel(V3NtkHandler* const, V3NetTable&, const bool&);
 void reorderPropertyByCOI(V3NtkHandler* const, V3NetTable&, const bool&);
+void clusterPropertyByCOI(V3NtkHandler* const, V3UI32Table&, const double&, const uint32_t&);
 
 // V3 Property Specification Handling Functions  (v3MCProp.cpp)
 V3NtkHandler* const readProperty(V3NtkHandler* const, const string&);
 void writeProperty(V3NtkHandler* const, const string&, const bool&, const bool&);
-void startVerificationFromProp(V3NtkHandler* const, const uint32_t&, const double&, const double&);
+void startVerificationFromProp(V3NtkHandler* const, const uint32_t&, const double&, const double&, const bool& = false,
+                               const bool& = false, const bool& = false);
 
 // V3 Verification Instance Input Functions  (v3MCAiger.cpp)
 V3NtkInput* readAiger(const string&, V3NetVec&, V3NetVec&, V3NetTable&, const bool&);
@@ -129,7 +165,10 @@ void reportAigerInv(const uint32_t&, const uint32_t&, const string&);
 // V3 Vernfication Instance Elaboration Functions  (v3MCElaborate.cpp)
 void mergeFairnessConstraints(V3Ntk* const, V3NetTable&);
 void combineConstraintsToOutputs(V3Ntk* const, const V3UI32Vec&, const V3NetVec&);
-V3NtkHandler* const elaborateSafetyNetwork(V3NtkHandler* const, const V3UI32Vec&, V3NetTable&);
+V3NtkHandler* const elaborateSafetyNetwork(V3NtkHandler* const, const V3UI32Vec&, V3NetTable&, const bool& = false);
+V3NtkHandler* const elaborateSlicedNetwork(V3NtkHandler* const, const uint32_t&);
+V3NtkHandler* const elaborateClusterNetwork(V3NtkHandler* const, const V3UI32Vec&);
+const V3VrfResult mapSlicedResult(V3NtkHandler* const, const V3UI32Vec&, const V3VrfResult&);
 V3NtkHandler* const elaborateLivenessNetwork(V3NtkHandler* const, const V3UI32Vec&, V3NetTable&, V3NetTable&);
 V3NtkElaborate* const elaborateProperties(V3NtkHandler* const, V3StrVec&, V3UI32Vec&, V3UI32Table&, V3UI32Table&,
                                           const bool&, const bool&, const bool&, const bool&);
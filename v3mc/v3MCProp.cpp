@@ -192,7 +192,9 @@ void writeProperty(V3NtkHandler* const handler, const string& fileName, const bo
    output.close();
 }
 
-void startVerificationFromProp(V3NtkHandler* const handler, const uint32_t& numOfCores, const double& maxTime, const double& maxMemory) {
+void startVerificationFromProp(V3NtkHandler* const handler, const uint32_t& numOfCores, const double& maxTime, const double& maxMemory,
+                               const bool& adaptive, const bool& clustering,
+                               const bool& slicing) {
    // Start Timer
    struct timeval initTime; gettimeofday(&initTime, NULL); assert (handler);
    // Elaborate Property Network
@@ -278,8 +280,11 @@ void startVerificationFromProp(V3NtkHandler* const handler, const uint32_t& numO
       pS._sharedInv = new V3VrfSharedInv();
       pS._sharedNtk = 0;
       //pS._sharedNtk = sharedNtk;
+      pS._sliceNtk = slicing ? new V3VrfSharedNtk() : 0;
       pS._sharedMem = sharedMem;
       pS._res = &res;
+      pS._adaptive = adaptive;
+      pS._clustering = clustering;
       pS._initTime = initTime;
       pS._maxTime = maxTime;
       pS._maxMemory = maxMemory;
@@ -362,8 +367,11 @@ void startVerificationFromProp(V3NtkHandler* const handler, const uint32_t& numO
             pL._sharedInv = new V3VrfSharedInv();
             pL._sharedNtk = 0;
             //pL._sharedNtk = new V3VrfSharedNtk();
+            pL._sliceNtk = slicing ? new V3VrfSharedNtk() : 0;
             pL._sharedMem = sharedMem;
             pL._res = &res;
+            pL._adaptive = adaptive;
+            pL._clustering = clustering;
             pL._initTime = initTime;
             pL._maxTime = maxTime;
             pL._maxMemory = maxMemory;
@@ -389,8 +397,11 @@ void startVerificationFromProp(V3NtkHandler* const handler, const uint32_t& numO
          pK._sharedInv = 0;
          pK._sharedNtk = 0;
          //pK._sharedNtk = new V3VrfSharedNtk();
+         pK._sliceNtk = 0;
          pK._sharedMem = sharedMem;
          pK._res = &res;
+         pK._adaptive = adaptive;
+         pK._clustering = clustering;
          pK._initTime = initTime;
          pK._maxTime = maxTime;
          pK._maxMemory = maxMemory;
@@ -457,8 +468,11 @@ void startVerificationFromProp(V3NtkHandler* const handler, const uint32_t& numO
       pL._sharedInv = new V3VrfSharedInv();
       pL._sharedNtk = 0;
       //pL._sharedNtk = new V3VrfSharedNtk();
+      pL._sliceNtk = slicing ? new V3VrfSharedNtk() : 0;
       pL._sharedMem = sharedMem;
       pL._res = &res;
+      pL._adaptive = adaptive;
+      pL._clustering = clustering;
       pL._initTime = initTime;
       pL._maxTime = maxTime;
       pL._maxMemory = maxMemory;
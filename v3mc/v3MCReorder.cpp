@@ -12,6 +12,9 @@
 #include "v3MCMain.h"
 #include "v3NtkUtil.h"
 
+#include <algorithm>
+#include <iterator>
+
 void reorderPropertyByNetId(V3NtkHandler* const handler, V3NetTable& constr, const bool& live) {
    assert (handler); V3Ntk* const ntk = handler->getNtk(); assert (ntk);
    // Table of Property NetId and Names
@@ -180,4 +183,46 @@ void reorderPropertyByCOI(V3NtkHandler* const handler, V3NetTable& constr, const
    }
 }
 
+void clusterPropertyByCOI(V3NtkHandler* const handler, V3UI32Table& cluster, const double& minSim, const uint32_t& maxSize) {
+   // This Function Partitions Properties into Clusters whose Latch COIs have Jaccard Similarity >= minSim
+   assert (handler); V3Ntk* const ntk = handler->getNtk(); assert (ntk); assert (maxSize);
+   cluster.clear(); cluster.reserve(ntk->getOutputSize());
+   // Compute Latch COI of Each Property (Sorted Net Indices)
+   V3UI32Table propCOI(ntk->getOutputSize()); V3NetVec ffList;
+   for (uint32_t i = 0; i < ntk->getOutputSize(); ++i) {
+      bfsIndexFaninConeFF(ntk, ffList, V3NetVec(1, ntk->getOutput(i)));
+      propCOI[i].reserve(ffList.size());
+      for (uint32_t j = 0; j < ffList.size(); ++j) propCOI[i].push_back(ffList[j].id);
+      std::sort(propCOI[i].begin(), propCOI[i].end());
+   }
+   // Greedily Put Each Property into the Most Similar Cluster
+   V3UI32Table clusterCOI; clusterCOI.clear(); clusterCOI.reserve(ntk->getOutputSize());
+   V3UI32Vec merged; uint32_t best, common, x, y;
+   for (uint32_t i = 0; i < propCOI.size(); ++i) {
+      const V3UI32Vec& coi = propCOI[i]; double bestSim = minSim, sim; best = V3NtkUD;
+      for (uint32_t c = 0; c < clusterCOI.size(); ++c) {
+         if (cluster[c].size() >= maxSize) continue;
+         const V3UI32Vec& cCOI = clusterCOI[c];
+         // Skip Clusters whose Size Ratio Already Bounds the Similarity below the Best
+         x = (coi.size() < cCOI.size()) ? coi.size() : cCOI.size();
+         y = (coi.size() < cCOI.size()) ? cCOI.size() : coi.size();
+         if (y && ((double)x / (double)y) < bestSim) continue;
+         common = 0; x = 0; y = 0;
+         while (x < coi.size() && y < cCOI.size()) {
+            if (coi[x] < cCOI[y]) ++x; else if (cCOI[y] < coi[x]) ++y; else { ++common; ++x; ++y; }
+         }
+         x = coi.size() + cCOI.size() - common;
+         sim = x ? ((double)common / (double)x) : 1.00;
+         if (sim >= bestSim) { bestSim = sim; best = c; }
+      }
+      if (V3NtkUD == best) {
+         cluster.push_back(V3UI32Vec(1, i)); clusterCOI.push_back(coi); continue;
+      }
+      // Merge the COI of the Property into the Cluster
+      cluster[best].push_back(i); merged.clear(); merged.reserve(coi.size() + clusterCOI[best].size());
+      std::set_union(coi.begin(), coi.end(), clusterCOI[best].begin(), clusterCOI[best].end(), back_inserter(merged));
+      clusterCOI[best].swap(merged);
+   }
+}
+
 #endif
@@ -19,7 +19,7 @@
 // Constructor and Destructor
 V3VrfBMC::V3VrfBMC(const V3NtkHandler* const handler) : V3VrfBase(handler) {
    // Private Data Members
-   _preDepth = 0; _incDepth = 1;
+   _preDepth = 0; _incDepth = 1; _preprocess = false;
 }
 
 V3VrfBMC::~V3VrfBMC() {
@@ -47,6 +47,7 @@ vrfRestart:
    struct timeval inittime, curtime; gettimeofday(&inittime, NULL);
    uint32_t lastDepth = getIncLastDepthToKeepGoing(); if (10000000 < lastDepth) lastDepth = 0;
    uint32_t boundDepth = lastDepth ? lastDepth : 0, incSize = 0;
+   bool preprocess = _preprocess;
 
    // Start BMC Based Verification
    V3Ntk* simpNtk = 0; V3SvrBase* solver = 0;
@@ -92,8 +93,17 @@ vrfRestart:
       if (_sharedMem && !_sharedMem->isMemValid()) { delete simpNtk; break; }
       // Initialize Solver
       solver = allocSolver(getSolver(), simpNtk); assert (solver);
+      if (preprocess) {
+         // Encode Unrolled Property Signals, Freeze Them and Simplify the CNF
+         solver->startPreprocess();
+         for (uint32_t i = 0; i < incSize; ++i) {
+            solver->addPolarVerifyData(simpNtk->getOutput(i), 0);
+            solver->freezeVerifyData(simpNtk->getOutput(i), 0);
+         }
+         solver->preprocess();
+      }
       for (uint32_t i = 0, k = 1 + boundDepth - incSize; i < incSize; ++i, ++k) {
-         solver->addBoundedVerifyData(simpNtk->getOutput(i), 0); solver->simplify();
+         solver->addPolarVerifyData(simpNtk->getOutput(i), 0); solver->simplify();
          solver->assumeRelease(); solver->assumeProperty(simpNtk->getOutput(i), false, 0);
          if (solver->assump_solve()) { fired = k; break; }
          solver->assertProperty(simpNtk->getOutput(i), true, 0);
@@ -105,8 +115,11 @@ vrfRestart:
             if (endLineON()) Msg(MSG_IFO) << endl; else Msg(MSG_IFO) << flush;
          }
       }
-      if (V3NtkUD != fired) break; delete solver; delete simpNtk;
-      if (_sharedBound) _sharedBound->updateBound(p, boundDepth);
+      if (V3NtkUD != fired) break;
+      const bool overBudget = isMemBudgetExceeded(getSolverMemory(solver)); delete solver; delete simpNtk;
+      updateSharedBound(p, boundDepth);
+      // Check Memory Budget (Preprocess Later Unrollings before Giving Up)
+      if (overBudget) { if (preprocess) break; preprocess = true; }
    }
 
    // Report Verification Result
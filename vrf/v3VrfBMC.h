@@ -21,12 +21,14 @@ class V3VrfBMC : public V3VrfBase
       // BMC Specific Functions
       inline void setPreDepth(const uint32_t& d) { _preDepth = d; }
       inline void setIncDepth(const uint32_t& d) { _incDepth = d; }
+      inline void setPreprocess(const bool& p) { _preprocess = p; }
    private : 
       // Private Verification Main Functions
       void startVerify(const uint32_t&);
       // Private Data Members
       uint32_t       _preDepth;     // Pre-Run Depth (default = 0)
       uint32_t       _incDepth;     // Increment Depth (default = 1)
+      bool           _preprocess;   // Preprocess CNF of Unrolled Ntk (default = false)
 };
 
 #endif
@@ -15,6 +15,126 @@
 #include "v3VrfResult.h"
 #include "v3AlgSimulate.h"
 
+#include <pthread.h>
+
+/* -------------------------------------------------- *\
+ * Parallel Cube Propagation Helpers
+\* -------------------------------------------------- */
+struct V3VrfPropagateTask {
+   V3SvrBase*              solver;     // Private Solver of the Worker
+   V3SvrDataVec*           activator;  // Frame Activators on the Solver
+   uint32_t*               synced;     // Number of Blocked Cubes Encoded on the Solver
+   bool                    encode;     // Whether T and Invariants are Yet to be Encoded
+   const V3Ntk*            ntk;
+   const V3NetVec*         invariant;  // Nets Asserted False in All Frames
+   const V3Vec<pair<uint32_t, V3NetVec> >::Vec* blocked;  // Cubes Blocked in this Pass with their Frames
+   const V3NetTable*       cubes;      // Candidate Cubes to be Pushed
+   uint32_t                frame, begin, end;
+   V3BoolVec               pushed;     // Whether cube' is Unreachable (Local to Worker, Indexed from begin)
+   V3BoolTable*            cores;      // Literals of cube' in the UNSAT Core (Empty if Unavailable)
+};
+
+void* checkCubesWorker(void* data) {
+   V3VrfPropagateTask* const task = (V3VrfPropagateTask*)data; assert (task);
+   V3SvrBase* const solver = task->solver; assert (solver);
+   const V3Ntk* const ntk = task->ntk; assert (ntk);
+   V3SvrDataVec& activator = *(task->activator);
+   // Encode T Once per Pass
+   if (task->encode) {
+      for (uint32_t i = 0; i < ntk->getLatchSize(); ++i) solver->addBoundedVerifyData(ntk->getLatch(i), 0);
+      for (uint32_t i = 0; i < task->invariant->size(); ++i) {
+         solver->addBoundedVerifyData((*(task->invariant))[i], 0);
+         solver->assertProperty((*(task->invariant))[i], true, 0);
+      }
+   }
+   // Encode Cubes Blocked since the Last Check : (~act_f + ~cube)
+   V3SvrDataVec formula; size_t fId;
+   for (uint32_t i = *(task->synced); i < task->blocked->size(); ++i) {
+      const uint32_t& f = (*(task->blocked))[i].first; const V3NetVec& state = (*(task->blocked))[i].second;
+      while (activator.size() <= f) activator.push_back(solver->reserveFormula());
+      formula.clear(); formula.reserve(1 + state.size()); formula.push_back(solver->getNegFormula(activator[f]));
+      for (uint32_t j = 0; j < state.size(); ++j) {
+         fId = solver->getFormula(ntk->getLatch(state[j].id), 0);
+         formula.push_back(state[j].cp ? fId : solver->getNegFormula(fId));
+      }
+      solver->assertImplyUnion(formula);
+   }
+   *(task->synced) = task->blocked->size(); solver->simplify();
+   // Check Each Cube : SAT(R ^ T ^ cube'), where R is Given by Activators of Frames >= frame
+   V3SvrDataVec coreProofVars; V3SvrDataSet coreProofVarSet;
+   for (uint32_t i = task->begin; i < task->end; ++i) {
+      const V3NetVec& state = (*(task->cubes))[i]; solver->assumeRelease();
+      for (uint32_t f = task->frame; f < activator.size(); ++f) solver->assumeProperty(activator[f]);
+      for (uint32_t j = 0; j < state.size(); ++j) {
+         solver->addBoundedVerifyData(ntk->getLatch(state[j].id), 1);
+         solver->assumeProperty(solver->getFormula(ntk->getLatch(state[j].id), 1), state[j].cp);
+      }
+      if (solver->assump_solve()) continue; task->pushed[i - task->begin] = true;
+      coreProofVars.clear(); solver->getDataConflict(coreProofVars); if (!coreProofVars.size()) continue;
+      coreProofVarSet.clear(); coreProofVarSet.insert(coreProofVars.begin(), coreProofVars.end());
+      V3BoolVec& core = (*(task->cores))[i]; core.resize(state.size());
+      for (uint32_t j = 0; j < state.size(); ++j)
+         core[j] = coreProofVarSet.end() != coreProofVarSet.find(solver->getFormula(ntk->getLatch(state[j].id), 1));
+   }
+   return 0;
+}
+
+/* -------------------------------------------------- *\
+ * Class V3VrfCubePropagator Implementations
+\* -------------------------------------------------- */
+// Constructor and Destructor
+V3VrfCubePropagator::V3VrfCubePropagator(V3SvrBase* const refSolver, const V3Ntk* const ntk, const V3NetVec& invariant,
+                                         const uint32_t& threads) : _ntk(ntk), _invariant(invariant) {
+   // Worker Solvers Share the Layout of refSolver, and are Created Now since refSolver may be Recycled Later
+   assert (refSolver); assert (ntk); assert (threads);
+   _solver.clear(); _solver.reserve(threads);
+   for (uint32_t i = 0; i < threads; ++i) { _solver.push_back(referenceSolver(refSolver)); assert (_solver.back()); }
+   _activator = V3Vec<V3SvrDataVec>::Vec(threads); _synced = V3UI32Vec(threads, 0); _encoded = V3BoolVec(threads, false);
+   _blocked.clear(); _frameOf.clear();
+}
+
+V3VrfCubePropagator::~V3VrfCubePropagator() {
+   for (uint32_t i = 0; i < _solver.size(); ++i) delete _solver[i];
+   _solver.clear(); _activator.clear(); _blocked.clear(); _frameOf.clear();
+}
+
+// Cube Propagation Functions
+void
+V3VrfCubePropagator::addBlockedCube(const uint32_t& frame, const void* const cube, const V3NetVec& state) {
+   // Record a Cube Blocked at frame, Identified by cube (Encoded Again Only if it Moves to a Higher Frame)
+   // NOTE: A Blocked Cube Stays Implied by its Frame, so a Stale or Skipped Entry can Only Weaken R
+   V3HashMap<size_t, uint32_t>::Hash::iterator it = _frameOf.find((size_t)cube);
+   if (_frameOf.end() != it && it->second >= frame) return;
+   _frameOf[(size_t)cube] = frame; _blocked.push_back(make_pair(frame, state));
+}
+
+void
+V3VrfCubePropagator::checkCubes(const uint32_t& frame, const V3NetTable& cubes, V3BoolVec& pushed, V3BoolTable& cores) {
+   // This function checks whether each cube' is unreachable from R ^ T, where R is given by cubes blocked at frames >= frame.
+   // Cubes are independent of each other, so they are split among workers, which encode newly blocked cubes first.
+   pushed = V3BoolVec(cubes.size(), false); cores = V3BoolTable(cubes.size());
+   const uint32_t workers = (cubes.size() < _solver.size()) ? cubes.size() : _solver.size(); if (!workers) return;
+   V3Vec<V3VrfPropagateTask>::Vec tasks(workers); V3Vec<pthread_t>::Vec thread(workers); V3BoolVec spawned(workers, false);
+   const uint32_t chunk = (cubes.size() + workers - 1) / workers;
+   for (uint32_t i = 0; i < workers; ++i) {
+      tasks[i].solver = _solver[i]; tasks[i].activator = &(_activator[i]); tasks[i].synced = &(_synced[i]);
+      tasks[i].encode = !_encoded[i]; _encoded[i] = true;
+      tasks[i].ntk = _ntk; tasks[i].invariant = &_invariant; tasks[i].blocked = &_blocked; tasks[i].cubes = &cubes;
+      tasks[i].frame = frame;
+      tasks[i].begin = (cubes.size() < i * chunk) ? cubes.size() : i * chunk;
+      tasks[i].end = (cubes.size() < tasks[i].begin + chunk) ? cubes.size() : tasks[i].begin + chunk;
+      tasks[i].pushed = V3BoolVec(tasks[i].end - tasks[i].begin, false); tasks[i].cores = &cores;
+   }
+   for (uint32_t i = 0; i < workers; ++i) {
+      spawned[i] = !pthread_create(&thread[i], NULL, checkCubesWorker, &tasks[i]);
+      if (!spawned[i]) checkCubesWorker(&tasks[i]);  // Fall Back to the Calling Thread
+   }
+   for (uint32_t i = 0; i < workers; ++i) {
+      if (spawned[i]) pthread_join(thread[i], NULL);
+      for (uint32_t j = tasks[i].begin; j < tasks[i].end; ++j) pushed[j] = tasks[i].pushed[j - tasks[i].begin];
+   }
+}
+
 /* -------------------------------------------------- *\
  * Class V3VrfBase Implementations
 \* -------------------------------------------------- */
@@ -27,13 +147,13 @@ V3VrfBase::V3VrfBase(const V3NtkHandler* const handler) {
    _handler = const_cast<V3NtkHandler*>(handler); assert (_handler);
    _vrfNtk = handler->getNtk(); assert (_vrfNtk); assert (_vrfNtk->getOutputSize());
    // Private Data Members
-   _constr.clear(); _maxTime = V3DblMAX; _maxDepth = 100; _solverType = V3_SVR_TOTAL;
+   _constr.clear(); _maxTime = V3DblMAX; _maxMemory = 0; _maxDepth = 100; _solverType = V3_SVR_TOTAL;
    // Private Members for Verification Results
    _result = V3VrfResultVec(_vrfNtk->getOutputSize());
    if (_vrfNtk->getModuleSize())
       Msg(MSG_WAR) << "Module Instances will be Treated as Black-Boxes in Model Checking !!" << endl;
    // Private Members for Shared Information
-   _sharedBound = 0; _sharedInv = 0; _sharedNtk = 0; _sharedMem = 0;
+   _sharedBound = 0; _sharedInv = 0; _sharedNtk = 0; _sharedMem = 0; _reachBound = 0;
    // Private Members for Incremental Verification
    _incKeepSilent = 0; _incKeepLastReachability = 0; _incContinueOnLastSolver = 0;
    _incVerifyUsingCurResult = 0; _incLastDepthToKeepGoing = 0;
@@ -64,7 +184,7 @@ V3VrfBase::verifyInOrder() {
 
 void
 V3VrfBase::verifyProperty(const uint32_t& p) {
-   assert (p < _result.size()); startVerify(p);
+   assert (p < _result.size()); _reachBound = 0; startVerify(p);
 }
 
 // Interactive Verbosity Setting Functions
@@ -83,6 +203,7 @@ V3VrfBase::printReportSettings() {
 void
 V3VrfBase::printSolverSettings() {
    Msg(MSG_IFO) << V3SolverTypeStr[getDefaultSolver()];
+   if (V3SvrBase::isPolarityEncode()) Msg(MSG_IFO) << " -Polarity";
 }
 
 // Private Verification Main Functions
@@ -203,5 +324,14 @@ V3VrfBase::checkCommonProof(const uint32_t& p, const V3NetTable& invList, const
    delete solver;
 }
 
+// Functions for Memory Budget of this Engine
+const double
+V3VrfBase::getSolverMemory(const V3SvrBase* const solver) {
+   // Estimated Memory of a Solver in MB (NOTE: Only MiniSat Reports its Clause Database, Learnts Included)
+   // Other Solvers (e.g. Boolector) Report 0, so Memory Budgets only Bound the Data Kept by Engines for Them
+   const V3SvrMiniSat* const miniSat = dynamic_cast<const V3SvrMiniSat*>(solver);
+   return miniSat ? (miniSat->getMemory() / 1024.0) : 0;
+}
+
 #endif
 
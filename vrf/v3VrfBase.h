@@ -15,6 +15,30 @@
 #include "v3NtkHandler.h"
 #include "v3SvrHandler.h"
 
+// class V3VrfCubePropagator : Parallel Cube Propagation of a PDR Pass
+// Workers keep private solvers encoding R ^ T for the whole pass, where cubes are guarded by activators
+// of their frames, so the check on frame i only assumes activators of frames >= i.
+class V3VrfCubePropagator
+{
+   public : 
+      // Constructor and Destructor
+      V3VrfCubePropagator(V3SvrBase* const, const V3Ntk* const, const V3NetVec&, const uint32_t&);
+      ~V3VrfCubePropagator();
+      // Cube Propagation Functions
+      void addBlockedCube(const uint32_t&, const void* const, const V3NetVec&);
+      void checkCubes(const uint32_t&, const V3NetTable&, V3BoolVec&, V3BoolTable&);
+   private : 
+      // Private Data Members
+      const V3Ntk* const                     _ntk;
+      const V3NetVec                         _invariant;  // Nets Asserted False in All Frames
+      V3Vec<V3SvrBase*>::Vec                 _solver;     // Private Solvers of Workers
+      V3Vec<V3SvrDataVec>::Vec               _activator;  // Frame Activators on Each Solver
+      V3UI32Vec                              _synced;     // Number of Blocked Cubes Encoded on Each Solver
+      V3BoolVec                              _encoded;    // Whether T is Encoded on Each Solver
+      V3Vec<pair<uint32_t, V3NetVec> >::Vec  _blocked;    // Cubes Blocked in this Pass with their Frames
+      V3HashMap<size_t, uint32_t>::Hash      _frameOf;    // Highest Frame each Cube is Encoded at
+};
+
 // class V3VrfBase : Base Verification Handler
 class V3VrfBase
 {
@@ -33,6 +57,7 @@ class V3VrfBase
       inline void setMaxTime(const double& t) { assert (t); _maxTime = t; }
       inline void setMaxDepth(const uint32_t& d) { assert (d); _maxDepth = d; }
       inline void setSolver(const V3SolverType& s) { assert (V3_SVR_TOTAL > s); _solverType = s; }
+      inline void setMaxMemory(const double& m) { _maxMemory = m; }  // Memory Budget of this Engine (0 : Unbounded)
       // Verification Shared Information Functions
       inline void setSharedBound(V3VrfSharedBound* const s) { _sharedBound = s; }
       inline void setSharedInv(V3VrfSharedInv* const i) { _sharedInv = i; }
@@ -46,6 +71,9 @@ class V3VrfBase
       inline void setIncLastDepthToKeepGoing(const uint32_t& d) { _incLastDepthToKeepGoing = d; }
       inline void clearResult(const uint32_t& i) { assert (i < _result.size()); _result[i].clear(); }
       inline const V3VrfResult& getResult(const uint32_t& i) const { assert (i < _result.size()); return _result[i]; }
+      // Verification Progress Report Functions
+      inline const uint32_t getReachedBound() const { return _reachBound; }  // Deepest Bound Reached on the Last Property
+      virtual const double getConvergence() const { return 0; }  // Closeness to a Fixpoint in [0, 1]
       // Interactive Verbosity Setting Functions
       static void printReportSettings();
       static inline void resetReportSettings() { setReport(1); setUsage(1); }
@@ -75,6 +103,14 @@ class V3VrfBase
       // Functions for Checking Common Results
       void checkCommonCounterexample(const uint32_t&, const V3CexTrace&);
       void checkCommonProof(const uint32_t&, const V3NetTable&, const bool&);
+      // Functions for Memory Budget of this Engine
+      inline const bool isMemBudgetExceeded(const double& m) const { return _maxMemory && (m > _maxMemory); }
+      inline const bool isMemBudgetRelieved(const double& m) const { return !_maxMemory || ((4 * m) <= (3 * _maxMemory)); }
+      static const double getSolverMemory(const V3SvrBase* const);
+      // Functions for Progress Report
+      inline void updateSharedBound(const uint32_t& p, const uint32_t& b) {
+         if (_reachBound < b) _reachBound = b;
+         if (_sharedBound) _sharedBound->updateBound(p, b); }
       // Functions for Incremental Verification
       inline const bool isIncKeepSilent          () const { return _incKeepSilent;           }
       inline const bool isIncKeepLastReachability() const { return _incKeepLastReachability; }
@@ -88,6 +124,7 @@ class V3VrfBase
       V3Ntk*                     _vrfNtk;
       V3NetTable                 _constr;
       double                     _maxTime;
+      double                     _maxMemory;
       uint32_t                   _maxDepth;
       V3SolverType               _solverType;
       // Private Members for Verification Results
@@ -97,6 +134,7 @@ class V3VrfBase
       V3VrfSharedInv*            _sharedInv;
       V3VrfSharedNtk*            _sharedNtk;
       V3VrfSharedMem*            _sharedMem;
+      uint32_t                   _reachBound;
       // Private Members for Incremental Verification
       uint32_t                   _incKeepSilent           :  1;
       uint32_t                   _incKeepLastReachability :  1;
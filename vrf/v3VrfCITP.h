@@ -96,6 +96,8 @@ class V3VrfCITP : public V3VrfBase
       // Constructor and Destructor
       V3VrfCITP(const V3NtkHandler* const);
       ~V3VrfCITP();
+      // CITP Progress Report Functions
+      inline const double getConvergence() const { return _itpConverge; }
       // CITP Specific Settings
       inline void setBlockBadCount(const uint32_t& m = V3NtkUD) { _itpBadCount = m; }
       inline void setIncrementDepth     (const bool& f) { if (f) _itpAttr |= 1ul;  else _itpAttr &= ~1ul;  }
@@ -131,6 +133,8 @@ class V3VrfCITP : public V3VrfBase
       void generalizeSimulation(V3CITPCube* const, const V3CITPCube* const);
       const bool removeFromProof(V3CITPCube* const);
       const bool generalizeProof(V3CITPCube* const);
+      // CITP Progress Report Functions
+      void updateConvergence();
       // CITP Debug Functions
       void printState(const V3NetVec&) const;
       const string getStateStr(const V3NetVec&) const;
@@ -141,6 +145,7 @@ class V3VrfCITP : public V3VrfBase
       unsigned char     _itpAttr;         // Specific Attributes for CITP
       uint32_t          _itpBMCDepth;     // The Number of Unrolled Frames in BMC Solver
       uint32_t          _itpBadCount;     // Max Bad Cubes to be Blocked for a Given Cube
+      double            _itpConverge;     // Closest Distance to the Fixpoint in the Last Call
       // Private Engines
       V3SvrBase*        _itpBMCSvr;       // The BMC SAT Solver (Counterexample Confirm)
       V3SvrBase*        _itpITPSvr;       // The ITP SAT Solver (Reachability Containment)
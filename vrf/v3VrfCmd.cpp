@@ -179,14 +179,14 @@ V3PrintReportCmd::help() const {
 }
 
 //----------------------------------------------------------------------
-// SET SOlver [|-Default | -Minisat | -Boolector]
+// SET SOlver [|-Default | -Minisat | -Boolector] [-Polarity]
 //----------------------------------------------------------------------
 V3CmdExecStatus
 V3SetSolverCmd::exec(const string& option) {
    vector<string> options;
    V3CmdExec::lexOptions(option, options);
 
-   bool dft = false, minisat = false, boolector = false;
+   bool dft = false, minisat = false, boolector = false, polarity = false;
    
    size_t n = options.size();
    for (size_t i = 0; i < n; ++i) {
@@ -203,6 +203,10 @@ V3SetSolverCmd::exec(const string& option) {
          if (dft || minisat || boolector) return V3CmdExec::errorOption(CMD_OPT_EXTRA, token);
          else boolector = true;
       }
+      else if (v3StrNCmp("-Polarity", token, 2) == 0) {
+         if (polarity) return V3CmdExec::errorOption(CMD_OPT_EXTRA, token);
+         else polarity = true;
+      }
       else return V3CmdExec::errorOption(CMD_OPT_ILLEGAL, token);
    }
 
@@ -212,6 +216,7 @@ V3SetSolverCmd::exec(const string& option) {
    if (minisat) V3VrfBase::setDefaultSolver(V3_SVR_MINISAT);
    else if (boolector) V3VrfBase::setDefaultSolver(V3_SVR_BOOLECTOR);
    else V3VrfBase::resetSolverSettings();
+   V3SvrBase::setPolarityEncode(polarity);
    // Print Verification Solvers
    V3PrintSolverCmd printSolver; return printSolver.exec("");
 
@@ -220,11 +225,12 @@ V3SetSolverCmd::exec(const string& option) {
 
 void
 V3SetSolverCmd::usage(const bool& verbose) const {
-   Msg(MSG_IFO) << "Usage: SET SOlver [|-Default | -Minisat | -Boolector]" << endl;
+   Msg(MSG_IFO) << "Usage: SET SOlver [|-Default | -Minisat | -Boolector] [-Polarity]" << endl;
    if (verbose) {
       Msg(MSG_IFO) << "Param: -Default  : Enable default solver. (default = minisat)" << endl;
       Msg(MSG_IFO) << "       -Minisat  : Enable MiniSat as the active solver." << endl;
       Msg(MSG_IFO) << "       -Boolector: Enable Boolector as the active solver." << endl;
+      Msg(MSG_IFO) << "       -Polarity : Encode AIG with polarity-aware clustered CNF (MiniSat only)." << endl;
    }
 }
 
@@ -759,7 +765,7 @@ V3SIMVrfCmd::help() const {
 // VERify BMC [(string propertyName)]
 //            [-Max-depth (unsigned MaxDepth)]
 //            [-Pre-depth (unsigned PreDepth)]
-//            [-Inc-depth (unsigned IncDepth)]
+//            [-Inc-depth (unsigned IncDepth)] [-Simplify]
 //----------------------------------------------------------------------
 V3CmdExecStatus
 V3BMCVrfCmd::exec(const string& option) {
@@ -767,7 +773,7 @@ V3BMCVrfCmd::exec(const string& option) {
    V3CmdExec::lexOptions(option, options);
 
    string propertyName = "";
-   bool maxD = false, preD = false, incD = false;
+   bool maxD = false, preD = false, incD = false, simp = false;
    bool maxDON = false, preDON = false, incDON = false;
    uint32_t maxDepth = 0, preDepth = 0, incDepth = 0;
    
@@ -792,6 +798,13 @@ V3BMCVrfCmd::exec(const string& option) {
          else if (preDON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned PreDepth)");
          else incD = incDON = true;
       }
+      else if (v3StrNCmp("-Simplify", token, 2) == 0) {
+         if (simp) return V3CmdExec::errorOption(CMD_OPT_EXTRA, token);
+         else if (maxDON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned MaxDepth)");
+         else if (preDON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned PreDepth)");
+         else if (incDON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned IncDepth)");
+         else simp = true;
+      }
       else if (maxDON || preDON || incDON) {
          int temp; if (!v3Str2Int(token, temp)) return V3CmdExec::errorOption(CMD_OPT_ILLEGAL, token);
          if (temp < 0) return V3CmdExec::errorOption(CMD_OPT_ILLEGAL, token);
@@ -823,6 +836,7 @@ V3BMCVrfCmd::exec(const string& option) {
             if (maxD) checker->setMaxDepth(maxDepth);
             if (preD) checker->setPreDepth(preDepth);
             if (incD) checker->setIncDepth(incDepth);
+            if (simp) checker->setPreprocess(true);
             checker->verifyInOrder();
             // Set Verification Result
             if (checker->getResult(0).isCex() || checker->getResult(0).isInv())
@@ -844,7 +858,7 @@ V3BMCVrfCmd::exec(const string& option) {
 void
 V3BMCVrfCmd::usage(const bool& verbose) const {
    Msg(MSG_IFO) << "Usage: VERify BMC [(string propertyName)] [-Max-depth (unsigned MaxDepth)]" << endl;
-   Msg(MSG_IFO) << "                  [-Pre-depth (unsigned PreDepth)] [-Inc-depth (unsigned IncDepth)]" << endl;
+   Msg(MSG_IFO) << "                  [-Pre-depth (unsigned PreDepth)] [-Inc-depth (unsigned IncDepth)] [-Simplify]" << endl;
    if (verbose) {
       Msg(MSG_IFO) << "Param: (string propertyName): The name of a property to be verified." << endl;
       Msg(MSG_IFO) << "       (unsigned MaxDepth)  : The upper bound of time-frames to be reached. (default = 100)" << endl;
@@ -853,6 +867,8 @@ V3BMCVrfCmd::usage(const bool& verbose) const {
       Msg(MSG_IFO) << "       -Max-depth           : Indicate the following token is the time-frame limit." << endl;
       Msg(MSG_IFO) << "       -Pre-depth           : Indicate the following token is the number of frames at initial." << endl;
       Msg(MSG_IFO) << "       -Inc-depth           : Indicate the following token is the number of frames to be increased." << endl;
+      Msg(MSG_IFO) << "       -Simplify            : Enable CNF preprocessing (variable elimination, subsumption and" << endl;
+      Msg(MSG_IFO) << "                              equivalent literal substitution) on unrolled instances." << endl;
    }
 }
 
@@ -867,7 +883,7 @@ V3BMCVrfCmd::help() const {
 //            [-Pre-depth (unsigned PreDepth)]
 //            [-Inc-depth (unsigned IncDepth)]
 //            [-NOProve | -NOFire]
-//            [-Uniqueness] [-Dynamic]
+//            [-Uniqueness] [-Lazy] [-Dynamic]
 //----------------------------------------------------------------------
 V3CmdExecStatus
 V3UMCVrfCmd::exec(const string& option) {
@@ -879,7 +895,7 @@ V3UMCVrfCmd::exec(const string& option) {
    bool maxDON = false, preDON = false, incDON = false;
    uint32_t maxDepth = 0, preDepth = 0, incDepth = 0;
    bool noProve = false, noFire = false;
-   bool unique = false, dynamic = false;
+   bool unique = false, lazy = false, dynamic = false;
    
    size_t n = options.size();
    for (size_t i = 0; i < n; ++i) {
@@ -905,6 +921,13 @@ V3UMCVrfCmd::exec(const string& option) {
          else if (incDON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned IncDepth)");
          else unique = true;
       }
+      else if (v3StrNCmp("-Lazy", token, 2) == 0) {
+         if (lazy) return V3CmdExec::errorOption(CMD_OPT_EXTRA, token);
+         else if (maxDON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned MaxDepth)");
+         else if (preDON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned PreDepth)");
+         else if (incDON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned IncDepth)");
+         else lazy = true;
+      }
       else if (v3StrNCmp("-Dynamic", token, 2) == 0) {
          if (dynamic) return V3CmdExec::errorOption(CMD_OPT_EXTRA, token);
          else if (maxDON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned MaxDepth)");
@@ -960,7 +983,8 @@ V3UMCVrfCmd::exec(const string& option) {
             // UMC Specific Settings
             checker->setFireOnly(noProve);
             checker->setProveOnly(noFire);
-            checker->setUniqueness(unique);
+            checker->setUniqueness(unique || lazy);
+            checker->setLazyUniqueness(lazy);
             checker->setDynamicInc(dynamic);
             if (maxD) checker->setMaxDepth(maxDepth);
             if (preD) checker->setPreDepth(preDepth);
@@ -987,7 +1011,7 @@ void
 V3UMCVrfCmd::usage(const bool& verbose) const {
    Msg(MSG_IFO) << "Usage: VERify UMC [(string propertyName)] [-Max-depth (unsigned MaxDepth)]" << endl;
    Msg(MSG_IFO) << "                  [-Pre-depth (unsigned PreDepth)] [-Inc-depth (unsigned IncDepth)]" << endl;
-   Msg(MSG_IFO) << "                  [-NOProve | -NOFire] [-Uniqueness]" << endl;
+   Msg(MSG_IFO) << "                  [-NOProve | -NOFire] [-Uniqueness] [-Lazy]" << endl;
    if (verbose) {
       Msg(MSG_IFO) << "Param: (string propertyName): The name of a property to be verified." << endl;
       Msg(MSG_IFO) << "       (unsigned MaxDepth)  : The upper bound of time-frames to be reached. (default = 100)" << endl;
@@ -999,6 +1023,7 @@ V3UMCVrfCmd::usage(const bool& verbose) const {
       Msg(MSG_IFO) << "       -NOProve             : Disable running k-induction in UMC." << endl;
       Msg(MSG_IFO) << "       -NOFire              : Disable performing bounded model checking (BMC) in UMC." << endl;
       Msg(MSG_IFO) << "       -Uniqueness          : Enable adding uniqueness constraints." << endl;
+      Msg(MSG_IFO) << "       -Lazy                : Add uniqueness constraints only between frames repeated on spurious traces." << endl;
    }
 }
 
@@ -1009,17 +1034,19 @@ V3UMCVrfCmd::help() const {
 
 //----------------------------------------------------------------------
 // VERify PDR [(string propertyName)] [-Max-depth (unsigned MaxDepth)]
-//            [-Recycle (unsigned MaxCount)] [-Incremental]
-//            [-FWDSATGen] [-FWDUNSATGen]
+//            [-Recycle (unsigned MaxCount)] [-Incremental | -Delta]
+//            [-Thread (unsigned ThreadNum)] [-FWDSATGen] [-FWDUNSATGen]
+//            [-CTG (unsigned MaxCTG)] [-CTGDepth (unsigned CTGDepth)]
 //----------------------------------------------------------------------
 V3CmdExecStatus
 V3PDRVrfCmd::exec(const string& option) {
    vector<string> options;
    V3CmdExec::lexOptions(option, options);
 
-   bool maxD = false, maxDON = false, recycle = false, recycleON = false;
-   bool incremental = false, fwdSATGen = false, fwdUNSATGen = false;
-   uint32_t maxDepth = 0, recycleCount = 0;
+   bool maxD = false, maxDON = false, recycle = false, recycleON = false, thread = false, threadON = false;
+   bool ctg = false, ctgON = false, ctgDepth = false, ctgDepthON = false;
+   bool incremental = false, delta = false, fwdSATGen = false, fwdUNSATGen = false;
+   uint32_t maxDepth = 0, recycleCount = 0, threadNum = 1, maxCTG = 3, maxCTGDepth = 1;
    string propertyName = "";
    
    size_t n = options.size();
@@ -1028,36 +1055,91 @@ V3PDRVrfCmd::exec(const string& option) {
       if (v3StrNCmp("-Max-depth", token, 2) == 0) {
          if (maxD) return V3CmdExec::errorOption(CMD_OPT_EXTRA, token);
          else if (recycleON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned MaxCount)");
+         else if (threadON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned ThreadNum)");
+         else if (ctgON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned MaxCTG)");
+         else if (ctgDepthON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned CTGDepth)");
          else maxD = maxDON = true;
       }
       else if (v3StrNCmp("-Recycle", token, 2) == 0) {
          if (recycle) return V3CmdExec::errorOption(CMD_OPT_EXTRA, token);
          else if (maxDON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned MaxDepth)");
+         else if (threadON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned ThreadNum)");
+         else if (ctgON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned MaxCTG)");
+         else if (ctgDepthON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned CTGDepth)");
          else recycle = recycleON = true;
       }
+      else if (v3StrNCmp("-Thread", token, 2) == 0) {
+         if (thread) return V3CmdExec::errorOption(CMD_OPT_EXTRA, token);
+         else if (maxDON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned MaxDepth)");
+         else if (recycleON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned MaxCount)");
+         else if (ctgON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned MaxCTG)");
+         else if (ctgDepthON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned CTGDepth)");
+         else thread = threadON = true;
+      }
+      else if (v3StrNCmp("-CTG", token, 4) == 0) {
+         if (ctg) return V3CmdExec::errorOption(CMD_OPT_EXTRA, token);
+         else if (maxDON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned MaxDepth)");
+         else if (recycleON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned MaxCount)");
+         else if (threadON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned ThreadNum)");
+         else if (ctgDepthON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned CTGDepth)");
+         else ctg = ctgON = true;
+      }
+      else if (v3StrNCmp("-CTGDepth", token, 5) == 0) {
+         if (ctgDepth) return V3CmdExec::errorOption(CMD_OPT_EXTRA, token);
+         else if (maxDON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned MaxDepth)");
+         else if (recycleON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned MaxCount)");
+         else if (threadON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned ThreadNum)");
+         else if (ctgON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned MaxCTG)");
+         else ctgDepth = ctgDepthON = true;
+      }
       else if (v3StrNCmp("-Incremental", token, 2) == 0) {
          if (incremental) return V3CmdExec::errorOption(CMD_OPT_EXTRA, token);
          else if (maxDON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned MaxDepth)");
          else if (recycleON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned MaxCount)");
+         else if (threadON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned ThreadNum)");
+         else if (ctgON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned MaxCTG)");
+         else if (ctgDepthON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned CTGDepth)");
          else incremental = true;
       }
+      else if (v3StrNCmp("-Delta", token, 2) == 0) {
+         if (delta) return V3CmdExec::errorOption(CMD_OPT_EXTRA, token);
+         else if (maxDON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned MaxDepth)");
+         else if (recycleON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned MaxCount)");
+         else if (threadON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned ThreadNum)");
+         else if (ctgON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned MaxCTG)");
+         else if (ctgDepthON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned CTGDepth)");
+         else delta = true;
+      }
       else if (v3StrNCmp("-FWDSATGen", token, 8) == 0) {
          if (fwdSATGen) return V3CmdExec::errorOption(CMD_OPT_EXTRA, token);
          else if (maxDON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned MaxDepth)");
          else if (recycleON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned MaxCount)");
+         else if (threadON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned ThreadNum)");
+         else if (ctgON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned MaxCTG)");
+         else if (ctgDepthON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned CTGDepth)");
          else fwdSATGen = true;
       }
       else if (v3StrNCmp("-FWDUNSATGen", token, 10) == 0) {
          if (fwdUNSATGen) return V3CmdExec::errorOption(CMD_OPT_EXTRA, token);
          else if (maxDON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned MaxDepth)");
          else if (recycleON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned MaxCount)");
+         else if (threadON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned ThreadNum)");
+         else if (ctgON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned MaxCTG)");
+         else if (ctgDepthON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned CTGDepth)");
          else fwdUNSATGen = true;
       }
-      else if (maxDON || recycleON) {
+      else if (ctgDepthON) {
+         int temp; if (!v3Str2Int(token, temp)) return V3CmdExec::errorOption(CMD_OPT_ILLEGAL, token);
+         if (temp < 0) return V3CmdExec::errorOption(CMD_OPT_ILLEGAL, token);
+         maxCTGDepth = (uint32_t)temp; ctgDepthON = false;
+      }
+      else if (maxDON || recycleON || threadON || ctgON) {
          int temp; if (!v3Str2Int(token, temp)) return V3CmdExec::errorOption(CMD_OPT_ILLEGAL, token);
          if (temp <= 0) return V3CmdExec::errorOption(CMD_OPT_ILLEGAL, token);
          if (maxDON) { maxDepth = (uint32_t)temp; assert (maxDepth); maxDON = false; }
-         else { recycleCount = (uint32_t)temp; assert (recycleCount); recycleON = false; }
+         else if (recycleON) { recycleCount = (uint32_t)temp; assert (recycleCount); recycleON = false; }
+         else if (threadON) { threadNum = (uint32_t)temp; assert (threadNum); threadON = false; }
+         else { maxCTG = (uint32_t)temp; assert (maxCTG); ctgON = false; }
       }
       else if (propertyName == "") propertyName = token;
       else return V3CmdExec::errorOption(CMD_OPT_ILLEGAL, token);
@@ -1065,6 +1147,12 @@ V3PDRVrfCmd::exec(const string& option) {
    
    if (maxDON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned MaxDepth)");
    if (recycleON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned MaxCount)");
+   if (threadON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned ThreadNum)");
+   if (ctgON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned MaxCTG)");
+   if (ctgDepthON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned CTGDepth)");
+   if ((ctg || ctgDepth) && !incremental)
+      Msg(MSG_WAR) << "CTG Generalization is only Available for Incremental PDR !!" << endl;
+   if (incremental && delta) return V3CmdExec::errorOption(CMD_OPT_ILLEGAL, "-Delta");
 
    // Get Properties to be Verified
    V3NtkHandler* const handler = v3Handler.getCurHandler();
@@ -1084,14 +1172,18 @@ V3PDRVrfCmd::exec(const string& option) {
             if (incremental) {
                V3VrfIPDR* const pdrChecker = dynamic_cast<V3VrfIPDR*>(checker);
                if (recycle) pdrChecker->setRecycle(recycleCount);
+               pdrChecker->setPropagateThreads(threadNum);
+               if (ctg || ctgDepth) pdrChecker->setCTGBound(maxCTG, maxCTGDepth);
                pdrChecker->setForwardSATGen(fwdSATGen);
                pdrChecker->setForwardUNSATGen(fwdUNSATGen);
             }
             else {
                V3VrfMPDR* const pdrChecker = dynamic_cast<V3VrfMPDR*>(checker);
                if (recycle) pdrChecker->setRecycle(recycleCount);
+               pdrChecker->setPropagateThreads(threadNum);
                pdrChecker->setForwardSATGen(fwdSATGen);
                pdrChecker->setForwardUNSATGen(fwdUNSATGen);
+               pdrChecker->setDeltaEncode(delta);
             }
             checker->verifyInOrder();
             // Set Verification Result
@@ -1114,14 +1206,23 @@ V3PDRVrfCmd::exec(const string& option) {
 void
 V3PDRVrfCmd::usage(const bool& verbose) const {
    Msg(MSG_IFO) << "Usage: VERify PDR [(string propertyName)] [-Max-depth (unsigned MaxDepth)]" << endl;
-   Msg(MSG_IFO) << "                  [-Recycle (unsigned MaxCount)] [-Incremental]" << endl;
+   Msg(MSG_IFO) << "                  [-Recycle (unsigned MaxCount)] [-Incremental | -Delta]" << endl;
+   Msg(MSG_IFO) << "                  [-Thread (unsigned ThreadNum)]" << endl;
+   Msg(MSG_IFO) << "                  [-CTG (unsigned MaxCTG)] [-CTGDepth (unsigned CTGDepth)]" << endl;
    if (verbose) {
       Msg(MSG_IFO) << "Param: (string propertyName): The name of a property to be verified." << endl;
       Msg(MSG_IFO) << "       (unsigned MaxDepth)  : The upper bound of time-frames to be reached." << endl;
       Msg(MSG_IFO) << "       (unsigned MaxCount)  : The upper bound of temporary assumption literals in solvers." << endl;
+      Msg(MSG_IFO) << "       (unsigned ThreadNum) : Number of threads propagating cubes of a frame. (Default = 1)" << endl;
+      Msg(MSG_IFO) << "       (unsigned MaxCTG)    : Max CTGs blocked in a row when dropping a literal. (Default = 3)" << endl;
+      Msg(MSG_IFO) << "       (unsigned CTGDepth)  : Max recursion depth of blocking CTGs. (Default = 1)" << endl;
       Msg(MSG_IFO) << "       -Max-depth           : Indicate the following token is the limit of time-frames." << endl;
       Msg(MSG_IFO) << "       -Recycle             : Enable setting the limit of assumption literals for recycle." << endl;
+      Msg(MSG_IFO) << "       -Thread              : Indicate the following token is the number of propagation threads." << endl;
+      Msg(MSG_IFO) << "       -CTG                 : Enable CTG generalization with the following token as MaxCTG. (Incremental only)" << endl;
+      Msg(MSG_IFO) << "       -CTGDepth            : Enable CTG generalization with the following token as CTGDepth." << endl;
       Msg(MSG_IFO) << "       -Incremental         : Implement with multiple solvers. (c.f. Monolithic)" << endl;
+      Msg(MSG_IFO) << "       -Delta               : Delete dead frame clauses in the monolithic solver instead of recycling." << endl;
    }
 }
 
@@ -1280,7 +1381,7 @@ V3ITPVrfCmd::help() const {
 //----------------------------------------------------------------------
 // VERify SEC [(string propertyName)] [-Max-depth (unsigned MaxDepth)]
 //            [-BMC | -UMC | -IPDR | -MPDR | -CITP | -FITP]
-//            [-CEC] [-SEC]
+//            [-CEC] [-SEC] [-FRAig] [-Thread (unsigned ThreadNum)]
 //----------------------------------------------------------------------
 V3CmdExecStatus
 V3SECVrfCmd::exec(const string& option) {
@@ -1288,8 +1389,8 @@ V3SECVrfCmd::exec(const string& option) {
    V3CmdExec::lexOptions(option, options);
 
    bool bmc = false, umc = false, citp = false, fitp = false, mpdr = false, ipdr = false;
-   bool cec = false, sec = false; bool maxD = false, maxDON = false;
-   string propertyName = ""; uint32_t maxDepth = 0;
+   bool cec = false, sec = false, fraig = false; bool maxD = false, maxDON = false;
+   string propertyName = ""; uint32_t maxDepth = 0; bool thread = false; int threadNum = 1;
    
    size_t n = options.size();
    for (size_t i = 0; i < n; ++i) {
@@ -1342,6 +1443,18 @@ V3SECVrfCmd::exec(const string& option) {
          if (sec) return V3CmdExec::errorOption(CMD_OPT_EXTRA, token);
          else sec = true;
       }
+      else if (v3StrNCmp("-FRAig", token, 4) == 0) {
+         if (fraig) return V3CmdExec::errorOption(CMD_OPT_EXTRA, token);
+         else fraig = true;
+      }
+      else if (v3StrNCmp("-Thread", token, 2) == 0) {
+         if (thread) return V3CmdExec::errorOption(CMD_OPT_EXTRA, token);
+         else if (maxDON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned MaxDepth)");
+         else thread = true;
+         if (++i == n) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned ThreadNum)");
+         if (!v3Str2Int(options[i], threadNum) || threadNum <= 0) 
+            return V3CmdExec::errorOption(CMD_OPT_ILLEGAL, "(unsigned ThreadNum)");
+      }
       else if (maxDON) {
          int temp; if (!v3Str2Int(token, temp)) return V3CmdExec::errorOption(CMD_OPT_ILLEGAL, token);
          if (temp <= 0) return V3CmdExec::errorOption(CMD_OPT_ILLEGAL, token);
@@ -1352,6 +1465,9 @@ V3SECVrfCmd::exec(const string& option) {
    }
 
    if (maxDON) return V3CmdExec::errorOption(CMD_OPT_MISSING, "(unsigned MaxDepth)");
+   // Parallel Induction Proves Candidates by Itself, so a Safety Checker would be Ignored
+   if (thread && 1 < threadNum && (bmc || umc || ipdr || mpdr || citp || fitp))
+      return V3CmdExec::errorOption(CMD_OPT_EXTRA, "-Thread");
 
    // Get Properties to be Verified
    V3NtkHandler* const handler = v3Handler.getCurHandler();
@@ -1384,6 +1500,8 @@ V3SECVrfCmd::exec(const string& option) {
             if (secChecker) checker->setChecker(secChecker);
             if (cec) checker->setAssumeCECMiter();
             if (sec) checker->setAssumeSECMiter();
+            if (fraig) checker->setFraigMode(true);
+            if (thread) checker->setInductionThreads(threadNum);
             if (maxD) checker->setMaxDepth(maxDepth);
             checker->verifyInOrder();
             // Set Verification Result
@@ -1406,7 +1524,8 @@ V3SECVrfCmd::exec(const string& option) {
 void
 V3SECVrfCmd::usage(const bool& verbose) const {
    Msg(MSG_IFO) << "Usage: VERify SEC [(string propertyName)] [-Max-depth (unsigned MaxDepth)]" << endl;
-   Msg(MSG_IFO) << "                  [-UMC | -IPDR | -MPDR] [-CEC] [-SEC]" << endl;
+   Msg(MSG_IFO) << "                  [-UMC | -IPDR | -MPDR] [-CEC] [-SEC] [-FRAig]" << endl;
+   Msg(MSG_IFO) << "                  [-Thread (unsigned ThreadNum)]" << endl;
    if (verbose) {
       Msg(MSG_IFO) << "Param: (string propertyName): The name of a property to be verified." << endl;
       Msg(MSG_IFO) << "       -UMC                 : Enable UMC as a safety checker." << endl;
@@ -1414,6 +1533,9 @@ V3SECVrfCmd::usage(const bool& verbose) const {
       Msg(MSG_IFO) << "       -IPDR                : Enable Incremental PDR as a safety checker." << endl;
       Msg(MSG_IFO) << "       -CEC                 : Assume that the Network could be a CEC Miter." << endl;
       Msg(MSG_IFO) << "       -SEC                 : Assume that the Network could be a SEC Miter." << endl;
+      Msg(MSG_IFO) << "       -FRAig               : Merge combinationally equivalent nets by SAT sweeping." << endl;
+      Msg(MSG_IFO) << "       -Thread              : Check candidate classes by k-induction in parallel instead of a safety checker." << endl;
+      Msg(MSG_IFO) << "       (unsigned ThreadNum) : Number of threads checking candidate classes by induction. (Default = 1)" << endl;
    }
 }
 
@@ -93,13 +93,14 @@ V3FITPFrame::removeSubsumed(const V3FITPCube* const cube, const V3FITPCubeList::
 V3VrfFITP::V3VrfFITP(const V3NtkHandler* const handler) : V3VrfBase(handler) {
    // Private Data Members
    _itpFrame.clear(); _itpReuse.clear(); _itpBad = 0; _itpAttr = 0; _itpBMCDepth = 0; _itpBadCount = 1;
+   _itpConverge = 0;
    // Private Engines
    _itpBMCSvr = 0; _itpITPSvr = 0; _itpGSt = 0; _itpSim = 0; _itpGen = 0;
    // Extended Data Members
    _itpPriority.clear(); _itpForceUAct = 0; _itpBlockCubes.clear(); _itpBadCubeStr.clear();
    // Statistics
    if (profileON()) {
-      _totalStat     = new V3Stat("TOTAL");
+      _totalStat     = new V3Stat("TOTAL", 0, "FITP");
       _initSvrStat   = new V3Stat("SVR INIT",    _totalStat);
       _solveStat     = new V3Stat("SVR SOLVE",   _totalStat);
       _generalStat   = new V3Stat("GENERALIZE",  _totalStat);
@@ -138,7 +139,7 @@ vrfRestart:
    if (_sharedBound && V3NtkUD == _sharedBound->getBound(p)) return;
    
    // Clear Verification Results
-   clearResult(p); if (profileON()) _totalStat->start();
+   clearResult(p); _itpConverge = 0; if (profileON()) _totalStat->start();
    
    // Consistency Check
    consistencyCheck(); assert (!_constr.size());
@@ -190,6 +191,7 @@ vrfRestart:
    if (!_itpBMCSvr) {
       _itpBMCSvr = allocSolver(getSolver(), _vrfNtk);
       assert (_itpBMCSvr->totalSolves() == 0);
+      if (profileON()) _itpBMCSvr->setStat(_solveStat);
    }
    if (_itpITPSvr && !isIncContinueOnLastSolver()) { delete _itpITPSvr; _itpITPSvr = 0; }
    initializeBMCSolver(0, 1 + lastDepth); initializeITPSolver();
@@ -212,6 +214,8 @@ vrfRestart:
       if (_maxTime < getTimeUsed(inittime, curtime)) break;
       // Check Memory Bound
       if (_sharedMem && !_sharedMem->isMemValid()) break;
+      // Check Memory Budget
+      if (isMemBudgetExceeded(getSolverMemory(_itpBMCSvr) + getSolverMemory(_itpITPSvr))) break;
       // Increase BMC Depth from Porfolio Data
       if (_sharedBound) {
          const uint32_t k = _sharedBound->getBound(p); if (V3NtkUD == k) break;
@@ -224,7 +228,7 @@ vrfRestart:
       if (!_sharedBound || _itpBMCDepth > _sharedBound->getBound(p)) {
          // SAT(I0 ^ T(_itpBMCDepth) ^ !p)
          if (checkCounterExample()) { fired = _itpBMCDepth; break; }
-         else if (_sharedBound) _sharedBound->updateBound(p, _itpBMCDepth);
+         else updateSharedBound(p, _itpBMCDepth);
       }
       // Check Shared Networks
       if (_sharedNtk) {
@@ -240,6 +244,8 @@ vrfRestart:
          if (_maxTime < getTimeUsed(inittime, curtime)) break;
          // Check Memory Bound
          if (_sharedMem && !_sharedMem->isMemValid()) break;
+         // Check Memory Budget
+         if (isMemBudgetExceeded(getSolverMemory(_itpBMCSvr) + getSolverMemory(_itpITPSvr))) break;
          // Check Shared Results
          if (_sharedBound && (V3NtkUD == _sharedBound->getBound(p))) break;
          // Initialize New Frame
@@ -250,6 +256,8 @@ vrfRestart:
             assert (!_itpFrame.back()->getCubeList().size());
             proved = _itpFrame.size() - 1; break;
          }
+         // Record Distance to the Fixpoint
+         updateConvergence();
          // Print Interactive Messages
          if (!isIncKeepSilent() && intactON()) {
             if (!endLineON()) Msg(MSG_IFO) << "\r" + flushSpace + "\r";
@@ -389,7 +397,10 @@ V3VrfFITP::initializeITPSolver() {
    // NOTE: We Currently Add Invariant Constraint on the BMC Solver ONLY
    if (profileON()) _initSvrStat->start();
    if (_itpITPSvr) _itpITPSvr->reset();
-   else { _itpITPSvr = allocSolver(getSolver(), _vrfNtk); assert (_itpITPSvr->totalSolves() == 0); }
+   else {
+      _itpITPSvr = allocSolver(getSolver(), _vrfNtk); assert (_itpITPSvr->totalSolves() == 0);
+      if (profileON()) _itpITPSvr->setStat(_solveStat);
+   }
    // Set Initial State to Solver
    for (uint32_t i = 0; i < _vrfNtk->getLatchSize(); ++i) _itpITPSvr->addBoundedVerifyData(_vrfNtk->getLatch(i), 0);
    for (uint32_t i = 0; i < _vrfNtk->getLatchSize(); ++i) _itpITPSvr->addBoundedVerifyData(_vrfNtk->getLatch(i), 1);
@@ -760,6 +771,17 @@ V3VrfFITP::generalizeProof(V3FITPCube* const cube) {
    assert (!checkBMCReachability(cube->getState())); return true;
 }
 
+// FITP Progress Report Functions
+void
+V3VrfFITP::updateConvergence() {
+   // The Image Sequence Reaches a Fixpoint when the Newest Frame Runs Empty
+   if (_itpFrame.size() < 3) return; uint32_t maxSize = 0;
+   for (uint32_t i = 1; i < _itpFrame.size(); ++i)
+      if (maxSize < _itpFrame[i]->getCubeList().size()) maxSize = _itpFrame[i]->getCubeList().size();
+   const double converge = 1.00 - ((double)(_itpFrame.back()->getCubeList().size()) / (double)maxSize);
+   if (_itpConverge < converge) _itpConverge = converge;
+}
+
 // FITP Debug Functions
 void
 V3VrfFITP::printState(const V3NetVec& state) const {
@@ -18,6 +18,12 @@
 //#define V3_IPDR_USE_PROPAGATE_BACKWARD
 #define V3_IPDR_USE_PROPAGATE_LOW_COST
 
+// Minimum Number of Cubes per Thread to Propagate a Frame in Parallel
+#define V3_IPDR_PARALLEL_PROPAGATE_MIN 16
+
+// Maximum Number of Proof Obligations Kept in a Pool
+#define V3_IPDR_OBLIGATION_POOL_MAX 4096
+
 /* -------------------------------------------------- *\
  * Class V3IPDRFrame Implementations
 \* -------------------------------------------------- */
@@ -131,6 +137,48 @@ V3IPDRFrame::removeSelfSubsumed() {
    }
 }
 
+/* -------------------------------------------------- *\
+ * Class V3IPDRObligationPool Implementations
+\* -------------------------------------------------- */
+// Obligation Pool Functions
+const bool
+V3IPDRObligationPool::pushCube(const uint32_t& dist, const V3NetVec& state) {
+   if (V3_IPDR_OBLIGATION_POOL_MAX <= _size) return false;
+   if (_obligation.size() <= dist) _obligation.resize(1 + dist);
+   V3IPDRCube* const cube = new V3IPDRCube(0); assert (cube); cube->setState(state);
+   if (!_obligation[dist].insert(cube).second) { delete cube; return false; }
+   ++_size; return true;
+}
+
+void
+V3IPDRObligationPool::popCubes(const uint32_t& dist, V3IPDRCubeList& cubeList) {
+   // Transfer the Ownership of Obligations with Distance dist to cubeList
+   assert (dist < _obligation.size()); assert (_size >= _obligation[dist].size());
+   _size -= _obligation[dist].size(); cubeList.insert(_obligation[dist].begin(), _obligation[dist].end());
+   _obligation[dist].clear();
+}
+
+void
+V3IPDRObligationPool::moveCubes(V3IPDRObligationPool& pool) {
+   // Move All Obligations to pool, Obligations Exceeding the Pool Size are Discarded
+   for (uint32_t i = 0; i < _obligation.size(); ++i) {
+      if (pool._obligation.size() <= i) pool._obligation.resize(1 + i);
+      for (V3IPDRCubeList::iterator it = _obligation[i].begin(); it != _obligation[i].end(); ++it) {
+         if (V3_IPDR_OBLIGATION_POOL_MAX > pool._size && pool._obligation[i].insert(*it).second) ++pool._size;
+         else delete *it;
+      }
+   }
+   _obligation.clear(); _size = 0;
+}
+
+void
+V3IPDRObligationPool::clear() {
+   for (uint32_t i = 0; i < _obligation.size(); ++i) {
+      for (V3IPDRCubeList::iterator it = _obligation[i].begin(); it != _obligation[i].end(); ++it) delete *it;
+   }
+   _obligation.clear(); _size = 0;
+}
+
 /* -------------------------------------------------- *\
  * Class V3VrfIPDR Implementations
 \* -------------------------------------------------- */
@@ -141,14 +189,14 @@ V3VrfIPDR::V3VrfIPDR(const V3NtkHandler* const handler) : V3VrfBase(handler) {
    // Recycle Members
    _pdrBackup.clear(); _pdrActBackup.clear(); _pdrSvrBackup.clear(); _pdrRecycle = V3NtkUD; _pdrActCount.clear();
    // Private Engines
-   _pdrSvr.clear(); _pdrSim = 0; _pdrGen = 0;
+   _pdrSvr.clear(); _pdrThreads = 1; _pdrSim = 0; _pdrGen = 0;
    // Private Tables
    _pdrInitConst.clear(); _pdrInitValue.clear();
    // Extended Data Members
-   _pdrPriority.clear();
+   _pdrPriority.clear(); _pdrMaxCTG = 0; _pdrMaxCTGDepth = 0;
    // Statistics
    if (profileON()) {
-      _totalStat     = new V3Stat("TOTAL");
+      _totalStat     = new V3Stat("TOTAL", 0, "IPDR");
       _initSvrStat   = new V3Stat("SVR INIT",    _totalStat);
       _solveStat     = new V3Stat("SVR SOLVE",   _totalStat);
       _generalStat   = new V3Stat("GENERALIZE",  _totalStat);
@@ -171,7 +219,7 @@ V3VrfIPDR::~V3VrfIPDR() {
    // Private Tables
    _pdrInitConst.clear(); _pdrInitValue.clear();
    // Extended Data Members
-   _pdrPriority.clear();
+   _pdrPriority.clear(); _pdrPool.clear(); _pdrPoolReuse.clear();
    // Statistics
    if (profileON()) {
       if (_totalStat    ) delete _totalStat;
@@ -223,7 +271,8 @@ vrfRestart:
    }
 
    // Initialize Other Members
-   if (!isIncKeepLastReachability()) _pdrPriority.clear();
+   if (!isIncKeepLastReachability()) { _pdrPriority.clear(); _pdrPool.clear(); _pdrPoolReuse.clear(); }
+   else _pdrPool.moveCubes(_pdrPoolReuse);  // Obligations of the Last Run are Re-validated in this Run
    if (_pdrBad) delete _pdrBad; _pdrBad = 0; if (_pdrGen) delete _pdrGen; _pdrGen = 0;
    if (dynamic_cast<V3BvNtk*>(_vrfNtk)) {
       _pdrGen = new V3AlgBvGeneralize(_handler); assert (_pdrGen);
@@ -275,6 +324,8 @@ vrfRestart:
       // Set p to the Last Frame
       _pdrSvr[_pdrSvr.size() - 2]->assertProperty(pId, true, 0);
    }
+   // Block Proof Obligations Kept from the Last Run
+   if (_pdrPoolReuse.size()) reuseObligations();
 
    // Start PDR Based Verification
    V3IPDRCube* badCube = 0;
@@ -284,6 +335,8 @@ vrfRestart:
       if (_maxTime < getTimeUsed(inittime, curtime)) break;
       // Check Memory Bound
       if (_sharedMem && !_sharedMem->isMemValid()) break;
+      // Check Memory Budget (Recycle Solvers before Giving Up)
+      if (isMemBudgetExceeded(getPDRMemory()) && !reducePDRMemory()) break;
       // Check Shared Results
       if (_sharedBound && (V3NtkUD == _sharedBound->getBound(p))) break;
       // Check Shared Networks
@@ -305,7 +358,7 @@ vrfRestart:
                Msg(MSG_IFO) << " " << _pdrFrame[i]->getCubeList().size();
             Msg(MSG_IFO) << endl;  // Always Endline At the End of Each Frame
          }
-         if (_sharedBound) _sharedBound->updateBound(p, _pdrFrame.size());
+         updateSharedBound(p, _pdrFrame.size());
          // Set p to the Last Frame
          _pdrSvr.back()->assertProperty(pId, true, 0);
          // Push New Frame
@@ -320,9 +373,10 @@ vrfRestart:
          assert (_pdrSvr.back()); assert (_pdrSvr.size() == _pdrFrame.size());
          if (propagateCubes()) { proved = getPDRDepth(); break; }
          if (_maxDepth <= (getPDRFrame() - 1)) break;
+         if (_pdrPoolReuse.size()) reuseObligations();
       }
       else {
-         badCube = recursiveBlockCube(badCube);
+         badCube = recursiveBlockCube(badCube, getPDRDepth());
          if (badCube) { fired = getPDRDepth(); break; }
          // Interactively Show the Number of Bad Cubes in Frames
          if (!isIncKeepSilent() && intactON()) {
@@ -428,6 +482,7 @@ V3VrfIPDR::initializeSolver(const uint32_t& d, const bool& isReuse) {
       assert (d == _pdrActCount.size()); assert (d == _pdrSvr.size());
       _pdrSvr.push_back(d ? referenceSolver(_pdrSvr[0]) : allocSolver(getSolver(), _vrfNtk));
       assert (_pdrSvr[d]->totalSolves() == 0); _pdrActCount.push_back(_pdrRecycle);
+      if (profileON()) _pdrSvr[d]->setStat(_solveStat);
    }
    // Set Initial State to Solver
    for (uint32_t i = 0; i < _vrfNtk->getLatchSize(); ++i) _pdrSvr[d]->addBoundedVerifyData(_vrfNtk->getLatch(i), 0);
@@ -517,10 +572,12 @@ V3VrfIPDR::getInitialObligation() {  // If SAT(R ^ T ^ !p)
 }
 
 V3IPDRCube* const
-V3VrfIPDR::recursiveBlockCube(V3IPDRCube* const badCube) {
+V3VrfIPDR::recursiveBlockCube(V3IPDRCube* const badCube, const uint32_t& frame) {
    // Create a Queue for Blocking Cubes
    V3BucketList<V3IPDRCube*> badQueue(getPDRFrame());
-   assert (badCube); badQueue.add(getPDRDepth(), badCube);
+   assert (badCube); assert (frame && frame < getPDRFrame()); badQueue.add(frame, badCube);
+   // Obligations Recorded to the Pool (Only at the First Frame they are Blocked)
+   V3Set<const V3IPDRCube*>::Set pooledCubes; pooledCubes.clear();
    // Block Cubes from the Queue
    V3IPDRTimedCube baseCube, generalizedCube;
    while (badQueue.pop(baseCube.first, baseCube.second)) {
@@ -529,14 +586,18 @@ V3VrfIPDR::recursiveBlockCube(V3IPDRCube* const badCube) {
          // Clear All Cubes in badQueue before Return
          V3Set<const V3IPDRCube*>::Set traceCubes; traceCubes.clear();
          const V3IPDRCube* traceCube = baseCube.second;
-         while (true) {
+         while (traceCube) {
             traceCubes.insert(traceCube); if (_pdrBad == traceCube) break;
             traceCube = traceCube->getNextCube();
          }
          while (badQueue.pop(generalizedCube.first, generalizedCube.second)) {
             if (traceCubes.end() == traceCubes.find(generalizedCube.second)) delete generalizedCube.second;
          }
-         return baseCube.second;  // A Cube cannot be blocked by R0 --> Cex
+         if (traceCube) return baseCube.second;  // A Cube cannot be blocked by R0 --> Cex
+         // The Trace Starts from a Reused Obligation (Not Leading to the Current Bad State) --> Drop it
+         V3Set<const V3IPDRCube*>::Set::const_iterator it;
+         for (it = traceCubes.begin(); it != traceCubes.end(); ++it) delete *it;
+         return 0;
       }
       if (!isBlocked(baseCube)) {
          assert (!existInitial(baseCube.second->getState()));
@@ -549,13 +610,16 @@ V3VrfIPDR::recursiveBlockCube(V3IPDRCube* const badCube) {
             badQueue.add(baseCube.first, baseCube.second);  // This Cube has not yet been blocked (postpone to future)
          }
          else {  // UNSAT, Blocked
+            // Keep the Obligation for Later Runs, Prioritized by its Distance to the Bad State
+            if (pooledCubes.insert(baseCube.second).second)
+               _pdrPool.pushCube(getPDRDepth() - baseCube.first, baseCube.second->getState());
             bool satGen = true;
             while (true) {
                if (profileON()) _generalStat->start();
                generalizedCube.first = baseCube.first;
                generalizedCube.second = new V3IPDRCube(*(baseCube.second));
                generalization(generalizedCube);  // Generalization
-               if (profileON()) _generalStat->end();
+               if (profileON()) { _generalStat->end(); _generalStat->count(V3_STAT_CUBE); }
                addBlockedCube(generalizedCube);  // Record this Cube that is bad and to be blocked
                // I found Niklas Een has modified the original IWLS paper and alter the line below
                // However, I suggest the alteration restricts PDR (i.e. fold-free) and does not help
@@ -575,13 +639,32 @@ V3VrfIPDR::recursiveBlockCube(V3IPDRCube* const badCube) {
    return 0;
 }
 
+void
+V3VrfIPDR::reuseObligations() {
+   // This function re-validates proof obligations kept from the last run, and blocks them in current frames.
+   // Blocking any state is sound, so obligations that turn out reachable are dropped instead of reported.
+   V3IPDRCubeList cubeList; V3IPDRTimedCube timedCube;
+   for (uint32_t i = 0; i < _pdrPoolReuse.buckets() && i < getPDRDepth(); ++i) {
+      cubeList.clear(); _pdrPoolReuse.popCubes(i, cubeList); timedCube.first = getPDRDepth() - i;
+      for (V3IPDRCubeList::iterator it = cubeList.begin(); it != cubeList.end(); ++it) {
+         // Re-validate the Obligation on the Current Network and Frames
+         const V3NetVec& state = (*it)->getState(); uint32_t j = 0;
+         for (; j < state.size(); ++j) if (state[j].id >= _pdrInitConst.size()) break;
+         timedCube.second = *it;
+         if (j < state.size() || existInitial(state) || isBlocked(timedCube)) { delete *it; continue; }
+         recursiveBlockCube(*it, timedCube.first);
+      }
+   }
+}
+
 #ifdef V3_IPDR_USE_PROPAGATE_LOW_COST
 const bool
 V3VrfIPDR::propagateCubes() {
-   if (profileON()) _propagateStat->start();
+   if (profileON()) _propagateStat->start(); V3VrfCubePropagator* propagator = 0;
    // Check Each Frame if some Cubes can be Further Propagated
    for (uint32_t i = 1; i < getPDRDepth(); ++i) {
       const V3IPDRCubeList& cubeList = _pdrFrame[i]->getCubeList();
+      V3IPDRPushMap pushMap; const bool parallel = propagateCubesInParallel(i, pushMap, propagator);
 #ifdef V3_IPDR_USE_PROPAGATE_BACKWARD
       // Backward Version  (Check from rbegin() to rend())
       uint32_t candidates = 1; V3IPDRCubeList::const_iterator it;
@@ -593,12 +676,14 @@ V3VrfIPDR::propagateCubes() {
       while (it != cubeList.end()) {
 #endif
          // Check if this cube can be pushed forward (closer to All Frame)
-         if (!checkReachability(i + 1, (*it)->getState(), false)) {
+         if (parallel ? (pushMap.end() != pushMap.find(*it)) : !checkReachability(i + 1, (*it)->getState(), false)) {
             V3IPDRTimedCube cube = make_pair(i + 1, new V3IPDRCube(*(*it)));
+            V3BoolVec core; if (parallel) core.swap(pushMap[*it]);
             // Remove cubes in this frame that can be subsumed by the cube
             _pdrFrame[i]->removeSubsumed(cube.second, ++it);
             // Remove Cubes in the Next Frame that can be Subsumed by the cube
-            removeFromProof(cube); _pdrFrame[i + 1]->removeSubsumed(cube.second);
+            if (parallel) removeFromParallelProof(cube, core); else removeFromProof(cube);
+            _pdrFrame[i + 1]->removeSubsumed(cube.second);
             // Block this cube again at higher frames
             addBlockedCube(cube);
          }
@@ -618,22 +703,25 @@ V3VrfIPDR::propagateCubes() {
       _pdrFrame[i]->removeSelfSubsumed();
       // Check Inductive Invariant
       if (!_pdrFrame[i]->getCubeList().size()) {
+         if (propagator) delete propagator;
          if (profileON()) _propagateStat->end();
          return true;
       }
    }
    // Check if Any Remaining Cubes in the Latest Frame can be Subsumed
    _pdrFrame[getPDRDepth()]->removeSelfSubsumed();
+   if (propagator) delete propagator;
    if (profileON()) _propagateStat->end();
    return false;
 }
 #else
 const bool
 V3VrfIPDR::propagateCubes() {
-   if (profileON()) _propagateStat->start();
+   if (profileON()) _propagateStat->start(); V3VrfCubePropagator* propagator = 0;
    // Check Each Frame if some Cubes can be Further Propagated
    for (uint32_t i = 1; i < getPDRDepth(); ++i) {
       const V3IPDRCubeList& cubeList = _pdrFrame[i]->getCubeList();
+      V3IPDRPushMap pushMap; const bool parallel = propagateCubesInParallel(i, pushMap, propagator);
 #ifdef V3_IPDR_USE_PROPAGATE_BACKWARD
       // Backward Version  (Check from rbegin() to rend())
       uint32_t candidates = 1; V3IPDRCubeList::const_iterator it;
@@ -645,10 +733,11 @@ V3VrfIPDR::propagateCubes() {
       while (it != cubeList.end()) {
 #endif
          // Check if this cube can be pushed forward (closer to the last frame)
-         if (!checkReachability(i + 1, (*it)->getState(), false)) {
+         if (parallel ? (pushMap.end() != pushMap.find(*it)) : !checkReachability(i + 1, (*it)->getState(), false)) {
             V3IPDRTimedCube cube = make_pair(i + 1, new V3IPDRCube(*(*it)));
             // Block this cube again at higher frames
-            removeFromProof(cube); addBlockedCube(cube);
+            if (parallel) removeFromParallelProof(cube, pushMap[*it]); else removeFromProof(cube);
+            addBlockedCube(cube);
             // Remove blocked cubes in lower frames that can be subsumed by the cube
             for (uint32_t j = 1; j < i; ++j) _pdrFrame[j]->removeSubsumed(cube.second);
             // Remove Cubes in this Frame that can be Subsumed by the cube
@@ -673,17 +762,47 @@ V3VrfIPDR::propagateCubes() {
       // Check Inductive Invariant
       for (uint32_t j = 1; j <= i; ++j) 
          if (!_pdrFrame[j]->getCubeList().size()) {
+            if (propagator) delete propagator;
             if (profileON()) _propagateStat->end();
             return true;
          }
    }
    // Check if Any Remaining Cubes in the Last Frame can be Subsumed
    _pdrFrame[getPDRDepth()]->removeSelfSubsumed();
+   if (propagator) delete propagator;
    if (profileON()) _propagateStat->end();
    return false;
 }
 #endif
 
+const bool
+V3VrfIPDR::propagateCubesInParallel(const uint32_t& i, V3IPDRPushMap& pushMap, V3VrfCubePropagator*& propagator) {
+   // Cubes in frame i are all checked against R_i ^ T, so the checks are independent of each other
+   // (workers only miss the cubes generalized earlier in the same pass, which is sound but may push less).
+   // They are solved on private solvers by _pdrThreads workers, and the cubes proven pushable are recorded
+   // in pushMap with the literals in their UNSAT cores. Return false if frame i is too small to be worthwhile.
+   assert (i < getPDRDepth()); pushMap.clear();
+   const V3IPDRCubeList& cubeList = _pdrFrame[i]->getCubeList();
+   if (1 >= _pdrThreads || _constr.size() || (_pdrThreads * V3_IPDR_PARALLEL_PROPAGATE_MIN) > cubeList.size()) return false;
+   // Workers are Created Once per Pass, and Only Encode Cubes Blocked since their Last Check
+   if (!propagator) {
+      propagator = new V3VrfCubePropagator(_pdrSvr[i], _vrfNtk, V3NetVec(1, _pdrBad->getState()[0]), _pdrThreads); assert (propagator); }
+   for (uint32_t j = i; j < _pdrFrame.size(); ++j) {
+      const V3IPDRCubeList& frameList = _pdrFrame[j]->getCubeList();
+      for (V3IPDRCubeList::const_iterator it = frameList.begin(); it != frameList.end(); ++it)
+         propagator->addBlockedCube(j, *it, (*it)->getState());
+   }
+   // Collect Candidate Cubes
+   V3NetTable cubes; V3Vec<const V3IPDRCube*>::Vec cubeRefs;
+   cubes.reserve(cubeList.size()); cubeRefs.reserve(cubeList.size());
+   for (V3IPDRCubeList::const_iterator it = cubeList.begin(); it != cubeList.end(); ++it) {
+      cubes.push_back((*it)->getState()); cubeRefs.push_back(*it); }
+   // Check Cubes in Parallel
+   V3BoolVec pushed; V3BoolTable cores; propagator->checkCubes(i, cubes, pushed, cores);
+   for (uint32_t j = 0; j < cubes.size(); ++j) if (pushed[j]) pushMap[cubeRefs[j]].swap(cores[j]);
+   return true;
+}
+
 // PDR Auxiliary Functions
 const bool
 V3VrfIPDR::checkReachability(const uint32_t& frame, const V3NetVec& cubeState, const bool& extend) {
@@ -827,7 +946,8 @@ V3VrfIPDR::resolveInitial(const uint32_t& d, V3IPDRCube* const cube, const V3Svr
 void
 V3VrfIPDR::generalization(V3IPDRTimedCube& generalizedCube) {
    removeFromProof(generalizedCube);
-   generalizeProof(generalizedCube);
+   if (_pdrMaxCTG) generalizeCTG(generalizedCube, 0);
+   else generalizeProof(generalizedCube);
    forwardProof(generalizedCube);
 }
 
@@ -919,6 +1039,23 @@ V3VrfIPDR::removeFromProof(V3IPDRTimedCube& timedCube) {
    assert (!checkReachability(timedCube.first, timedCube.second->getState())); return isSvrDataInvolved;
 }
 
+void
+V3VrfIPDR::removeFromParallelProof(V3IPDRTimedCube& timedCube, const V3BoolVec& core) {
+   // This function can ONLY be called for a cube proven pushable by propagateCubesInParallel()
+   // core marks the literals of cube' in the UNSAT core found by a worker (empty if unavailable)
+   if (!core.size()) return;  // Solver does not Support Analyze Conflict
+   const uint32_t d = timedCube.first - 1; assert (timedCube.first < _pdrSvr.size());
+   const V3NetVec& state = timedCube.second->getState(); assert (core.size() == state.size());
+   addCubeToSolver(d, state, 1); V3SvrDataSet coreProofVarSet; coreProofVarSet.clear();
+   for (uint32_t i = 0; i < state.size(); ++i)
+      if (core[i]) coreProofVarSet.insert(_pdrSvr[d]->getFormula(_vrfNtk->getLatch(state[i].id), 1));
+   // Get Generalized State from Worker Proof
+   assert (!existInitial(timedCube.second->getState()));
+   resolveInitial(d, timedCube.second, coreProofVarSet);
+   assert (!existInitial(timedCube.second->getState()));
+   assert (!checkReachability(timedCube.first, timedCube.second->getState()));
+}
+
 void
 V3VrfIPDR::generalizeProof(V3IPDRTimedCube& timedCube) {
    // Apply SAT Solving to further generalize cube
@@ -957,6 +1094,74 @@ V3VrfIPDR::generalizeProof(V3IPDRTimedCube& timedCube) {
    assert (!checkReachability(timedCube.first, timedCube.second->getState()));
 }
 
+void
+V3VrfIPDR::generalizeCTG(V3IPDRTimedCube& timedCube, const uint32_t& level) {
+   // Apply SAT Solving to further generalize cube (c.f. generalizeProof)
+   // A dropped literal is kept only if blockCTGDown() fails, which blocks counterexamples to induction
+   // (CTG) at lower frames, or drops more literals that are inconsistent with them (join)
+   V3IPDRCube* const& cube = timedCube.second; assert (!existInitial(cube->getState()));
+   const V3NetVec cubeState(cube->getState()); V3NetVec state(cubeState), candidate;
+   // Sort Priority of Signals
+   V3Map<uint32_t, uint32_t, V3UI32LessOrEq<uint32_t> >::Map priorityMap; priorityMap.clear();
+   V3Map<uint32_t, uint32_t>::Map::iterator it;
+   for (uint32_t i = 0; i < cubeState.size(); ++i) {
+      assert (cubeState[i].id < _pdrPriority.size()); priorityMap.insert(make_pair(_pdrPriority[cubeState[i].id], i));
+   }
+   for (it = priorityMap.begin(); it != priorityMap.end(); ++it) {
+      // Try Removing A State Variable on this Cube (if not yet Removed)
+      const V3NetId& id = cubeState[it->second]; candidate.clear(); candidate.reserve(state.size());
+      for (uint32_t i = 0; i < state.size(); ++i) if (state[i].id != id.id) candidate.push_back(state[i]);
+      if (candidate.size() == state.size()) continue;
+      if (blockCTGDown(timedCube.first, candidate, level)) state = candidate;
+      assert (!existInitial(state));
+   }
+   if (state.size() < cube->getState().size()) cube->setState(state);
+   assert (!existInitial(timedCube.second->getState()));
+   assert (!checkReachability(timedCube.first, timedCube.second->getState()));
+}
+
+const bool
+V3VrfIPDR::blockCTGDown(const uint32_t& frame, V3NetVec& state, const uint32_t& level) {
+   // Return true if state can be blocked at frame, where state may be further reduced
+   // Otherwise, each predecessor of state is either blocked at frame - 1 as a CTG (up to _pdrMaxCTG in a row),
+   // or the literals of state contradicting the predecessor are dropped (join) and state is checked again
+   uint32_t ctgs = 0; assert (frame);
+   while (true) {
+      if (existInitial(state)) return false;
+      if (!checkReachability(frame, state)) {  // UNSAT, Reduce state by the UNSAT Core
+         V3IPDRTimedCube timedCube = make_pair(frame, new V3IPDRCube(0)); timedCube.second->setState(state);
+         removeFromProof(timedCube); state = timedCube.second->getState(); delete timedCube.second; return true;
+      }
+      if (level >= _pdrMaxCTGDepth) return false;  // Top-Level Call is at level 0
+      // Get the Predecessor of state by Ternary Simulation
+      V3IPDRCube* const nextCube = new V3IPDRCube(0); nextCube->setState(state);
+      V3IPDRCube* const prevCube = new V3IPDRCube(nextCube);
+      if (profileON()) _ternaryStat->start();
+      generalizeSimulation(frame - 1, prevCube, nextCube);
+      if (profileON()) _ternaryStat->end();
+      const V3NetVec ctgState = prevCube->getState(); delete prevCube; delete nextCube;
+      if (ctgs < _pdrMaxCTG && frame > 1 && !existInitial(ctgState) && !checkReachability(frame - 1, ctgState)) {
+         // Block the CTG at the Highest Possible Frame
+         V3IPDRTimedCube ctgCube = make_pair(frame - 1, new V3IPDRCube(0)); ctgCube.second->setState(ctgState);
+         removeFromProof(ctgCube); forwardProof(ctgCube);
+         generalizeCTG(ctgCube, 1 + level); ++ctgs;
+         if (isBlocked(ctgCube)) delete ctgCube.second; else addBlockedCube(ctgCube);
+      }
+      else {
+         // Join : Remove Variables of state with Opposite Polarity in the Predecessor
+         V3NetVec joinState; joinState.clear(); joinState.reserve(state.size());
+         uint32_t j = 0, k = 0; ctgs = 0;
+         while (j < ctgState.size() && k < state.size()) {
+            if (ctgState[j].id > state[k].id) { joinState.push_back(state[k]); ++k; }
+            else if (ctgState[j].id < state[k].id) ++j;
+            else { if (ctgState[j].cp == state[k].cp) joinState.push_back(state[k]); ++j; ++k; }
+         }
+         for (; k < state.size(); ++k) joinState.push_back(state[k]);
+         if (joinState.size() == state.size()) return false; state = joinState;
+      }
+   }
+}
+
 void
 V3VrfIPDR::forwardProof(V3IPDRTimedCube& timedCube) {
    // Try Pushing the cube to higher frames if possible
@@ -1049,6 +1254,40 @@ V3VrfIPDR::reportUnsupportedInitialState() {
    return ok;
 }
 
+// PDR Memory Budget Functions
+const double
+V3VrfIPDR::getPDRMemory() const {
+   // Estimated Memory (in MB) of Solvers, Frames and Kept Obligations
+   double memory = 0; uint32_t cubes = _pdrPool.size() + _pdrPoolReuse.size();
+   for (uint32_t i = 0; i < _pdrSvr.size(); ++i) memory += getSolverMemory(_pdrSvr[i]);
+   for (uint32_t i = 0; i < _pdrFrame.size(); ++i) cubes += _pdrFrame[i]->getCubeList().size();
+   for (uint32_t i = 0; i < _pdrBackup.size(); ++i) cubes += _pdrBackup[i]->getCubeList().size();
+   return memory + ((cubes * (sizeof(V3IPDRCube) + _pdrInitConst.size())) / 1048576.0);
+}
+
+const bool
+V3VrfIPDR::reducePDRMemory() {
+   // Drop Kept Obligations and Learned Clauses (Solvers are Rebuilt from Frames)
+   // Give Up unless Recycling Leaves Headroom, Otherwise Solvers would be Recycled again in the Next Steps
+   _pdrPool.clear(); _pdrPoolReuse.clear();
+   for (uint32_t d = 0; d < getPDRDepth(); ++d) { _pdrActCount[d] = 0; recycleSolver(d); }
+   if (isMemBudgetRelieved(getPDRMemory())) return true;
+   if (!isIncKeepSilent()) Msg(MSG_WAR) << "Recycling Solvers Cannot Meet the Memory Budget of PDR !!" << endl;
+   return false;
+}
+
+// PDR Progress Report Functions
+const double
+V3VrfIPDR::getConvergence() const {
+   // A Frame that Runs Empty Closes the Proof, so Measure how Close the Sparsest Frame is
+   if (_pdrFrame.size() < 3) return 0; uint32_t minSize = V3NtkUD, maxSize = 0;
+   for (uint32_t i = 1; i < getPDRDepth(); ++i) {
+      const uint32_t size = _pdrFrame[i]->getCubeList().size();
+      if (size < minSize) minSize = size; if (size > maxSize) maxSize = size;
+   }
+   return maxSize ? (1.00 - ((double)minSize / (double)maxSize)) : 0;
+}
+
 // PDR Debug Functions
 void
 V3VrfIPDR::printState(const V3NetVec& state) const {
@@ -22,6 +22,7 @@ class V3IPDRFrame;
 typedef pair<uint32_t, V3IPDRCube*>          V3IPDRTimedCube;
 typedef V3Vec<V3IPDRFrame*>::Vec             V3IPDRFrameVec;
 typedef V3Vec<V3SvrBase*>::Vec               V3IPDRSvrList;
+typedef V3Map<const V3IPDRCube*, V3BoolVec>::Map   V3IPDRPushMap;
 
 // class V3IPDRCube : Cube Data Structue for Incremental PDR
 // NOTE: State Variables are Intrinsically Sorted by their indices (small to large)
@@ -92,6 +93,28 @@ class V3IPDRFrame
       V3IPDRCubeList _cubeList;     // List of Cubes Blocked in this Frame
 };
 
+// class V3IPDRObligationPool : Proof Obligations Kept across Incremental PDR Runs
+// NOTE: Obligations are Bucketed by their Distance to the Bad State (smaller ones first)
+class V3IPDRObligationPool
+{
+   public : 
+      // Constructor and Destructor
+      V3IPDRObligationPool() { _obligation.clear(); _size = 0; }
+      ~V3IPDRObligationPool() { clear(); }
+      // Obligation Pool Functions
+      const bool pushCube(const uint32_t&, const V3NetVec&);
+      void popCubes(const uint32_t&, V3IPDRCubeList&);
+      void moveCubes(V3IPDRObligationPool&);
+      void clear();
+      // Inline Member Functions
+      inline const uint32_t size() const { return _size; }
+      inline const uint32_t buckets() const { return _obligation.size(); }
+   private : 
+      // Private Data Members
+      V3Vec<V3IPDRCubeList>::Vec _obligation;   // List of Obligations for each Distance to Bad
+      uint32_t                   _size;         // Number of Obligations in the Pool
+};
+
 // class V3VrfIPDR : Verification Handler for Incremental Property Directed Reachability
 class V3VrfIPDR : public V3VrfBase
 {
@@ -99,10 +122,14 @@ class V3VrfIPDR : public V3VrfBase
       // Constructor and Destructor
       V3VrfIPDR(const V3NtkHandler* const);
       ~V3VrfIPDR();
+      // PDR Progress Report Functions
+      const double getConvergence() const;
       // PDR Specific Settings
       inline void setRecycle(const uint32_t& r) { _pdrRecycle = r; }
       inline void setForwardSATGen  (const bool& s) { if (s) _pdrAttr |= 1ul; else _pdrAttr &= ~1ul; }
       inline void setForwardUNSATGen(const bool& u) { if (u) _pdrAttr |= 2ul; else _pdrAttr &= ~2ul; }
+      inline void setPropagateThreads(const uint32_t& t) { assert (t); _pdrThreads = t; }
+      inline void setCTGBound(const uint32_t& c, const uint32_t& d) { _pdrMaxCTG = c; _pdrMaxCTGDepth = d; }
    private : 
       // Private Attribute Setting Functions
       inline const bool isForwardSATGen()   const { return _pdrAttr & 1ul; }
@@ -116,8 +143,10 @@ class V3VrfIPDR : public V3VrfBase
       void recycleSolver(const uint32_t&);
       // PDR Main Functions
       V3IPDRCube* const getInitialObligation();
-      V3IPDRCube* const recursiveBlockCube(V3IPDRCube* const);
+      V3IPDRCube* const recursiveBlockCube(V3IPDRCube* const, const uint32_t&);
+      void reuseObligations();
       const bool propagateCubes();
+      const bool propagateCubesInParallel(const uint32_t&, V3IPDRPushMap&, V3VrfCubePropagator*&);
       // PDR Auxiliary Functions
       const bool checkReachability(const uint32_t&, const V3NetVec&, const bool& = true);
       const bool isBlocked(const V3IPDRTimedCube&);
@@ -131,13 +160,19 @@ class V3VrfIPDR : public V3VrfBase
       // PDR Generalization Functions
       void generalizeSimulation(const uint32_t&, V3IPDRCube* const, const V3IPDRCube* const);
       const bool removeFromProof(V3IPDRTimedCube&);
+      void removeFromParallelProof(V3IPDRTimedCube&, const V3BoolVec&);
       void generalizeProof(V3IPDRTimedCube&);
+      void generalizeCTG(V3IPDRTimedCube&, const uint32_t&);
+      const bool blockCTGDown(const uint32_t&, V3NetVec&, const uint32_t&);
       void forwardProof(V3IPDRTimedCube&);
       const bool generalizeCex(V3IPDRTimedCube&);
       // PDR Helper Functions
       inline const uint32_t getPDRDepth() const { return _pdrFrame.size() - 1; }
       inline const uint32_t getPDRFrame() const { return _pdrFrame.size(); }
       const bool reportUnsupportedInitialState();
+      // PDR Memory Budget Functions
+      const double getPDRMemory() const;
+      const bool reducePDRMemory();
       // PDR Debug Functions
       void printState(const V3NetVec&) const;
       // Private Data Members
@@ -153,6 +188,7 @@ class V3VrfIPDR : public V3VrfBase
       V3UI32Vec         _pdrActCount;     // List of Activation Variable Counts
       // Private Engines
       V3IPDRSvrList     _pdrSvr;          // List of Incremental SAT Solvers
+      uint32_t          _pdrThreads;      // Number of Threads for Cube Propagation
       V3AlgSimulate*    _pdrSim;          // Simulation Handler
       V3AlgGeneralize*  _pdrGen;          // Generalization Handler
       // Private Tables
@@ -161,6 +197,10 @@ class V3VrfIPDR : public V3VrfBase
       // Extended Data Members
       V3SvrData         _pdrSvrData;      // Solver Data of the Latest Activation Variable
       V3UI32Vec         _pdrPriority;     // Priority List for State Variables
+      uint32_t          _pdrMaxCTG;       // Max Number of CTGs Blocked in a Literal Dropping (0 : Disabled)
+      uint32_t          _pdrMaxCTGDepth;  // Max Recursion Depth of CTG Blocking
+      V3IPDRObligationPool _pdrPool;      // Proof Obligations Blocked in the Current Run
+      V3IPDRObligationPool _pdrPoolReuse; // Proof Obligations from Previous Runs to be Re-validated
       // Statistics
       V3Stat*           _totalStat;       // Total Statistic (Should be Called Only Once)
       V3Stat*           _initSvrStat;     // CNF Computation
@@ -14,6 +14,9 @@
 
 //#define V3_KLIVE_USE_SHIFT_REGISTERS
 
+// Max Width of the Absorbing Counter for Incremental K-Liveness (Bounds k up to 2^Width)
+#define V3_KLIVE_MAX_COUNTER_WIDTH 12
+
 /* -------------------------------------------------- *\
  * Class V3VrfKLive Implementations
 \* -------------------------------------------------- */
@@ -23,9 +26,10 @@ V3VrfKLive::V3VrfKLive(const V3NtkHandler* const handler) : V3VrfBase(handler) {
    // Private Data Members
    _klNtk = copyV3Ntk(handler->getNtk()); assert (_klNtk); _klNtk->createOutput(V3NetId::makeNetId(0));
    _klHandler = new V3NtkHandler(0, _klNtk); assert (_klHandler); _klChecker = 0; _incDepth = 1; _klNetList.clear();
+   _klCounter.clear(); _klIncCounter = false;
    // Statistics
    if (profileON()) {
-      _totalStat  = new V3Stat("TOTAL");
+      _totalStat  = new V3Stat("TOTAL", 0, "KLIVE");
       _checkStat  = new V3Stat("FORMAL CHECK", _totalStat);
       _ntkGenStat = new V3Stat("NTK GENERATE", _totalStat);
    }
@@ -34,7 +38,7 @@ V3VrfKLive::V3VrfKLive(const V3NtkHandler* const handler) : V3VrfBase(handler) {
 V3VrfKLive::~V3VrfKLive() {
    // Private Data Members
    if (_klHandler) delete _klHandler; _klHandler = 0; _klNtk = 0;
-   if (_klChecker) delete _klChecker; _klChecker = 0; _klNetList.clear();
+   if (_klChecker) delete _klChecker; _klChecker = 0; _klNetList.clear(); _klCounter.clear();
    // Statistics
    if (profileON()) {
       if (_totalStat ) delete _totalStat;
@@ -60,6 +64,7 @@ vrfRestart:
    // Initialize Checker
    if (_klChecker) {
       _klChecker->setMaxTime(_maxTime);
+      _klChecker->setMaxMemory(_maxMemory);
       _klChecker->setMaxDepth(V3NtkUD);
       _klChecker->setSolver(getSolver());
       _klChecker->setIncKeepSilent(true);
@@ -75,7 +80,7 @@ vrfRestart:
    struct timeval inittime, curtime; gettimeofday(&inittime, NULL);
 
    // Initialize KLiveness Nets
-   _klNetList.clear();
+   _klNetList.clear(); _klCounter.clear();
 
    // Start K-Liveness Algorithm
    uint32_t count = 0, lastCount = getIncLastDepthToKeepGoing();
@@ -103,9 +108,26 @@ vrfRestart:
       }
       // Elaborate Network
       if (profileON()) _ntkGenStat->start();
-      for (uint32_t i = 0; i < _incDepth; ++i, ++count) if (!count) initializeNetwork(p); else attachNetwork(p);
-      // Update Output for Safety Check
-      updateOutput(p); if (profileON()) _ntkGenStat->end();
+      if (_klIncCounter) {
+         // Latches are Fixed after the Counter is Built, so Frames of the Checker Stay Valid as k Grows
+         if (!count) { initializeNetwork(p); initializeCounter(p); } count += _incDepth;
+         if (count > (1ul << _klCounter.size())) {  // Counter Saturates, Larger Bounds are Not Expressible
+            if (profileON()) _ntkGenStat->end();
+            if (!isIncKeepSilent()) {
+               if (intactON() && !endLineON()) Msg(MSG_IFO) << "\r" + flushSpace + "\r";
+               Msg(MSG_WAR) << "K-Liveness Counter Saturates at Bound " << (1ul << _klCounter.size())
+                            << ", Disable the Incremental Counter for Larger Bounds !!" << endl;
+            }
+            break;
+         }
+         updateCounterOutput(p, count);
+      }
+      else {
+         for (uint32_t i = 0; i < _incDepth; ++i, ++count) if (!count) initializeNetwork(p); else attachNetwork(p);
+         // Update Output for Safety Check
+         updateOutput(p);
+      }
+      if (profileON()) _ntkGenStat->end();
       if (count < lastCount) continue;
       
       // Perform Safety Property Checking on the Last Output for Checking if K-Liveness Bound is Reached
@@ -117,7 +139,7 @@ vrfRestart:
       if (profileON()) _checkStat->end(); keepLastReachability = keepLastSolver = true;
       if (_klChecker->getResult(_klNtk->getOutputSize() - 1).isInv()) { proved = count; break; }
       if (!_klChecker->getResult(_klNtk->getOutputSize() - 1).isCex()) break;
-      if (_sharedBound) _sharedBound->updateBound(p, count);
+      updateSharedBound(p, count);
 
       // Simplify the K-Liveness Network if it Grows too Large
       //simplifyNetwork(p); keepLastSolver = false;
@@ -316,6 +338,50 @@ V3VrfKLive::updateOutput(const uint32_t& p) {
    _klNtk->replaceOutput(_klNtk->getOutputSize() - 1, id);
 }
 
+void
+V3VrfKLive::initializeCounter(const uint32_t& p) {
+   assert (_klNtk); assert (1 == _klNetList.size()); assert (!_klCounter.size());
+   // Width of the Counter Covers All Bounds to be Checked, but is Capped for Unbounded Runs
+   const uint32_t maxBound = (_maxDepth < (V3NtkUD - _incDepth)) ? (_maxDepth + _incDepth) : V3NtkUD;
+   uint32_t width = 1; while (width < V3_KLIVE_MAX_COUNTER_WIDTH && (1ul << width) < maxBound) ++width;
+   // Create Latches of the Counter, which Counts Fairness Events Strictly before the Current Cycle
+   for (uint32_t i = 0; i < width; ++i) { _klCounter.push_back(_klNtk->createNet()); assert (V3NetUD != _klCounter.back()); }
+   // Saturate at the Max Value, so that "counter >= k" is Absorbing
+   V3NetId full = _klCounter[0], carry, id1, id2;
+   for (uint32_t i = 1; i < width; ++i) full = createAndNet(full, _klCounter[i]);
+   carry = createAndNet(~_klNetList[0], ~full);
+   V3InputVec inputs(2, V3NetUD); inputs[1] = V3NetId::makeNetId(0);
+   for (uint32_t i = 0; i < width; ++i) {
+      // Next State : counter[i] XOR carry[i]
+      id1 = createAndNet(_klCounter[i], ~carry); id2 = createAndNet(~_klCounter[i], carry);
+      inputs[0] = ~createAndNet(~id1, ~id2);
+      _klNtk->setInput(_klCounter[i], inputs); _klNtk->createLatch(_klCounter[i]);
+      if ((1 + i) < width) carry = createAndNet(_klCounter[i], carry);
+   }
+}
+
+void
+V3VrfKLive::updateCounterOutput(const uint32_t& p, const uint32_t& k) {
+   assert (_klNtk); assert (1 == _klNetList.size()); assert (_klCounter.size());
+   assert (k && (k - 1) < (1ul << _klCounter.size()));
+   // Bad State : Fairness Event Happens for the k-th Time (counter >= k - 1) and Output p is Asserted
+   const V3NetId const1 = V3NetId::makeNetId(0, 1); V3NetId ge = const1;
+   for (uint32_t i = 0; i < _klCounter.size(); ++i) {
+      if ((k - 1) & (1ul << i)) ge = (const1 == ge) ? _klCounter[i] : createAndNet(_klCounter[i], ge);
+      else if (const1 != ge) ge = ~createAndNet(~_klCounter[i], ~ge);
+   }
+   V3NetId id = createAndNet(~_klNetList[0], _klNtk->getOutput(p));
+   if (const1 != ge) id = createAndNet(id, ge);
+   _klNtk->replaceOutput(_klNtk->getOutputSize() - 1, id);
+}
+
+const V3NetId
+V3VrfKLive::createAndNet(const V3NetId& id1, const V3NetId& id2) {
+   const V3NetId id = _klNtk->createNet(); assert (V3NetUD != id);
+   V3InputVec inputs(2, V3NetUD); inputs[0] = id1; inputs[1] = id2; _klNtk->setInput(id, inputs);
+   _klNtk->createGate(dynamic_cast<V3BvNtk*>(_klNtk) ? BV_AND : AIG_NODE, id); return id;
+}
+
 // Private KLive Helper Functions
 const bool
 V3VrfKLive::isValidChecker() const {
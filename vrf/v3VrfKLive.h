@@ -20,6 +20,7 @@ class V3VrfKLive : public V3VrfBase
       ~V3VrfKLive();
       // KLive Model Checker Setting Functions
       inline void setIncDepth(const uint32_t& i) { _incDepth = i; }
+      inline void setIncCounter(const bool& c) { _klIncCounter = c; }
       inline void setChecker(V3VrfBase* const c) { _klChecker = c; }
       // KLive Network Retrieval Functions
       // NOTE: An extra primary output is augmented for K-Liveness checks
@@ -32,6 +33,9 @@ class V3VrfKLive : public V3VrfBase
       void simplifyNetwork(const uint32_t&);
       void initializeNetwork(const uint32_t&);
       void updateOutput(const uint32_t&);
+      void initializeCounter(const uint32_t&);
+      void updateCounterOutput(const uint32_t&, const uint32_t&);
+      const V3NetId createAndNet(const V3NetId&, const V3NetId&);
       // Private KLive Helper Functions
       const bool isValidChecker() const;
       // Private Data Members
@@ -40,6 +44,8 @@ class V3VrfKLive : public V3VrfBase
       V3VrfBase*        _klChecker;       // Formal Engine for KLiveness
       uint32_t          _incDepth;        // Increment Depth
       V3NetVec          _klNetList;       // List of V3NetId for K-Liveness Signals
+      V3NetVec          _klCounter;       // Latches of the Absorbing Counter (LSB First)
+      bool              _klIncCounter;    // Toggle Incremental K-Liveness on One Counter
       // Statistics
       V3Stat*           _totalStat;       // Total Statistic
       V3Stat*           _checkStat;       // Formal Checking
@@ -20,12 +20,18 @@
 //#define V3_MPDR_USE_PROPAGATE_BACKWARD
 #define V3_MPDR_USE_PROPAGATE_LOW_COST
 
+// Minimum Number of Dead Clauses in a Frame to Refresh its Activator (Delta Encoding)
+#define V3_MPDR_DELTA_MIN_DEAD 64
+
+// Minimum Number of Cubes per Thread to Propagate a Frame in Parallel
+#define V3_MPDR_PARALLEL_PROPAGATE_MIN 16
+
 /* -------------------------------------------------- *\
  * Class V3MPDRFrame Implementations
 \* -------------------------------------------------- */
 // Constructor and Destructor
 V3MPDRFrame::V3MPDRFrame(const V3SvrData& a) : _activator(a) {
-   _cubeList.clear();
+   _cubeList.clear(); _deadCount = 0;
 }
 
 V3MPDRFrame::~V3MPDRFrame() {
@@ -90,7 +96,7 @@ V3MPDRFrame::removeSubsumed(const V3MPDRCube* const cube) {
          else { if (cubeState[j].cp ^ state[k].cp) break; ++j; ++k; }
       }
       if (j != cubeState.size()) ++it;
-      else { delete *it; _cubeList.erase(it++); }
+      else { delete *it; _cubeList.erase(it++); ++_deadCount; }
    }
 }
 
@@ -117,7 +123,7 @@ V3MPDRFrame::removeSubsumed(const V3MPDRCube* const cube, const V3MPDRCubeList::
          else { if (cubeState[j].cp ^ state[k].cp) break; ++j; ++k; }
       }
       if (j != cubeState.size()) ++it;
-      else { delete *it; _cubeList.erase(it++); }
+      else { delete *it; _cubeList.erase(it++); ++_deadCount; }
    }
 }
 
@@ -143,14 +149,14 @@ V3VrfMPDR::V3VrfMPDR(const V3NtkHandler* const handler) : V3VrfBase(handler) {
    // Recycle Members
    _pdrBackup.clear(); _pdrRecycle = V3NtkUD; _pdrActCount = 0;
    // Private Engines
-   _pdrSvr = 0; _pdrSim = 0; _pdrGen = 0;
+   _pdrSvr = 0; _pdrThreads = 1; _pdrSim = 0; _pdrGen = 0;
    // Private Tables
    _pdrInitConst.clear(); _pdrInitValue.clear();
    // Extended Data Members
    _pdrPriority.clear();
    // Statistics
    if (profileON()) {
-      _totalStat     = new V3Stat("TOTAL");
+      _totalStat     = new V3Stat("TOTAL", 0, "MPDR");
       _initSvrStat   = new V3Stat("SVR INIT",    _totalStat);
       _solveStat     = new V3Stat("SVR SOLVE",   _totalStat);
       _generalStat   = new V3Stat("GENERALIZE",  _totalStat);
@@ -277,6 +283,10 @@ vrfRestart:
       // Check Time Bounds
       gettimeofday(&curtime, NULL);
       if (_maxTime < getTimeUsed(inittime, curtime)) break;
+      // Check Memory Bound
+      if (_sharedMem && !_sharedMem->isMemValid()) break;
+      // Check Memory Budget (Recycle the Solver before Giving Up)
+      if (isMemBudgetExceeded(getPDRMemory()) && !reducePDRMemory()) break;
       // Check Shared Results
       if (_sharedBound && (V3NtkUD == _sharedBound->getBound(p))) break;
       // Check Shared Networks
@@ -299,7 +309,7 @@ vrfRestart:
             if (svrInfoON()) { Msg(MSG_IFO) << "  ("; _pdrSvr->printInfo(); Msg(MSG_IFO) << ")"; }
             Msg(MSG_IFO) << endl;  // Always Endline At the End of Each Frame
          }
-         if (_sharedBound) _sharedBound->updateBound(p, getPDRFrame());
+         updateSharedBound(p, getPDRFrame());
          // Push New Frame
          _pdrFrame.push_back(_pdrFrame.back());  // Renders F Infinity to be the last in _pdrFrame
          if (_pdrBackup.size()) {
@@ -409,7 +419,10 @@ void
 V3VrfMPDR::initializeSolver() {
    if (profileON()) _initSvrStat->start();
    const bool isNewSolver = !_pdrSvr;
-   if (!_pdrSvr) { _pdrSvr = allocSolver(getSolver(), _vrfNtk); assert (_pdrSvr->totalSolves() == 0); }
+   if (!_pdrSvr) {
+      _pdrSvr = allocSolver(getSolver(), _vrfNtk); assert (_pdrSvr->totalSolves() == 0);
+      if (profileON()) _pdrSvr->setStat(_solveStat);
+   }
    else _pdrSvr->reset(); _pdrActCount = _pdrRecycle;
    // Set Initial State to Solver
    for (uint32_t i = 0; i < _vrfNtk->getLatchSize(); ++i) _pdrSvr->addBoundedVerifyData(_vrfNtk->getLatch(i), 0);
@@ -460,13 +473,29 @@ V3VrfMPDR::recycleSolver() {
    _pdrSvr->simplify();
 }
 
+void
+V3VrfMPDR::refreshFrameActivators() {
+   // Frames are Encoded Incrementally in Delta Encoding : a cube is only kept in the highest frame it is blocked,
+   // so cubes subsumed or pushed forward leave dead clauses behind their frame activators.
+   // Instead of rebuilding the solver, a frame with too many dead clauses is re-encoded under a fresh activator,
+   // and the old activator is disabled. Dead clauses are then satisfied and deleted by the solver in simplify().
+   assert (isDeltaEncode()); bool refreshed = false;
+   for (uint32_t i = 1; i < _pdrFrame.size(); ++i) {
+      const uint32_t deadCount = _pdrFrame[i]->getDeadCount();
+      if (deadCount < V3_MPDR_DELTA_MIN_DEAD || deadCount < _pdrFrame[i]->getCubeList().size()) continue;
+      const V3SvrData activator = _pdrFrame[i]->getActivator(); addFrameInfoToSolver(i);
+      _pdrSvr->assertProperty(_pdrSvr->getNegFormula(activator)); refreshed = true;
+   }
+   if (refreshed) _pdrSvr->simplify();
+}
+
 // PDR Main Functions
 V3MPDRCube* const
 V3VrfMPDR::getInitialObligation() {  // If SAT(R ^ T ^ !p)
    assert (_pdrBad); _pdrSvr->assumeRelease();
    assumeReachability(getPDRDepth());  // Assume R
    const V3NetVec& state = _pdrBad->getState(); assert (1 == state.size());
-   _pdrSvr->addBoundedVerifyData(state[0], 0);
+   _pdrSvr->addPolarVerifyData(state[0], 0);
    _pdrSvr->assumeProperty(_pdrSvr->getFormula(state[0], 0));
    if (profileON()) _solveStat->start();
    _pdrSvr->simplify();
@@ -516,7 +545,7 @@ V3VrfMPDR::recursiveBlockCube(V3MPDRCube* const badCube) {
                generalizedCube.first = baseCube.first;
                generalizedCube.second = new V3MPDRCube(*(baseCube.second));
                generalization(generalizedCube);  // Generalization
-               if (profileON()) _generalStat->end();
+               if (profileON()) { _generalStat->end(); _generalStat->count(V3_STAT_CUBE); }
                addBlockedCube(generalizedCube);  // Record this Cube that is bad and to be blocked
                // I found Niklas Een has modified the original IWLS paper and alter the line below
                // However, I suggest the alteration restricts PDR (i.e. fold-free) and does not help
@@ -539,10 +568,11 @@ V3VrfMPDR::recursiveBlockCube(V3MPDRCube* const badCube) {
 #ifdef V3_MPDR_USE_PROPAGATE_LOW_COST
 const bool
 V3VrfMPDR::propagateCubes() {
-   if (profileON()) _propagateStat->start();
+   if (profileON()) _propagateStat->start(); V3VrfCubePropagator* propagator = 0;
    // Check Each Frame if some Cubes can be Further Propagated
    for (uint32_t i = 1; i < getPDRDepth(); ++i) {
       const V3MPDRCubeList& cubeList = _pdrFrame[i]->getCubeList();
+      V3MPDRPushMap pushMap; const bool parallel = propagateCubesInParallel(i, pushMap, propagator);
 #ifdef V3_MPDR_USE_PROPAGATE_BACKWARD
       // Backward Version  (Check from rbegin() to rend())
       uint32_t candidates = 1; V3MPDRCubeList::const_iterator it;
@@ -554,11 +584,12 @@ V3VrfMPDR::propagateCubes() {
       while (it != cubeList.end()) {
 #endif
          // Check if this cube can be pushed forward (closer to All Frame)
-         if (!checkReachability(i + 1, (*it)->getState(), false)) {
+         if (parallel ? (pushMap.end() != pushMap.find(*it)) : !checkReachability(i + 1, (*it)->getState(), false)) {
             V3MPDRTimedCube cube = make_pair(i + 1, new V3MPDRCube(*(*it)));
             // Remove Cubes in the Next Frame that can be Subsumed by the cube
-            removeFromProof(cube); _pdrFrame[i + 1]->removeSubsumed(cube.second);
-            // Remove cubes in this frame that can be subsumed by the cube
+            if (parallel) removeFromParallelProof(cube, pushMap[*it]); else removeFromProof(cube);
+            _pdrFrame[i + 1]->removeSubsumed(cube.second);
+            // Remove cubes in this frame that can be subsumed by the cube (including the pushed cube itself)
             _pdrFrame[i]->removeSubsumed(cube.second, ++it);
             // Block this cube again at higher frames
             addBlockedCube(cube);
@@ -589,6 +620,7 @@ V3VrfMPDR::propagateCubes() {
       */
       // Check Inductive Invariant
       if (!_pdrFrame[i]->getCubeList().size()) {
+         if (propagator) delete propagator;
          if (profileON()) _propagateStat->end();
          return true;
       }
@@ -605,16 +637,19 @@ V3VrfMPDR::propagateCubes() {
       }
    }
    */
+   if (isDeltaEncode()) refreshFrameActivators();
+   if (propagator) delete propagator;
    if (profileON()) _propagateStat->end();
    return false;
 }
 #else
 const bool
 V3VrfMPDR::propagateCubes() {
-   if (profileON()) _propagateStat->start();
+   if (profileON()) _propagateStat->start(); V3VrfCubePropagator* propagator = 0;
    // Check Each Frame if some Cubes can be Further Propagated
    for (uint32_t i = 1; i < getPDRDepth(); ++i) {
       const V3MPDRCubeList& cubeList = _pdrFrame[i]->getCubeList();
+      V3MPDRPushMap pushMap; const bool parallel = propagateCubesInParallel(i, pushMap, propagator);
 #ifdef V3_MPDR_USE_PROPAGATE_BACKWARD
       // Backward Version  (Check from rbegin() to rend())
       uint32_t candidates = 1; V3MPDRCubeList::const_iterator it;
@@ -626,10 +661,11 @@ V3VrfMPDR::propagateCubes() {
       while (it != cubeList.end()) {
 #endif
          // Check if this cube can be pushed forward (closer to All Frame)
-         if (!checkReachability(i + 1, (*it)->getState(), false)) {
+         if (parallel ? (pushMap.end() != pushMap.find(*it)) : !checkReachability(i + 1, (*it)->getState(), false)) {
             V3MPDRTimedCube cube = make_pair(i + 1, new V3MPDRCube(*(*it)));
             // Block this cube again at higher frames
-            removeFromProof(cube); addBlockedCube(cube);
+            if (parallel) removeFromParallelProof(cube, pushMap[*it]); else removeFromProof(cube);
+            addBlockedCube(cube);
             // Remove blocked cubes in lower frames that can be subsumed by the cube
             for (uint32_t j = 1; j < i; ++j) _pdrFrame[j]->removeSubsumed(cube.second);
             // Remove Cubes in this Frame that can be Subsumed by the cube
@@ -654,6 +690,7 @@ V3VrfMPDR::propagateCubes() {
       // Check Inductive Invariant
       for (uint32_t j = 1; j <= i; ++j) {
          if (!_pdrFrame[j]->getCubeList().size()) {
+            if (propagator) delete propagator;
             if (profileON()) _propagateStat->end();
             return true;
          }
@@ -661,11 +698,41 @@ V3VrfMPDR::propagateCubes() {
    }
    // Check if Any Remaining Cubes in these Frames can be Subsumed
    _pdrFrame[getPDRDepth()]->removeSelfSubsumed(); _pdrFrame[getPDRFrame()]->removeSelfSubsumed();
+   if (isDeltaEncode()) refreshFrameActivators();
+   if (propagator) delete propagator;
    if (profileON()) _propagateStat->end();
    return false;
 }
 #endif
 
+const bool
+V3VrfMPDR::propagateCubesInParallel(const uint32_t& i, V3MPDRPushMap& pushMap, V3VrfCubePropagator*& propagator) {
+   // Cubes in frame i are all checked against R_i ^ T, so the checks are independent of each other
+   // (workers only miss the cubes generalized earlier in the same pass, which is sound but may push less).
+   // Each worker encodes R_i without frame activators on a private solver, and the cubes proven pushable
+   // are recorded in pushMap with the literals in their UNSAT cores. Return false if frame i is too small.
+   assert (i < getPDRDepth()); pushMap.clear();
+   const V3MPDRCubeList& cubeList = _pdrFrame[i]->getCubeList();
+   if (1 >= _pdrThreads || _constr.size() || (_pdrThreads * V3_MPDR_PARALLEL_PROPAGATE_MIN) > cubeList.size()) return false;
+   // Workers are Created Once per Pass, and Only Encode Cubes Blocked since their Last Check
+   if (!propagator) {
+      propagator = new V3VrfCubePropagator(_pdrSvr, _vrfNtk, V3NetVec(), _pdrThreads); assert (propagator); }
+   for (uint32_t j = i; j < _pdrFrame.size(); ++j) {
+      const V3MPDRCubeList& frameList = _pdrFrame[j]->getCubeList();
+      for (V3MPDRCubeList::const_iterator it = frameList.begin(); it != frameList.end(); ++it)
+         propagator->addBlockedCube(j, *it, (*it)->getState());
+   }
+   // Collect Candidate Cubes
+   V3NetTable cubes; V3Vec<const V3MPDRCube*>::Vec cubeRefs;
+   cubes.reserve(cubeList.size()); cubeRefs.reserve(cubeList.size());
+   for (V3MPDRCubeList::const_iterator it = cubeList.begin(); it != cubeList.end(); ++it) {
+      cubes.push_back((*it)->getState()); cubeRefs.push_back(*it); }
+   // Check Cubes in Parallel
+   V3BoolVec pushed; V3BoolTable cores; propagator->checkCubes(i, cubes, pushed, cores);
+   for (uint32_t j = 0; j < cubes.size(); ++j) if (pushed[j]) pushMap[cubeRefs[j]].swap(cores[j]);
+   return true;
+}
+
 // PDR Auxiliary Functions
 const bool
 V3VrfMPDR::checkReachability(const uint32_t& frame, const V3NetVec& cubeState, const bool& extend) {
@@ -694,6 +761,7 @@ V3VrfMPDR::checkReachability(const uint32_t& frame, const V3NetVec& cubeState, c
       const bool result = _pdrSvr->assump_solve();
       if (profileON()) _solveStat->end();
       _pdrSvr->assertProperty(_pdrSvr->getNegFormula(_pdrSvrData));  // Invalidate ~cube in future solving
+      // NOTE: Delta encoding also counts activators, as variables are never freed by the solver
       --_pdrActCount; return result;
    }
    else {
@@ -916,6 +984,23 @@ V3VrfMPDR::removeFromProof(V3MPDRTimedCube& timedCube, const bool& pushForward)
    assert (!checkReachability(timedCube.first, timedCube.second->getState())); return isSvrDataInvolved;
 }
 
+void
+V3VrfMPDR::removeFromParallelProof(V3MPDRTimedCube& timedCube, const V3BoolVec& core) {
+   // This function can ONLY be called for a cube proven pushable by propagateCubesInParallel()
+   // core marks the literals of cube' in the UNSAT core found by a worker (empty if unavailable)
+   // NOTE: Workers have no frame activators, so the cube is kept at timedCube.first
+   if (!core.size()) return;  // Solver does not Support Analyze Conflict
+   const V3NetVec& state = timedCube.second->getState(); assert (core.size() == state.size());
+   addCubeToSolver(state, 1); V3SvrDataSet coreProofVarSet; coreProofVarSet.clear();
+   for (uint32_t i = 0; i < state.size(); ++i)
+      if (core[i]) coreProofVarSet.insert(_pdrSvr->getFormula(_vrfNtk->getLatch(state[i].id), 1));
+   // Get Generalized State from Worker Proof
+   assert (!existInitial(timedCube.second->getState()));
+   resolveInitial(timedCube.second, coreProofVarSet);
+   assert (!existInitial(timedCube.second->getState()));
+   assert (!checkReachability(timedCube.first, timedCube.second->getState()));
+}
+
 void
 V3VrfMPDR::generalizeProof(V3MPDRTimedCube& timedCube) {
    // Apply SAT Solving to further generalize cube
@@ -1047,6 +1132,38 @@ V3VrfMPDR::reportUnsupportedInitialState() {
    return ok;
 }
 
+// PDR Memory Budget Functions
+const double
+V3VrfMPDR::getPDRMemory() const {
+   // Estimated Memory (in MB) of the Solver and Frames
+   uint32_t cubes = 0;
+   for (uint32_t i = 0; i < _pdrFrame.size(); ++i) cubes += _pdrFrame[i]->getCubeList().size();
+   for (uint32_t i = 0; i < _pdrBackup.size(); ++i) cubes += _pdrBackup[i]->getCubeList().size();
+   return getSolverMemory(_pdrSvr) + ((cubes * (sizeof(V3MPDRCube) + _pdrInitConst.size())) / 1048576.0);
+}
+
+const bool
+V3VrfMPDR::reducePDRMemory() {
+   // Drop Learned Clauses and Deactivated Cubes (the Solver is Rebuilt from Frames)
+   // Give Up unless Recycling Leaves Headroom, Otherwise the Solver would be Recycled again in the Next Steps
+   _pdrActCount = 0; recycleSolver();
+   if (isMemBudgetRelieved(getPDRMemory())) return true;
+   if (!isIncKeepSilent()) Msg(MSG_WAR) << "Recycling the Solver Cannot Meet the Memory Budget of PDR !!" << endl;
+   return false;
+}
+
+// PDR Progress Report Functions
+const double
+V3VrfMPDR::getConvergence() const {
+   // A Frame that Runs Empty Closes the Proof, so Measure how Close the Sparsest Frame is
+   if (_pdrFrame.size() < 4) return 0; uint32_t minSize = V3NtkUD, maxSize = 0;
+   for (uint32_t i = 1; i < getPDRDepth(); ++i) {
+      const uint32_t size = _pdrFrame[i]->getCubeList().size();
+      if (size < minSize) minSize = size; if (size > maxSize) maxSize = size;
+   }
+   return maxSize ? (1.00 - ((double)minSize / (double)maxSize)) : 0;
+}
+
 // PDR Debug Functions
 void
 V3VrfMPDR::printState(const V3NetVec& state) const {
@@ -20,6 +20,7 @@ class V3MPDRFrame;
 // Defines for Monolithic PDR Global Data
 typedef pair<uint32_t, V3MPDRCube*>       V3MPDRTimedCube;
 typedef V3Vec<V3MPDRFrame*>::Vec          V3MPDRFrameVec;
+typedef V3Map<const V3MPDRCube*, V3BoolVec>::Map   V3MPDRPushMap;
 
 // class V3MPDRCube : Cube Data Structue for Monolithic PDR
 // NOTE: State Variables are Intrinsically Sorted by their indices (small to large)
@@ -81,17 +82,19 @@ class V3MPDRFrame
       inline const V3MPDRCubeList& getCubeList() const { return _cubeList; }
       inline const bool pushCube(V3MPDRCube* const);
       inline void clearCubeList() { _cubeList.clear(); }
+      inline const uint32_t getDeadCount() const { return _deadCount; }
       // Cube Containment Functions
       const bool subsumes(const V3MPDRCube* const) const;
       void removeSubsumed(const V3MPDRCube* const);
       void removeSubsumed(const V3MPDRCube* const, const V3MPDRCubeList::const_iterator&);
       void removeSelfSubsumed();
       // Recycle Auxiliary Functions
-      inline void setActivator(const V3SvrData& act) { _activator = act; }
+      inline void setActivator(const V3SvrData& act) { _activator = act; _deadCount = 0; }
    private : 
       // Private Data Members
       V3SvrData      _activator;    // Activation Variable for Clause Indication
       V3MPDRCubeList _cubeList;     // List of Cubes Blocked in this Frame
+      uint32_t       _deadCount;    // Number of Removed (Subsumed or Pushed) Cubes whose Clauses are Still Guarded by _activator
 };
 
 // class V3VrfMPDR : Verification Handler for Monolithic Property Directed Reachability
@@ -101,14 +104,19 @@ class V3VrfMPDR : public V3VrfBase
       // Constructor and Destructor
       V3VrfMPDR(const V3NtkHandler* const);
       ~V3VrfMPDR();
+      // PDR Progress Report Functions
+      const double getConvergence() const;
       // PDR Specific Settings
       inline void setRecycle(const uint32_t& r) { _pdrRecycle = r; }
       inline void setForwardSATGen  (const bool& s) { if (s) _pdrAttr |= 1ul; else _pdrAttr &= ~1ul; }
       inline void setForwardUNSATGen(const bool& u) { if (u) _pdrAttr |= 2ul; else _pdrAttr &= ~2ul; }
+      inline void setDeltaEncode    (const bool& d) { if (d) _pdrAttr |= 4ul; else _pdrAttr &= ~4ul; }
+      inline void setPropagateThreads(const uint32_t& t) { assert (t); _pdrThreads = t; }
    private : 
       // Private Attribute Setting Functions
       inline const bool isForwardSATGen()   const { return _pdrAttr & 1ul; }
       inline const bool isForwardUNSATGen() const { return _pdrAttr & 2ul; }
+      inline const bool isDeltaEncode()     const { return _pdrAttr & 4ul; }
       // Private Verification Main Functions
       void startVerify(const uint32_t&);
       // PDR Initialization Functions
@@ -116,10 +124,12 @@ class V3VrfMPDR : public V3VrfBase
       void addCubeToSolver(const V3NetVec&, const uint32_t&);
       void addFrameInfoToSolver(const uint32_t&);
       void recycleSolver();
+      void refreshFrameActivators();
       // PDR Main Functions
       V3MPDRCube* const getInitialObligation();
       V3MPDRCube* const recursiveBlockCube(V3MPDRCube* const);
       const bool propagateCubes();
+      const bool propagateCubesInParallel(const uint32_t&, V3MPDRPushMap&, V3VrfCubePropagator*&);
       // PDR Auxiliary Functions
       const bool checkReachability(const uint32_t&, const V3NetVec&, const bool& = true);
       const bool isBlocked(const V3MPDRTimedCube&);
@@ -134,6 +144,7 @@ class V3VrfMPDR : public V3VrfBase
       // PDR Generalization Functions
       void generalizeSimulation(V3MPDRCube* const, const V3MPDRCube* const, const uint32_t&);
       const bool removeFromProof(V3MPDRTimedCube&, const bool& = true);
+      void removeFromParallelProof(V3MPDRTimedCube&, const V3BoolVec&);
       void generalizeProof(V3MPDRTimedCube&);
       void forwardProof(V3MPDRTimedCube&);
       const bool generalizeCex(V3MPDRTimedCube&);
@@ -141,6 +152,9 @@ class V3VrfMPDR : public V3VrfBase
       inline const uint32_t getPDRDepth() const { return _pdrFrame.size() - 2; }
       inline const uint32_t getPDRFrame() const { return _pdrFrame.size() - 1; }
       const bool reportUnsupportedInitialState();
+      // PDR Memory Budget Functions
+      const double getPDRMemory() const;
+      const bool reducePDRMemory();
       // PDR Debug Functions
       void printState(const V3NetVec&) const;
       // Private Data Members
@@ -154,6 +168,7 @@ class V3VrfMPDR : public V3VrfBase
       uint32_t          _pdrActCount;     // Activation Variable Count
       // Private Engines
       V3SvrBase*        _pdrSvr;          // The Monolithic SAT Solver
+      uint32_t          _pdrThreads;      // Number of Threads for Cube Propagation
       V3AlgSimulate*    _pdrSim;          // Simulation Handler
       V3AlgGeneralize*  _pdrGen;          // Generalization Handler
       // Private Tables
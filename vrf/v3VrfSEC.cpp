@@ -13,6 +13,27 @@
 #include "v3NtkUtil.h"
 #include "v3StrUtil.h"
 #include "v3VrfMPDR.h"
+#include "v3AlgFraig.h"
+
+#include <pthread.h>
+
+// Number of Counterexamples Replayed Together (One per Lane of the Bit-parallel AIG Simulator)
+#define V3_SEC_CEX_BATCH_SIZE 64
+// Number of Candidate Classes Checked per Round of Parallel Induction
+#define V3_SEC_INDUCTION_BATCH_SIZE 256
+
+/* -------------------------------------------------- *\
+ * Parallel Induction Helpers
+\* -------------------------------------------------- */
+struct V3VrfSECInductionTask {
+   V3VrfSEC*               sec;
+   V3SvrBase*              solver;     // Private Solver of the Worker
+   const V3NetVec*         eqNets;     // Nets Asserting that Each Candidate Class is EQ
+   uint32_t                begin, end;
+   uint32_t                depth;      // Depth of the Induction
+   V3BoolVec               proven;     // Whether the Class is Inductive (Local to Worker, Indexed from begin)
+   V3Vec<V3CexTrace*>::Vec cex;        // Counterexample from Initial States (Local to Worker, Indexed from begin)
+};
 
 /* -------------------------------------------------- *\
  * Class V3VrfSEC Implementations
@@ -26,11 +47,13 @@ V3VrfSEC::V3VrfSEC(const V3NtkHandler* const handler) : V3VrfBase(handler) {
    // Private Mapping Tables
    _p2cMap.clear(); _c2pMap.clear();
    // Private EC Pair Storage Data
-   _secCandidate.clear(); _secCheckFail.clear(); _secEQSize = 0;
-   _secSynthesis = 0; _secIsCECorSEC = 0; _secCECAssumed = 0; _secSECAssumed = 0; _secLastDepth = 0;
+   _secCandidate.clear(); _secCheckFail.clear(); _secEqHash.clear(); _secEQSize = 0; _secThreads = 1;
+   _secSynthesis = 0; _secIsCECorSEC = 0; _secCECAssumed = 0; _secSECAssumed = 0; _secFraig = 0; _secLastDepth = 0;
+   // Private Counterexample Batch
+   _secBatchInit.clear(); _secBatchTrace.clear();
    // Statistics
    if (profileON()) {
-      _totalStat = new V3Stat("TOTAL");
+      _totalStat = new V3Stat("TOTAL", 0, "SEC");
       _simStat   = new V3Stat("SIMULATION",   _totalStat);
       _simpStat  = new V3Stat("NTK SIMPLIFY", _totalStat);
       _checkStat = new V3Stat("FORMAL CHECK", _totalStat);
@@ -46,7 +69,9 @@ V3VrfSEC::~V3VrfSEC() {
    _p2cMap.clear(); _c2pMap.clear();
    // Private EC Pair Storage Data
    for (uint32_t i = 0; i < _secCandidate.size(); ++i) _secCandidate[i].clear();
-   _secCandidate.clear(); _secCheckFail.clear();
+   _secCandidate.clear(); _secCheckFail.clear(); _secEqHash.clear();
+   // Private Counterexample Batch
+   _secBatchInit.clear(); _secBatchTrace.clear();
    // Statistics
    if (profileON()) {
       if (_totalStat) delete _totalStat;
@@ -72,7 +97,7 @@ V3VrfSEC::startVerify(const uint32_t& p) {
 
    // Initialize Simulator
    if (!_secSim) {
-      if (dynamic_cast<V3BvNtk*>(_secNtk)) _secSim = new V3AlgBvSimulate(_secHandler);
+      if (dynamic_cast<V3BvNtk*>(_secNtk)) _secSim = new V3AlgBvFlatSimulate(_secHandler);
       else _secSim = new V3AlgAigSimulate(_secHandler); assert (_secSim);
    }
 
@@ -84,7 +109,8 @@ V3VrfSEC::startVerify(const uint32_t& p) {
    }
 
    // Initialize EC Pair Storage Data
-   _secCandidate.clear(); _secCheckFail.clear(); _secEQSize = 0; _secLastDepth = 1;
+   _secCandidate.clear(); _secCheckFail.clear(); _secEqHash.clear(); _secEQSize = 0; _secLastDepth = 1;
+   _secBatchInit.clear(); _secBatchTrace.clear();
 
    // Initialize Parameters
    assert (p < _result.size()); assert (p < _vrfNtk->getOutputSize());
@@ -103,6 +129,9 @@ V3VrfSEC::startVerify(const uint32_t& p) {
    for (uint32_t i = 0; i < _result.size(); ++i) 
       unsolved.push_back((_result[i].isCex() || _result[i].isInv()) ? V3NtkUD : 0);
 
+   // Merge Combinational Equivalences before Simulation
+   if (isFraigMode()) fraigSECNetwork();
+
    // Start SEC Based Verification
    bool continueOnSolver = false, keepReachability = true, initValid = true;
    V3RepIdHash repIdHash; repIdHash.clear(); uint32_t noProof = 0;
@@ -117,9 +146,36 @@ V3VrfSEC::startVerify(const uint32_t& p) {
       // Random Simulation for Update EC Candidates
       if (profileON()) _simStat->start(); randomSimulate(p, _secLastDepth << 1, initValid); initValid = false;
       if (profileON()) _simStat->end(); if (_result[p].isCex()) { fired = _secLastDepth; break; }
+      // Formal Verification on SEC Candidates (Parallel Induction)
+      while (isParallelMode()) {
+         gettimeofday(&curtime, NULL); if (_maxTime < getTimeUsed(inittime, curtime)) break;
+         if (profileON()) _checkStat->start(); const uint32_t checked = checkECPairInParallel(repIdHash);
+         if (profileON()) _checkStat->end(); if (_result[p].isInv()) { proved = _secLastDepth; break; }
+         if (_secBatchTrace.size() && (!checked || V3_SEC_CEX_BATCH_SIZE <= _secBatchTrace.size())) {
+            if (profileON()) _simStat->start(); flushSimulationTrace(); if (profileON()) _simStat->end();
+            if (_result[p].isCex()) { fired = _secLastDepth; break; }
+         }
+         else if (!checked) break;
+
+         // Report Verification Progress
+         if (!isIncKeepSilent() && intactON()) {
+            if (!endLineON()) Msg(MSG_IFO) << "\r" + flushSpace + "\r";
+            Msg(MSG_IFO) << (isInternalCEC() ? "CEC-based " : isInternalSEC() ? "SEC-based " : "")
+                         << "Verification on Depth = " << _secLastDepth << ": " 
+                         << "Candidate Sets EQ / Remaining = " << _secEQSize << " / " << _secCandidate.size();
+            if (endLineON()) Msg(MSG_IFO) << endl; else Msg(MSG_IFO) << flush;
+         }
+      }
       // Formal Verification on SEC Candidates
-      while (_secChecker) {
-         const uint32_t x = getTargetCandidate(); if (V3NtkUD == x) break;
+      while (_secChecker && !isParallelMode()) {
+         uint32_t x = getTargetCandidate();
+         if (V3NtkUD == x && _secBatchTrace.size()) {
+            // Replay Pending Counterexamples before Running Out of Candidates
+            if (profileON()) _simStat->start(); flushSimulationTrace(); if (profileON()) _simStat->end();
+            if (_result[p].isCex()) { fired = _secLastDepth; break; }
+            x = getTargetCandidate();
+         }
+         if (V3NtkUD == x) break;
          assert (_secCandidate.size() > x); assert (1 < _secCandidate[x].size());
          keepReachability = (++noProof <= (uint32_t)(sqrt(_secCandidate.size())));
          // Replace the SEC Output by Equating SEC Candidates
@@ -127,6 +183,7 @@ V3VrfSEC::startVerify(const uint32_t& p) {
          // Run Formal Checker
          if (profileON()) _checkStat->start();
          _secChecker->setMaxTime(_maxTime);
+         _secChecker->setMaxMemory(_maxMemory);
          _secChecker->setMaxDepth(_secLastDepth);
          _secChecker->setIncKeepLastReachability( keepReachability);
          _secChecker->setIncLastDepthToKeepGoing(_secLastDepth >> 1);
@@ -134,11 +191,14 @@ V3VrfSEC::startVerify(const uint32_t& p) {
          _secChecker->verifyProperty(secIndex); continueOnSolver = true;
          if (profileON()) _checkStat->end();
          // Update SEC Candidates According to the Result
+         // NOTE: Refuted Candidates are Deferred until a Batch of Counterexamples is Collected
          if (_secChecker->getResult(secIndex).isCex()) {
             V3CexTrace* const cex = _secChecker->getResult(secIndex).getCexTrace();
-            assert (cex); if (profileON()) _simStat->start();
-            addSimulationTrace(*cex); if (profileON()) _simStat->end();
-            if (_result[p].isCex()) { fired = _secLastDepth; break; }
+            assert (cex); pushSimulationTrace(*cex); _secCheckFail[x] = true;
+            if (V3_SEC_CEX_BATCH_SIZE <= _secBatchTrace.size()) {
+               if (profileON()) _simStat->start(); flushSimulationTrace(); if (profileON()) _simStat->end();
+               if (_result[p].isCex()) { fired = _secLastDepth; break; }
+            }
          }
          else if (_secChecker->getResult(secIndex).isInv()) {
             // Update Candidate List
@@ -168,6 +228,7 @@ V3VrfSEC::startVerify(const uint32_t& p) {
       // Perform Speculative Reduction
       if (profileON()) _specuStat->start(); speculativeReduction(_secLastDepth);
       if (profileON()) _specuStat->end(); continueOnSolver = false;
+      if (isFraigMode()) fraigSECNetwork();
       
       // Check if Some Properties are EQ with CONST 0
       if (_sharedBound) _sharedBound->getBound(unsolved);
@@ -202,6 +263,8 @@ V3VrfSEC::startVerify(const uint32_t& p) {
       else _secLastDepth *= 2;
    }
 
+   _secBatchInit.clear(); _secBatchTrace.clear();
+
    // Report Verification Result
    if (!isIncKeepSilent() && reportON()) {
       if (intactON()) {
@@ -330,6 +393,82 @@ V3VrfSEC::addSimulationTrace(const V3SimTrace& initData, const V3VrfSimTraceVec&
    }
 }
 
+void
+V3VrfSEC::pushSimulationTrace(const V3CexTrace& cex) {
+   assert (_secBatchInit.size() == _secBatchTrace.size());
+   _secBatchInit.push_back(V3SimTrace()); _secBatchTrace.push_back(V3VrfSimTraceVec());
+   computeTrace(cex, _secBatchInit.back(), _secBatchTrace.back());
+}
+
+void
+V3VrfSEC::flushSimulationTrace(const bool& checkValid) {
+   assert (_secBatchInit.size() == _secBatchTrace.size()); assert (_secSim);
+   // Replay Pending Counterexamples (Bit-parallel if Simulating AIG)
+   const uint32_t batchSize = dynamic_cast<V3AlgAigSimulate*>(_secSim) ? V3_SEC_CEX_BATCH_SIZE : 1;
+   for (uint32_t i = 0, j; i < _secBatchTrace.size(); i = j) {
+      if (!checkValid && !_secCandidate.size()) break;
+      j = ((i + batchSize) < _secBatchTrace.size()) ? (i + batchSize) : _secBatchTrace.size();
+      if (1 == batchSize) addSimulationTrace(_secBatchInit[i], _secBatchTrace[i], checkValid);
+      else addSimulationBatch(i, j, checkValid);
+   }
+   _secBatchInit.clear(); _secBatchTrace.clear();
+}
+
+void
+V3VrfSEC::addSimulationBatch(const uint32_t& begin, const uint32_t& end, const bool& checkValid) {
+   assert (begin < end); assert (end <= _secBatchTrace.size()); assert (V3_SEC_CEX_BATCH_SIZE >= (end - begin));
+   // Pack Counterexamples into Simulation Lanes, where Lane k Replays Counterexample begin + (k % size)
+   const uint32_t size = end - begin, inputSize = _secNtk->getInputSize();
+   const uint32_t patternSize = inputSize + _secNtk->getInoutSize();
+   uint32_t cycle = 0, i, j, k, x;
+   for (x = begin; x < end; ++x) if (cycle < _secBatchTrace[x].size()) cycle = _secBatchTrace[x].size();
+   V3SimTrace initData(_secNtk->getLatchSize(), V3BitVecX(V3_SEC_CEX_BATCH_SIZE));
+   V3VrfSimTraceVec traceData(cycle, V3SimTrace(patternSize, V3BitVecX(V3_SEC_CEX_BATCH_SIZE)));
+   for (k = 0; k < V3_SEC_CEX_BATCH_SIZE; ++k) {
+      x = begin + (k % size); assert (_secNtk->getLatchSize() == _secBatchInit[x].size());
+      for (j = 0; j < _secNtk->getLatchSize(); ++j)
+         if ('1' == _secBatchInit[x][j][0]) initData[j].set1(k); else initData[j].set0(k);
+      for (i = 0; i < _secBatchTrace[x].size(); ++i) {
+         assert (patternSize == _secBatchTrace[x][i].size());
+         for (j = 0; j < patternSize; ++j)
+            if ('1' == _secBatchTrace[x][i][j][0]) traceData[i][j].set1(k); else traceData[i][j].set0(k);
+      }
+   }
+   // Initialize Simulator
+   V3NetVec simTargets; simTargets.clear(); simTargets.reserve(_result.size());
+   for (i = 0; i < _result.size(); ++i) simTargets.push_back(_secNtk->getOutput(i));
+   _secSim->reset(simTargets); _secSim->updateNextStateValue();
+   for (j = 0; j < _secNtk->getLatchSize(); ++j) _secSim->setSource(_secNtk->getLatch(j), initData[j]);
+   // Simulate All Counterexamples Together
+   V3BitVecX value; uint64_t mask;
+   for (i = 0; i < cycle; ++i) {
+      // Set Trace Values
+      for (j = 0; j < inputSize; ++j) _secSim->setSource(_secNtk->getInput(j), traceData[i][j]);
+      for (; j < patternSize; ++j) _secSim->setSource(_secNtk->getInout(j - inputSize), traceData[i][j]);
+      // Simulate for One Cycle, Lanes of Finished Counterexamples are Masked Out
+      _secSim->simulate(); bool update = false; mask = 0;
+      for (k = 0; k < V3_SEC_CEX_BATCH_SIZE; ++k)
+         if (i < _secBatchTrace[begin + (k % size)].size()) mask |= (1ul << k);
+      if (checkValid) {
+         // Check if Property Asserted
+         for (j = 0; j < _result.size(); ++j) {
+            if (isSynthesisMode() || _result[j].isCex() || _result[j].isInv()) continue;
+            value = _secSim->getSimValue(_secNtk->getOutput(j));
+            for (k = 0; k < V3_SEC_CEX_BATCH_SIZE; ++k) if (((mask >> k) & 1ul) && '1' == value[k]) break;
+            if (V3_SEC_CEX_BATCH_SIZE == k) continue;
+            // Record Counterexample for Property j
+            V3VrfSimTraceVec subTraceData(traceData.begin(), traceData.begin() + (1 + i));
+            V3CexTrace* const cex = computeTrace(initData, subTraceData, k); assert (cex);
+            // Record the CounterExample Trace
+            _result[j].setCexTrace(cex); assert (_result[j].isCex()); update = true;
+         }
+      }
+      updateECPair(false, update, mask);
+      // Update FF Next State Values
+      _secSim->updateNextStateValue();
+   }
+}
+
 V3CexTrace* const
 V3VrfSEC::getSolverCexTrace(V3SvrBase* const solver, const uint32_t& cycle) {
    V3CexTrace* const cex = new V3CexTrace(cycle); assert (cex);
@@ -440,7 +579,7 @@ V3VrfSEC::initializeECPair() {
    for (uint32_t i = 0; i < _result.size(); ++i) targetNets.push_back(_secNtk->getOutput(i));
    V3UI32Vec levelData; levelData.clear(); computeLevel(_secNtk, levelData, targetNets);
    V3Map<uint32_t, uint32_t, V3UI32LessOrEq<uint32_t> >::Map levelNets;
-   V3BitVecX value; V3NetId id; levelNets.clear(); levelNets.insert(make_pair(0, 0));
+   V3NetId id; levelNets.clear(); levelNets.insert(make_pair(0, 0));
    for (id = V3NetId::makeNetId(1); id.id < levelData.size(); ++id.id) {
       if (V3NtkUD == levelData[id.id]) continue;
       if (isInternalCEC() && (BV_CONST == _secNtk->getGateType(id) || levelData[id.id])) continue;
@@ -448,24 +587,25 @@ V3VrfSEC::initializeECPair() {
    }
    // Initialize SEC Candidate Sets
    // NOTE: Nets in a Candidate Set is Ordered by Their Levels
-   V3Map<string, uint32_t>::Map secCandidate; V3Map<string, uint32_t>::Map::iterator is;
+   // NOTE: Nets are Hashed by Simulation Signatures, Collisions only Leave Extra Candidates to be Refuted
+   V3HashMap<uint64_t, uint32_t>::Hash secCandidate; V3HashMap<uint64_t, uint32_t>::Hash::iterator is;
    for (V3Map<uint32_t, uint32_t>::Map::const_iterator it = levelNets.begin(); it != levelNets.end(); ++it) {
       assert (V3NtkUD != it->first); assert (_secNtk->getNetSize() > it->second);
       id = V3NetId::makeNetId(it->second); assert (V3_XD > _secNtk->getGateType(id));
-      value = _secSim->getSimValue(id);
-      is = secCandidate.find(value.toExp());
+      const uint64_t sig = _secSim->getSimSignature(id);
+      is = secCandidate.find(sig);
       if (secCandidate.end() != is) {
          assert (_secCandidate.size() > is->second);
          assert (levelData[id.id] >= levelData[_secCandidate[is->second].back().id]);
          _secCandidate[is->second].push_back(id); continue;
       }
-      is = secCandidate.find((~value).toExp());
+      is = secCandidate.find(_secSim->getSimSignature(~id));
       if (secCandidate.end() != is) {
          assert (_secCandidate.size() > is->second);
          assert (levelData[id.id] >= levelData[_secCandidate[is->second].back().id]);
          _secCandidate[is->second].push_back(~id); continue;
       }
-      secCandidate.insert(make_pair(value.toExp(), _secCandidate.size()));
+      secCandidate.insert(make_pair(sig, _secCandidate.size()));
       _secCandidate.push_back(V3NetVec(1, id)); _secCheckFail.push_back(false);
    }
 }
@@ -495,27 +635,28 @@ V3VrfSEC::removeECPairOutOfCOI() {
 }
 
 void
-V3VrfSEC::updateECPair(const bool& initValid, const bool& update) {
-   V3BitVecX value;
+V3VrfSEC::updateECPair(const bool& initValid, const bool& update, const uint64_t& mask) {
    if (_secCandidate.size()) {
-      V3Map<string, uint32_t>::Map secCandidate; V3Map<string, uint32_t>::Map::iterator it;
+      // Split Candidate Sets by Simulation Signatures (Only Lanes in mask are Compared)
+      V3HashMap<uint64_t, uint32_t>::Hash secCandidate; V3HashMap<uint64_t, uint32_t>::Hash::iterator it;
+      uint64_t sig, repSig; uint32_t n;
       for (uint32_t i = 0, k = _secCandidate.size(); i < k; ++i) {
-         value = _secSim->getSimValue(_secCandidate[i][0]);
-         secCandidate.clear(); secCandidate.insert(make_pair(value.toExp(), i));
+         repSig = _secSim->getSimSignature(_secCandidate[i][0], mask); secCandidate.clear(); n = 1;
          for (uint32_t j = 1; j < _secCandidate[i].size(); ++j) {
-            value = _secSim->getSimValue(_secCandidate[i][j]);
-            it = secCandidate.find(value.toExp());
+            sig = _secSim->getSimSignature(_secCandidate[i][j], mask);
+            if (repSig == sig) { _secCandidate[i][n++] = _secCandidate[i][j]; continue; }
+            it = secCandidate.find(sig);
             if (secCandidate.end() != it) {
-               assert (_secCandidate.size() > it->second); if (i == it->second) continue;
+               assert (_secCandidate.size() > it->second);
                _secCandidate[it->second].push_back(_secCandidate[i][j]);
             }
             else {
-               secCandidate.insert(make_pair(value.toExp(), _secCandidate.size()));
+               secCandidate.insert(make_pair(sig, _secCandidate.size()));
                _secCandidate.push_back(V3NetVec(1, _secCandidate[i][j])); _secCheckFail.push_back(false);
             }
-            // Remove from this Bucket
-            _secCandidate[i].erase(_secCandidate[i].begin() + j); --j;
          }
+         // A Split Candidate Set Deserves Another Formal Check
+         if (n < _secCandidate[i].size()) { _secCandidate[i].resize(n); _secCheckFail[i] = false; }
       }
    }
    else if (initValid) initializeECPair();
@@ -575,44 +716,134 @@ V3VrfSEC::getTargetCandidate() {
    return index;
 }
 
+// Private Parallel Induction Functions
+const uint32_t
+V3VrfSEC::checkECPairInParallel(V3RepIdHash& repIdHash) {
+   // This function checks a batch of untested candidate classes by k-induction with k = _secLastDepth.
+   // Each class is proved on its own (not speculatively), so proven classes are merged together afterwards.
+   V3UI32Vec targets; targets.clear(); targets.reserve(V3_SEC_INDUCTION_BATCH_SIZE);
+   for (uint32_t i = 0; i < _secCandidate.size() && targets.size() < V3_SEC_INDUCTION_BATCH_SIZE; ++i)
+      if (!_secCheckFail[i]) targets.push_back(i);
+   if (!targets.size()) return 0;
+   // Create Nets Equating Each Target Class before Solvers are Allocated
+   V3NetVec eqNets; eqNets.clear(); eqNets.reserve(targets.size());
+   for (uint32_t i = 0; i < targets.size(); ++i) eqNets.push_back(getSECMiter(targets[i]));
+   // Split Target Classes among Workers, Each with its Own Solver on the (Read-only) SEC Network
+   const uint32_t workers = (targets.size() < _secThreads) ? targets.size() : _secThreads; assert (workers);
+   V3Vec<V3VrfSECInductionTask>::Vec tasks(workers); V3Vec<pthread_t>::Vec thread(workers); V3BoolVec spawned(workers, false);
+   const uint32_t chunk = (targets.size() + workers - 1) / workers;
+   for (uint32_t i = 0; i < workers; ++i) {
+      tasks[i].sec = this; tasks[i].solver = allocSolver(getSolver(), _secNtk); assert (tasks[i].solver);
+      tasks[i].eqNets = &eqNets; tasks[i].depth = _secLastDepth;
+      tasks[i].begin = (targets.size() < i * chunk) ? targets.size() : i * chunk;
+      tasks[i].end = (targets.size() < tasks[i].begin + chunk) ? targets.size() : tasks[i].begin + chunk;
+      tasks[i].proven = V3BoolVec(tasks[i].end - tasks[i].begin, false);
+      tasks[i].cex = V3Vec<V3CexTrace*>::Vec(tasks[i].end - tasks[i].begin, 0);
+   }
+   for (uint32_t i = 0; i < workers; ++i) {
+      spawned[i] = !pthread_create(&thread[i], NULL, checkECPairWorker, &tasks[i]);
+      if (!spawned[i]) checkECPairWorker(&tasks[i]);  // Fall Back to the Calling Thread
+   }
+   // Collect Results : Refuted and Undecided Classes are Deferred as in Sequential Checking
+   V3UI32Vec proven; proven.clear();
+   for (uint32_t i = 0; i < workers; ++i) {
+      if (spawned[i]) pthread_join(thread[i], NULL);
+      delete tasks[i].solver;
+      for (uint32_t j = tasks[i].begin; j < tasks[i].end; ++j) {
+         if (tasks[i].proven[j - tasks[i].begin]) { proven.push_back(targets[j]); continue; }
+         V3CexTrace* const cex = tasks[i].cex[j - tasks[i].begin];
+         if (cex) { pushSimulationTrace(*cex); delete cex; } _secCheckFail[targets[j]] = true;
+      }
+   }
+   // Commit Proven Merges in a Batch (in Descending Index, since updateEQList Swaps in the Last Class)
+   // NOTE: targets are Ascending and Workers Take Consecutive Chunks, so proven is Ascending as well
+   if (proven.size()) {
+      for (uint32_t i = proven.size(); i > 0; --i) updateEQList(proven[i - 1], repIdHash);
+      replaceSECNetwork(repIdHash);
+   }
+   return targets.size();
+}
+
+void*
+V3VrfSEC::checkECPairWorker(void* data) {
+   V3VrfSECInductionTask* const task = (V3VrfSECInductionTask*)data; assert (task);
+   V3SvrBase* const solver = task->solver; assert (solver);
+   const uint32_t& depth = task->depth; assert (depth);
+   for (uint32_t i = task->begin; i < task->end; ++i) {
+      const V3NetId& id = (*(task->eqNets))[i];
+      for (uint32_t d = 0; d <= depth; ++d) solver->addBoundedVerifyData(id, d);
+      // Induction Step : EQ in depth Consecutive Frames Implies EQ in the Next Frame
+      solver->assumeRelease();
+      for (uint32_t d = 0; d < depth; ++d) solver->assumeProperty(id, false, d);
+      solver->assumeProperty(id, true, depth); if (solver->assump_solve()) continue;
+      // Base Case : EQ in the First depth Frames from Initial States
+      task->proven[i - task->begin] = true;
+      for (uint32_t d = 0; d < depth; ++d) {
+         solver->assumeRelease(); solver->assumeInit(); solver->assumeProperty(id, true, d);
+         if (!solver->assump_solve()) continue;
+         task->cex[i - task->begin] = task->sec->getSolverCexTrace(solver, 1 + d);
+         task->proven[i - task->begin] = false; break;
+      }
+   }
+   return 0;
+}
+
 // Private SEC Network Transformation Functions
-void
-V3VrfSEC::replaceSECOutput(const uint32_t& x) {
+const V3NetId
+V3VrfSEC::getSECEqNet(const V3NetId& a, const V3NetId& b) {
+   // Return a Net Asserting a == b, Reusing a Cached Net if its Gates still Read a and b
+   // NOTE: Entries are Checked Structurally, so Stale Entries after Network Updates are Simply Rebuilt
    const bool isBvNtk = dynamic_cast<V3BvNtk*>(_secNtk); V3InputVec inputs(2, V3NetUD);
-   V3NetVec eqPairs; eqPairs.clear(); eqPairs.reserve(_secCandidate[x].size() - 1);
-   if (isBvNtk) {
-      V3NetId id;
-      for (uint32_t i = 1; i < _secCandidate[x].size(); ++i) {
-         id = _secNtk->createNet(); assert (V3NetUD != id);
-         inputs[0] = _secCandidate[x][0]; inputs[1] = _secCandidate[x][i];
-         _secNtk->setInput(id, inputs); _secNtk->createGate(BV_EQUALITY, id); eqPairs.push_back(id);
+   const uint64_t key = V3PairType(V3NetType(a).value, V3NetType(b).value).pair;
+   V3SECEqHash::iterator it = _secEqHash.find(key);
+   if (_secEqHash.end() != it && it->second.id < _secNtk->getNetSize()) {
+      const V3NetId id = it->second;
+      if (isBvNtk) {
+         if (BV_EQUALITY == _secNtk->getGateType(id) && a == _secNtk->getInputNetId(id, 0) &&
+             b == _secNtk->getInputNetId(id, 1)) return id;
       }
-      inputs[0] = eqPairs[0];
-      for (uint32_t i = 1; i < eqPairs.size(); ++i) {
-         id = _secNtk->createNet(); assert (V3NetUD != id); inputs[1] = eqPairs[i];
-         _secNtk->setInput(id, inputs); _secNtk->createGate(BV_AND, id); inputs[0] = id;
+      else if (AIG_NODE == _secNtk->getGateType(id)) {
+         const V3NetId id1 = ~(_secNtk->getInputNetId(id, 0)), id2 = ~(_secNtk->getInputNetId(id, 1));
+         if (!id1.cp && !id2.cp && AIG_NODE == _secNtk->getGateType(id1) && AIG_NODE == _secNtk->getGateType(id2) &&
+             a == _secNtk->getInputNetId(id1, 0) && ~b == _secNtk->getInputNetId(id1, 1) &&
+             ~a == _secNtk->getInputNetId(id2, 0) && b == _secNtk->getInputNetId(id2, 1)) return id;
       }
    }
+   V3NetId id;
+   if (isBvNtk) {
+      id = _secNtk->createNet(); assert (V3NetUD != id); inputs[0] = a; inputs[1] = b;
+      _secNtk->setInput(id, inputs); _secNtk->createGate(BV_EQUALITY, id);
+   }
    else {
-      V3NetId id, id1, id2;
-      for (uint32_t i = 1; i < _secCandidate[x].size(); ++i) {
-         id1 = _secNtk->createNet(); assert (V3NetUD != id1);
-         inputs[0] = _secCandidate[x][0]; inputs[1] = ~_secCandidate[x][i];
-         _secNtk->setInput(id1, inputs); _secNtk->createGate(AIG_NODE, id1);
-         id2 = _secNtk->createNet(); assert (V3NetUD != id2);
-         inputs[0] = ~_secCandidate[x][0]; inputs[1] = _secCandidate[x][i];
-         _secNtk->setInput(id2, inputs); _secNtk->createGate(AIG_NODE, id2);
-         id = _secNtk->createNet(); assert (V3NetUD != id); inputs[0] = ~id1; inputs[1] = ~id2;
-         _secNtk->setInput(id, inputs); _secNtk->createGate(AIG_NODE, id); eqPairs.push_back(id);
-      }
-      inputs[0] = eqPairs[0];
-      for (uint32_t i = 1; i < eqPairs.size(); ++i) {
-         id = _secNtk->createNet(); assert (V3NetUD != id); inputs[1] = eqPairs[i];
-         _secNtk->setInput(id, inputs); _secNtk->createGate(AIG_NODE, id); inputs[0] = id;
-      }
+      const V3NetId id1 = _secNtk->createNet(); assert (V3NetUD != id1);
+      inputs[0] = a; inputs[1] = ~b; _secNtk->setInput(id1, inputs); _secNtk->createGate(AIG_NODE, id1);
+      const V3NetId id2 = _secNtk->createNet(); assert (V3NetUD != id2);
+      inputs[0] = ~a; inputs[1] = b; _secNtk->setInput(id2, inputs); _secNtk->createGate(AIG_NODE, id2);
+      id = _secNtk->createNet(); assert (V3NetUD != id); inputs[0] = ~id1; inputs[1] = ~id2;
+      _secNtk->setInput(id, inputs); _secNtk->createGate(AIG_NODE, id);
    }
+   _secEqHash[key] = id; return id;
+}
+
+const V3NetId
+V3VrfSEC::getSECMiter(const uint32_t& x) {
+   // Return a Net Asserting All Nets in Candidate Class x are Equivalent
+   assert (x < _secCandidate.size()); assert (1 < _secCandidate[x].size());
+   const V3GateType type = dynamic_cast<V3BvNtk*>(_secNtk) ? BV_AND : AIG_NODE;
+   V3InputVec inputs(2, V3NetUD); V3NetId id;
+   inputs[0] = getSECEqNet(_secCandidate[x][0], _secCandidate[x][1]);
+   for (uint32_t i = 2; i < _secCandidate[x].size(); ++i) {
+      inputs[1] = getSECEqNet(_secCandidate[x][0], _secCandidate[x][i]);
+      id = _secNtk->createNet(); assert (V3NetUD != id);
+      _secNtk->setInput(id, inputs); _secNtk->createGate(type, id); inputs[0] = id;
+   }
+   return inputs[0].id;
+}
+
+void
+V3VrfSEC::replaceSECOutput(const uint32_t& x) {
    // Replace Property Output
-   _secNtk->replaceOutput(_secNtk->getOutputSize() - 1, ~(inputs[0].id));
+   _secNtk->replaceOutput(_secNtk->getOutputSize() - 1, ~getSECMiter(x));
 }
 
 void
@@ -683,7 +914,7 @@ V3VrfSEC::simplifySECNetwork(V3NetVec& p2cMap, V3NetVec& c2pMap, const V3NetVec&
       const V3NetId id = _secNtk->getOutput(i); assert (V3NetUD != p2cMap[id.id]);
       simpNtk->createOutput(V3NetId::makeNetId(p2cMap[id.id].id, p2cMap[id.id].cp ^ id.cp));
    }
-   replaceV3Ntk(_secNtk, simpNtk); delete simpNtk;
+   replaceV3Ntk(_secNtk, simpNtk); delete simpNtk; _secEqHash.clear();
    _secNtk->createOutput(V3NetId::makeNetId(0));
    if (profileON()) _simpStat->end();
 }
@@ -734,9 +965,9 @@ V3VrfSEC::speculativeReduction(const uint32_t& cycle) {
       replaceV3Ntk(_secNtk, secNtk); delete solver; if (!cexList.size()) break;
       // Extract Counterexample for Updating EC Candidates
       for (uint32_t i = 0; i < cexList.size(); ++i) {
-         if (_secCandidate.size()) addSimulationTrace(*(cexList[i]), false);
-         delete cexList[i];
+         pushSimulationTrace(*(cexList[i])); delete cexList[i];
       }
+      flushSimulationTrace(false);
    }
 
    // Replace Fanins According to EC Candidates
@@ -794,6 +1025,19 @@ V3VrfSEC::speculativeReduction(const uint32_t& cycle) {
    delete secNtk; _c2pMap = c2pMap; p2cMap.clear(); c2pMap.clear();
 }
 
+void
+V3VrfSEC::fraigSECNetwork() {
+   // Nets Equivalent under Free Latches are Equivalent in Every Reachable State,
+   // so They are Merged without Induction and Leave the SEC Candidates Immediately
+   if (dynamic_cast<V3BvNtk*>(_secNtk) || _secNtk->getModuleSize()) return;
+   V3NetVec repMap; V3AlgFraig fraig(_secHandler, getSolver());
+   if (!fraig.fraig(repMap)) return; assert (repMap.size() == _secNtk->getNetSize());
+   V3RepIdHash repIdHash; repIdHash.clear();
+   for (uint32_t i = 0; i < repMap.size(); ++i)
+      if (i != repMap[i].id) repIdHash.insert(make_pair(i, repMap[i]));
+   replaceSECNetwork(repIdHash);
+}
+
 // Private SEC Helper Functions
 const bool
 V3VrfSEC::isValidChecker() const {
@@ -13,7 +13,9 @@
 #include "v3AlgSimulate.h"
 
 // Type Defines
-typedef V3Vec<V3SimTrace>::Vec   V3VrfSimTraceVec;
+typedef V3Vec<V3SimTrace>::Vec         V3VrfSimTraceVec;
+typedef V3Vec<V3VrfSimTraceVec>::Vec   V3VrfSimTraceList;
+typedef V3HashMap<uint64_t, V3NetId>::Hash   V3SECEqHash;
 
 // class V3VrfSEC : Verification Handler for Sequential Equivalence Checking
 class V3VrfSEC : public V3VrfBase
@@ -27,6 +29,8 @@ class V3VrfSEC : public V3VrfBase
       inline void setAssumeCECMiter() { _secCECAssumed = 1; }
       inline void setAssumeSECMiter() { _secSECAssumed = 1; }
       inline void setSynthesisMode(const bool& s) { _secSynthesis = s; }
+      inline void setFraigMode(const bool& f) { _secFraig = f; }
+      inline void setInductionThreads(const uint32_t& t) { assert (t); _secThreads = t; }
       // SEC Network Retrieval Functions
       // NOTE: An extra primary output is augmented for SEC checks
       inline V3NtkHandler* const getSECHandler() const { return _secHandler; }
@@ -35,6 +39,8 @@ class V3VrfSEC : public V3VrfBase
       inline const bool isAssumeCECMiter() const { return _secCECAssumed; }
       inline const bool isAssumeSECMiter() const { return _secSECAssumed; }
       inline const bool isSynthesisMode() const { return _secSynthesis; }
+      inline const bool isFraigMode() const { return _secFraig; }
+      inline const bool isParallelMode() const { return 1 < _secThreads && !_constr.size(); }
       inline const bool isInternalCEC() const { return _secCECAssumed && !_secIsCECorSEC; }
       inline const bool isInternalSEC() const { return _secSECAssumed &&  _secIsCECorSEC; }
       inline void setInternalCEC() { assert (isAssumeCECMiter()); _secIsCECorSEC = 0; }
@@ -45,20 +51,29 @@ class V3VrfSEC : public V3VrfBase
       void randomSimulate(const uint32_t&, const uint32_t&, const bool&);
       void addSimulationTrace(const V3CexTrace&, const bool& = true);
       void addSimulationTrace(const V3SimTrace&, const V3VrfSimTraceVec&, const bool&);
+      void pushSimulationTrace(const V3CexTrace&);
+      void flushSimulationTrace(const bool& = true);
+      void addSimulationBatch(const uint32_t&, const uint32_t&, const bool&);
       void computeTrace(const V3CexTrace&, V3SimTrace&, V3VrfSimTraceVec&);
       V3CexTrace* const getSolverCexTrace(V3SvrBase* const, const uint32_t&);
       V3CexTrace* const computeTrace(const V3SimTrace&, const V3VrfSimTraceVec&, const uint32_t&);
       // Private EC Pair Construction Functions
       void initializeECPair();
       void removeECPairOutOfCOI();
-      void updateECPair(const bool&, const bool&);
+      void updateECPair(const bool&, const bool&, const uint64_t& = ~0ul);
       void updateEQList(const uint32_t&, V3RepIdHash&);
       const uint32_t getTargetCandidate();
+      // Private Parallel Induction Functions
+      const uint32_t checkECPairInParallel(V3RepIdHash&);
+      static void* checkECPairWorker(void*);
       // Private SEC Network Transformation Functions
+      const V3NetId getSECEqNet(const V3NetId&, const V3NetId&);
+      const V3NetId getSECMiter(const uint32_t&);
       void replaceSECOutput(const uint32_t&);
       void replaceSECNetwork(V3RepIdHash&);
       void simplifySECNetwork(V3NetVec&, V3NetVec&, const V3NetVec& = V3NetVec());
       void speculativeReduction(const uint32_t&);
+      void fraigSECNetwork();
       // Private SEC Helper Functions
       const bool isValidChecker() const;
       const bool isValidNet(const V3NetId&) const;
@@ -77,12 +92,18 @@ class V3VrfSEC : public V3VrfBase
       // Private EC Pair Storage Data
       V3NetTable        _secCandidate;       // List of SEC Candidates
       V3BoolVec         _secCheckFail;       // List of Undecided Candidates
+      V3SECEqHash       _secEqHash;          // Nets Equating Candidate Pairs (Reused while Intact)
       uint32_t          _secEQSize;          // Number of Proven EQ Sets
+      uint32_t          _secThreads;         // Number of Threads for Parallel Induction
       uint32_t          _secSynthesis  :  1; // Toggle Synthesis Mode
       uint32_t          _secIsCECorSEC :  1; // Toggle Internal CEC or SEC
       uint32_t          _secCECAssumed :  1; // Toggle Assuming CEC Miter
       uint32_t          _secSECAssumed :  1; // Toggle Assuming SEC Miter
-      uint32_t          _secLastDepth  : 28; // Last Checked Deep Bound
+      uint32_t          _secFraig      :  1; // Toggle SAT Sweeping
+      uint32_t          _secLastDepth  : 27; // Last Checked Deep Bound
+      // Private Counterexample Batch
+      V3VrfSimTraceVec  _secBatchInit;       // Initial States of Pending Counterexamples
+      V3VrfSimTraceList _secBatchTrace;      // Input Traces of Pending Counterexamples
       // Statistics
       V3Stat*           _totalStat;          // Total Statistic
       V3Stat*           _simStat;            // Simulation
@@ -49,7 +49,7 @@ V3VrfSIM::startVerify(const uint32_t& p) {
 
    // Initialize Simulator
    V3AlgSimulate* simulator = 0;
-   if (dynamic_cast<V3BvNtk*>(_vrfNtk)) simulator = new V3AlgBvSimulate(_handler);
+   if (dynamic_cast<V3BvNtk*>(_vrfNtk)) simulator = new V3AlgBvFlatSimulate(_handler);
    else simulator = new V3AlgAigSimulate(_handler); assert (simulator);
 
    // Initialize Constraint Satisfaction Value
@@ -85,12 +85,13 @@ V3VrfSharedInv::pushInv(V3SvrBase* const solver, V3Ntk* const ntk, const uint32_
 \* -------------------------------------------------- */
 // Constructor and Destructor
 V3VrfSharedNtk::V3VrfSharedNtk() {
-   _data.clear();
+   _data.clear(); _slice.clear(); _stamp = 0;
 }
 
 V3VrfSharedNtk::~V3VrfSharedNtk() {
    lock(); for (uint32_t i = 0; i < _data.size(); ++i) if (_data[i]._handler) delete _data[i]._handler;
-   _data.clear(); unlock();
+   for (V3VrfSharedNtkCache::iterator it = _slice.begin(); it != _slice.end(); ++it) delete it->second._handler;
+   _data.clear(); _slice.clear(); unlock();
 }
 
 // Public Member Functions
@@ -113,6 +114,11 @@ V3VrfSharedNtk::updateNtk(V3Ntk* const ntk, const V3NetTable& constr) {
 void
 V3VrfSharedNtk::releaseNtk(V3NtkHandler* const handler) {
    assert (handler); lock();
+   // Sliced Networks are Kept for Later Checkers until Evicted
+   for (V3VrfSharedNtkCache::iterator it = _slice.begin(); it != _slice.end(); ++it) {
+      if (handler != it->second._handler) continue;
+      assert (it->second._refCount); --(it->second._refCount); unlock(); return;
+   }
    uint32_t i = 0; for (; i < _data.size(); ++i) if (handler == _data[i]._handler) break;
    if (i < _data.size()) {
       assert (_data[i]._refCount);
@@ -147,5 +153,38 @@ V3VrfSharedNtk::getNtk(V3NtkHandler* const handler, V3NetTable& constr) {
    unlock(); return simpHandler;
 }
 
-#endif
+// Property-Sliced Network Functions
+V3NtkHandler* const
+V3VrfSharedNtk::getNtk(const V3UI32Vec& propList) {
+   assert (propList.size()); lock();
+   V3VrfSharedNtkCache::iterator it = _slice.find(propList);
+   V3NtkHandler* const simpHandler = (_slice.end() == it) ? 0 : it->second._handler;
+   if (simpHandler) { ++(it->second._refCount); it->second._lastUse = ++_stamp; }
+   unlock(); return simpHandler;
+}
+
+V3NtkHandler* const
+V3VrfSharedNtk::insertNtk(const V3UI32Vec& propList, V3NtkHandler* const handler) {
+   // Another Checker may have Inserted the Same Slice, then Keep the Cached One
+   assert (propList.size()); assert (handler); lock();
+   V3VrfSharedNtkCache::iterator it = _slice.find(propList);
+   if (_slice.end() != it) {
+      delete handler; ++(it->second._refCount); it->second._lastUse = ++_stamp;
+      V3NtkHandler* const simpHandler = it->second._handler; unlock(); return simpHandler;
+   }
+   // Evict Least Recently Used Slices that are NOT Referenced
+   while (_slice.size() >= V3_SHARED_NTK_CACHE_SIZE) {
+      V3VrfSharedNtkCache::iterator victim = _slice.end();
+      for (it = _slice.begin(); it != _slice.end(); ++it) {
+         if (it->second._refCount) continue;
+         if (_slice.end() == victim || it->second._lastUse < victim->second._lastUse) victim = it;
+      }
+      if (_slice.end() == victim) break;
+      delete victim->second._handler; _slice.erase(victim);
+   }
+   V3VrfSharedNtkSlice& slice = _slice[propList];
+   slice._refCount = 1; slice._lastUse = ++_stamp; slice._handler = handler;
+   unlock(); return handler;
+}
 
+#endif
@@ -23,6 +23,9 @@
 // Defines
 typedef V3Vec<V3VrfResult>::Vec  V3VrfResultVec;
 
+// Max Number of Property-Sliced Networks Kept in V3VrfSharedNtk
+#define V3_SHARED_NTK_CACHE_SIZE 128
+
 // class V3VrfShared : Base class for Verification Shared Data
 class V3VrfShared
 {
@@ -79,6 +82,9 @@ class V3VrfSharedInv : public V3VrfShared
 };
 
 // class V3VrfSharedNtk : Optimized Network for Checkers
+// Besides the latest optimized network, networks sliced to the COI of a property set are cached,
+// so that checkers on the same properties share one reduced model. Cached networks stay after
+// their last release, and are evicted (least recently used first) when the cache is full.
 class V3VrfSharedNtk : public V3VrfShared
 {
    public :
@@ -91,6 +97,9 @@ class V3VrfSharedNtk : public V3VrfShared
       void releaseNtk(V3NtkHandler* const);
       V3NtkHandler* const getNtk(V3NtkHandler* const);
       V3NtkHandler* const getNtk(V3NtkHandler* const, V3NetTable&);
+      // Property-Sliced Network Functions
+      V3NtkHandler* const getNtk(const V3UI32Vec&);
+      V3NtkHandler* const insertNtk(const V3UI32Vec&, V3NtkHandler* const);
    private :
       struct V3VrfSharedNtkData
       {
@@ -98,8 +107,17 @@ class V3VrfSharedNtk : public V3VrfShared
          V3NtkHandler*     _handler;      // Network Handler
          V3NetTable        _constr;       // Constraints
       };
+      struct V3VrfSharedNtkSlice
+      {
+         uint32_t          _refCount;     // Reference Count
+         uint32_t          _lastUse;      // Time Stamp of the Latest getNtk
+         V3NtkHandler*     _handler;      // Network Handler
+      };
+      typedef V3Map<V3UI32Vec, V3VrfSharedNtkSlice>::Map V3VrfSharedNtkCache;
       // Private Data Members
       V3Vec<V3VrfSharedNtkData>::Vec   _data;   // Verification Data for Optimized Networks
+      V3VrfSharedNtkCache              _slice;  // Networks Sliced to the COI of Property Sets
+      uint32_t                         _stamp;  // Time Stamp for Cache Eviction
 };
 
 // class V3VrfSharedMem : Memory Control Among Checkers
@@ -107,16 +125,16 @@ class V3VrfSharedMem : public V3VrfShared
 {
    public : 
       // Constructor and Destructor
-      V3VrfSharedMem(const double& m) : V3VrfShared() { _maxMemory = m; }
+      V3VrfSharedMem(const double& m) : V3VrfShared() { updateMaxMemory(m); v3MemAccount.startSampler(); }
       ~V3VrfSharedMem() {}
       // Public Member Functions
-      inline void updateMaxMemory(const double& m) { lock(); _maxMemory = m; unlock(); }
-      inline const double getMaxMemory() { lock(); const double m = _maxMemory; unlock(); return m; }
-      inline const double getMemory() { lock(); const double m = v3Usage.getMemUsage(); unlock(); return m; }
-      inline const bool isMemValid() { lock(); const double m = v3Usage.getMemUsage(); unlock(); return _maxMemory > m; }
+      inline void updateMaxMemory(const double& m) { __atomic_store_n(&_maxBytes, (uint64_t)(m * 1048576.0), __ATOMIC_RELAXED); }
+      inline const double getMaxMemory() { return __atomic_load_n(&_maxBytes, __ATOMIC_RELAXED) / 1048576.0; }
+      inline const double getMemory() { return v3MemAccount.getMemUsage(); }
+      inline const bool isMemValid() { return __atomic_load_n(&_maxBytes, __ATOMIC_RELAXED) > v3MemAccount.getMemBytes(); }
    private : 
       // Private Data Members
-      double               _maxMemory;    // Memory Bound
+      uint64_t             _maxBytes;     // Memory Bound (in Bytes)
 };
 
 #endif
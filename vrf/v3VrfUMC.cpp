@@ -25,7 +25,8 @@ V3VrfUMC::V3VrfUMC(const V3NtkHandler* const handler) : V3VrfBase(handler) {
    // Private Data Members
    _preDepth = 0; _incDepth = 1; _umcAttr = 0; _solver = 0;
    // Uniqueness Constraints
-   _uniList.clear(); _uniLatch.clear(); _uniAssump.clear();
+   _uniList.clear(); _uniLatch.clear(); _uniAssump.clear(); _uniDiff.clear();
+   _lazyFrame.clear(); _lazyAssump.clear(); _lazyLatch.clear();
 }
 
 V3VrfUMC::~V3VrfUMC() {
@@ -33,7 +34,8 @@ V3VrfUMC::~V3VrfUMC() {
    if (_solver) delete _solver; _solver = 0;
    // Uniqueness Constraints
    for (uint32_t i = 0; i < _uniAssump.size(); ++i) _uniAssump[i].clear();
-   _uniAssump.clear(); _uniList.clear(); _uniLatch.clear();
+   _uniAssump.clear(); _uniList.clear(); _uniLatch.clear(); _uniDiff.clear();
+   _lazyFrame.clear(); _lazyAssump.clear(); _lazyLatch.clear();
 }
 
 // Private Verification Main Functions
@@ -59,7 +61,8 @@ vrfRestart:
    // Initialize Uniqueness Constraint Data Members
    if (!isIncContinueOnLastSolver() || !isIncKeepLastReachability()) {
       for (uint32_t i = 0; i < _uniAssump.size(); ++i) _uniAssump[i].clear();
-      _uniAssump.clear(); _uniList.clear(); _uniLatch.clear();
+      _uniAssump.clear(); _uniList.clear(); _uniLatch.clear(); _uniDiff.clear();
+      _lazyFrame.clear(); _lazyAssump.clear(); _lazyLatch.clear();
    }
    
    // Initialize Parameters
@@ -77,7 +80,7 @@ vrfRestart:
    pFormula.reserve((_preDepth > _incDepth) ? _preDepth : _incDepth);
    
    // Initialize Uniqueness Data
-   if (isUniqueness() && _uniLatch.size() != _vrfNtk->getLatchSize()) _uniLatch = V3UI32Vec(_vrfNtk->getLatchSize(), 0);
+   if (isUniqueness() && !isLazyUniqueness() && _uniLatch.size() != _vrfNtk->getLatchSize()) _uniLatch = V3UI32Vec(_vrfNtk->getLatchSize(), 0);
 
    // Start UMC Based Verification
    uint32_t i = 0, k = 0;
@@ -105,7 +108,7 @@ vrfRestart:
       // Check Shared Invariants
       if (_sharedInv) _sharedInv->pushInv(_solver, _vrfNtk, i);
       // Add Uniqueness Constraints
-      if (isUniqueness()) {
+      if (isUniqueness() && !isLazyUniqueness()) {
          // Push New V3SvrDataVec for New Depth
          for (uint32_t u = _uniAssump.size(); u <= i; ++u)
             _uniAssump.push_back(V3SvrDataVec(_uniList.size(), V3NtkUD));
@@ -121,6 +124,7 @@ vrfRestart:
          // Add assume for assumption solve only
          _solver->assumeRelease(); _solver->assumeProperty(pId, false, i);
          for (uint32_t x = 0; x < i; ++x) _solver->assumeProperty(pId, true, x);
+         if (isLazyUniqueness()) for (uint32_t x = 0; x < _lazyAssump.size(); ++x) addLazyUniqueness(x);
          // Assumption Solve : If UNSAT, proved!
          while (true) {
             _solver->simplify();
@@ -131,6 +135,10 @@ vrfRestart:
                   if (i <= _sharedBound->getBound(p)) { proved = i; break; } return;
                }
             }
+            else if (isLazyUniqueness()) {
+               // Forbid Only the States Repeated on this Spurious Trace
+               if (!generateAndAddLazyUniqueness(i)) break;
+            }
             else {
                if (!isUniqueness()) break;
                // Analyze Counterexample for New Uniqueness Bounds
@@ -140,7 +148,7 @@ vrfRestart:
          }
          if (V3NtkUD != proved) break;
          // Compute New Latches for Uniqueness in the Next Iteration
-         if (isUniqueness()) computeLatchBoundsForUniqueness(i);
+         if (isUniqueness() && !isLazyUniqueness()) computeLatchBoundsForUniqueness(i);
       }
       // Perform BMC Check
       if (!isProveOnly()) {
@@ -167,7 +175,7 @@ vrfRestart:
                      if (_solver->getDataValue(pFormula[x])) { fired = (1 + i + x - pFormula.size()); break; }
                   assert (V3NtkUD != fired); break;
                }
-               if (_sharedBound) _sharedBound->updateBound(p, 1 + i);
+               updateSharedBound(p, 1 + i);
             }
          }
          // Increase Depth for Next BMC
@@ -265,26 +273,12 @@ V3VrfUMC::addUniqueness(const uint32_t& depth, const uint32_t& uIndex, const boo
    assert (_uniAssump.size() > eqDepth);
    assert (_uniAssump[eqDepth].size() > uIndex);
    assert (!force || (V3NtkUD == _uniAssump[eqDepth][uIndex]));
-   V3NetId id; V3SvrDataVec eq(3), assump; assump.clear();
+   V3SvrDataVec assump; assump.clear(); V3SvrData diff;
    for (uint32_t i = 0; i < _vrfNtk->getLatchSize(); ++i) {
-      id = _vrfNtk->getLatch(i); assert (id.id < _vrfNtk->getNetSize());
       if (!force && (depth < _uniLatch[i])) continue;  // Constraint Computed
-      if (!_solver->existVerifyData(id, eqDepth)) continue;
-      if (!_solver->existVerifyData(id, depth)) continue;
-      assump.push_back(_solver->reserveFormula());
-      eq[0] = _solver->getNegFormula(assump.back());
-      eq[1] = _solver->getFormula(id, eqDepth);
-      eq[2] = _solver->getFormula(id, depth);
-      _solver->assertImplyUnion(eq);
-      eq[1] = _solver->getFormula(~id, eqDepth);
-      eq[2] = _solver->getFormula(~id, depth);
-      _solver->assertImplyUnion(eq);
-   }
-   if (assump.size()) {
-      if (V3NtkUD != _uniAssump[eqDepth][uIndex]) assump.push_back(_uniAssump[eqDepth][uIndex]);
-      _uniAssump[eqDepth][uIndex] = _solver->setImplyUnion(assump);
+      diff = getLatchDiffFormula(i, eqDepth, depth); if (V3NtkUD != diff) assump.push_back(diff);
    }
-   if (V3NtkUD != _uniAssump[eqDepth][uIndex]) _solver->assumeProperty(_uniAssump[eqDepth][uIndex]);
+   assumeUniqueness(assump, _uniAssump[eqDepth][uIndex]);
 }
 
 void
@@ -300,18 +294,7 @@ const bool
 V3VrfUMC::generateAndAddUniquenessBound(const uint32_t& depth) {
    assert (_solver); if (!depth) return false;
    // Record State Values on Current Counterexample
-   V3Vec<V3BitVecX>::Vec stateVec(1 + depth); V3NetId id;
-   for (uint32_t i = 0; i <= depth; ++i) {
-      for (uint32_t j = 0; j < _vrfNtk->getLatchSize(); ++j) {
-         id = _vrfNtk->getLatch(j); assert (id.id < _vrfNtk->getNetSize());
-         if (!j) {
-            if (!_solver->existVerifyData(id, i)) stateVec[i].resize(1);
-            else stateVec[i] = _solver->getDataValue(id, i);
-         }
-         else stateVec[i] = stateVec[i].bv_concat((_solver->existVerifyData(id, i)) ? 
-                                                  _solver->getDataValue(id, i) : V3BitVecX(1));
-      }
-   }
+   V3Vec<V3BitVecX>::Vec stateVec; recordStateValues(depth, stateVec);
    // Check Repeated States
    V3UI32Set newUniBound; newUniBound.clear();
    for (uint32_t i = 0; i < stateVec.size(); ++i)
@@ -326,5 +309,92 @@ V3VrfUMC::generateAndAddUniquenessBound(const uint32_t& depth) {
    return true;
 }
 
+void
+V3VrfUMC::addLazyUniqueness(const uint32_t& x) {
+   assert (_solver); assert (x < _lazyAssump.size()); assert (_lazyLatch[x].size() == _vrfNtk->getLatchSize());
+   const uint32_t eqDepth = _lazyFrame[x << 1], depth = _lazyFrame[1 + (x << 1)]; assert (eqDepth < depth);
+   // Compare Latches Newly Added to Both Frames, Earlier Comparisons are Reused through the Last Assumption
+   V3SvrDataVec assump; assump.clear(); V3SvrData diff;
+   for (uint32_t i = 0; i < _vrfNtk->getLatchSize(); ++i) {
+      if (_lazyLatch[x][i]) continue;
+      diff = getLatchDiffFormula(i, eqDepth, depth); if (V3NtkUD == diff) continue;
+      assump.push_back(diff); _lazyLatch[x][i] = true;
+   }
+   assumeUniqueness(assump, _lazyAssump[x]);
+}
+
+const bool
+V3VrfUMC::generateAndAddLazyUniqueness(const uint32_t& depth) {
+   assert (_solver); if (!depth) return false;
+   // Record State Values on Current Counterexample
+   V3Vec<V3BitVecX>::Vec stateVec; recordStateValues(depth, stateVec);
+   // Pair Each Frame with its Nearest Repetition Only, which Suffices to Refute this Trace
+   const uint32_t pairSize = _lazyAssump.size(); bool exist;
+   for (uint32_t i = 0; i < stateVec.size(); ++i)
+      for (uint32_t j = 1 + i; j < stateVec.size(); ++j) {
+         if (!stateVec[i].bv_intersect(stateVec[j])) continue; exist = false;
+         for (uint32_t x = 0; x < pairSize; ++x)
+            if (i == _lazyFrame[x << 1] && j == _lazyFrame[1 + (x << 1)]) { exist = true; break; }
+         if (!exist) {
+            _lazyFrame.push_back(i); _lazyFrame.push_back(j); _lazyAssump.push_back(V3NtkUD);
+            _lazyLatch.push_back(V3BoolVec(_vrfNtk->getLatchSize(), false));
+         }
+         break;
+      }
+   if (pairSize == _lazyAssump.size()) return false;
+   // Add New Uniqueness Constraints
+   for (uint32_t x = pairSize; x < _lazyAssump.size(); ++x) addLazyUniqueness(x);
+   return true;
+}
+
+const V3SvrData
+V3VrfUMC::getLatchDiffFormula(const uint32_t& i, const uint32_t& eqDepth, const uint32_t& depth) {
+   assert (_solver); assert (i < _vrfNtk->getLatchSize()); assert (eqDepth < depth);
+   const V3NetId id = _vrfNtk->getLatch(i); assert (id.id < _vrfNtk->getNetSize());
+   if (!_solver->existVerifyData(id, eqDepth)) return V3NtkUD;
+   if (!_solver->existVerifyData(id, depth)) return V3NtkUD;
+   // Reuse the Formula if the Latch was Compared between the Same Frames
+   if (_uniDiff.size() != _vrfNtk->getLatchSize()) _uniDiff.resize(_vrfNtk->getLatchSize());
+   const uint64_t key = ((uint64_t)eqDepth << 32) | depth;
+   V3UMCDiffHash::const_iterator it = _uniDiff[i].find(key); if (_uniDiff[i].end() != it) return it->second;
+   // Encode diff -> (latch@eqDepth != latch@depth)
+   const V3SvrData diff = _solver->reserveFormula(); V3SvrDataVec eq(3);
+   eq[0] = _solver->getNegFormula(diff);
+   eq[1] = _solver->getFormula(id, eqDepth);
+   eq[2] = _solver->getFormula(id, depth);
+   _solver->assertImplyUnion(eq);
+   eq[1] = _solver->getFormula(~id, eqDepth);
+   eq[2] = _solver->getFormula(~id, depth);
+   _solver->assertImplyUnion(eq);
+   _uniDiff[i].insert(make_pair(key, diff)); return diff;
+}
+
+void
+V3VrfUMC::assumeUniqueness(V3SvrDataVec& assump, V3SvrData& uniAssump) {
+   assert (_solver);
+   // Extend the Constraint by New Latch Differences, Earlier Ones are Reused through the Last Assumption
+   if (assump.size()) {
+      if (V3NtkUD != uniAssump) assump.push_back(uniAssump);
+      uniAssump = _solver->setImplyUnion(assump);
+   }
+   if (V3NtkUD != uniAssump) _solver->assumeProperty(uniAssump);
+}
+
+void
+V3VrfUMC::recordStateValues(const uint32_t& depth, V3Vec<V3BitVecX>::Vec& stateVec) {
+   assert (_solver); stateVec.clear(); stateVec.resize(1 + depth); V3NetId id;
+   for (uint32_t i = 0; i <= depth; ++i) {
+      for (uint32_t j = 0; j < _vrfNtk->getLatchSize(); ++j) {
+         id = _vrfNtk->getLatch(j); assert (id.id < _vrfNtk->getNetSize());
+         if (!j) {
+            if (!_solver->existVerifyData(id, i)) stateVec[i].resize(1);
+            else stateVec[i] = _solver->getDataValue(id, i);
+         }
+         else stateVec[i] = stateVec[i].bv_concat((_solver->existVerifyData(id, i)) ? 
+                                                  _solver->getDataValue(id, i) : V3BitVecX(1));
+      }
+   }
+}
+
 #endif
 
@@ -11,6 +11,9 @@
 
 #include "v3VrfBase.h"
 
+// Defines for Uniqueness Constraints
+typedef V3HashMap<uint64_t, V3SvrData>::Hash  V3UMCDiffHash;
+
 // class V3VrfUMC : Verification Handler for Unbounded Model Checking
 class V3VrfUMC : public V3VrfBase
 {
@@ -25,17 +28,24 @@ class V3VrfUMC : public V3VrfBase
       inline void setProveOnly (const bool& p) { if (p) _umcAttr |= 2ul; else _umcAttr &= ~2ul; }
       inline void setUniqueness(const bool& u) { if (u) _umcAttr |= 4ul; else _umcAttr &= ~4ul; }
       inline void setDynamicInc(const bool& d) { if (d) _umcAttr |= 8ul; else _umcAttr &= ~8ul; }
+      inline void setLazyUniqueness(const bool& l) { if (l) _umcAttr |= 16ul; else _umcAttr &= ~16ul; }
    private : 
       // Private Verification Main Functions
       void startVerify(const uint32_t&);
       void addUniqueness(const uint32_t&, const uint32_t&, const bool& = false);
       void computeLatchBoundsForUniqueness(const uint32_t&);
       const bool generateAndAddUniquenessBound(const uint32_t&);
+      void addLazyUniqueness(const uint32_t&);
+      const bool generateAndAddLazyUniqueness(const uint32_t&);
+      const V3SvrData getLatchDiffFormula(const uint32_t&, const uint32_t&, const uint32_t&);
+      void assumeUniqueness(V3SvrDataVec&, V3SvrData&);
+      void recordStateValues(const uint32_t&, V3Vec<V3BitVecX>::Vec&);
       // UMC Specific Helper Functions
       inline const bool isFireOnly  () { return _umcAttr & 1ul; }
       inline const bool isProveOnly () { return _umcAttr & 2ul; }
       inline const bool isUniqueness() { return _umcAttr & 4ul; }
       inline const bool isDynamicInc() { return _umcAttr & 8ul; }
+      inline const bool isLazyUniqueness() { return _umcAttr & 16ul; }
       // Private Data Members
       uint32_t       _preDepth;     // Pre-Run Depth (default = 0)
       uint32_t       _incDepth;     // Increment Depth (default = 1)
@@ -45,6 +55,11 @@ class V3VrfUMC : public V3VrfBase
       V3UI32Vec      _uniList;      // List of Uniqueness Bounds  (Indexed by uniIndex)
       V3UI32Vec      _uniLatch;     // Upper Bound of Depth for the Existence of Latch in the Solver
       V3SvrDataTable _uniAssump;    // Assumptions to Enable Uniqueness for Every Pair [depth][uniIndex]
+      // Lazy Uniqueness Constraints (Only between Frames Repeated on Spurious Induction Traces)
+      V3UI32Vec      _lazyFrame;    // Frame Pairs to be Distinct  (Frames 2i and 2i+1 for Pair i)
+      V3SvrDataVec   _lazyAssump;   // Assumption to Enable the Constraint of Each Pair
+      V3BoolTable    _lazyLatch;    // Latches Already Compared in Each Pair
+      V3Vec<V3UMCDiffHash>::Vec _uniDiff;  // Formula Implying Difference of Each Latch between Frames [latch][(eqDepth << 32) | depth]
 };
 
 #endif